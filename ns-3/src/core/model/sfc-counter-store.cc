@@ -0,0 +1,175 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "sfc-counter-store.h"
+#include "simulator.h"
+#include "simulator-singleton.h"
+#include "assert.h"
+#include "log.h"
+
+#include <algorithm>
+
+/**
+ * \file
+ * \ingroup simulator
+ * Implementation of class ns3::SfcCounterStore.
+ */
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("SfcCounterStore");
+
+NS_OBJECT_ENSURE_REGISTERED (SfcCounterStore);
+
+const uint32_t SfcCounterStore::DEFAULT_INSTANCE_COUNT;
+
+TypeId
+SfcCounterStore::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::SfcCounterStore")
+    .SetParent<Object> ()
+    .SetGroupName ("Core")
+    .AddConstructor<SfcCounterStore> ()
+  ;
+  return tid;
+}
+
+SfcCounterStore::SfcCounterStore ()
+  : m_all (0),
+    m_generation (0)
+{
+  NS_LOG_FUNCTION (this);
+  SetInstanceCount (DEFAULT_INSTANCE_COUNT);
+}
+
+Ptr<SfcCounterStore>
+SfcCounterStore::Get (void)
+{
+  return SimulatorSingleton<SfcCounterStore>::Get ();
+}
+
+void
+SfcCounterStore::SetInstanceCount (uint32_t count)
+{
+  NS_LOG_FUNCTION (this << count);
+  m_total.resize (count, 0);
+  m_window.resize (count, 0);
+  m_snapshot.resize (count, 0);
+  m_current.resize (count, 0);
+}
+
+uint32_t
+SfcCounterStore::GetInstanceCount (void) const
+{
+  return m_total.size ();
+}
+
+uint32_t
+SfcCounterStore::Reserve (uint32_t i)
+{
+  NS_ASSERT_MSG (i > 0, "Instance numbers start from 1");
+  if (i > GetInstanceCount ())
+    {
+      SetInstanceCount (i);
+    }
+  return i - 1;
+}
+
+void
+SfcCounterStore::IncreaseTotal (uint32_t i)
+{
+  uint32_t index = Reserve (i);
+  m_total[index]++;
+  m_window[index]++;
+}
+
+int
+SfcCounterStore::GetTotal (uint32_t i) const
+{
+  return (i > 0 && i <= m_total.size ()) ? m_total[i - 1] : 0;
+}
+
+int
+SfcCounterStore::GetWindow (uint32_t i) const
+{
+  return (i > 0 && i <= m_window.size ()) ? m_window[i - 1] : 0;
+}
+
+int
+SfcCounterStore::GetSnapshot (uint32_t i) const
+{
+  return (i > 0 && i <= m_snapshot.size ()) ? m_snapshot[i - 1] : 0;
+}
+
+void
+SfcCounterStore::IncreaseCurrent (uint32_t i)
+{
+  m_current[Reserve (i)]++;
+}
+
+void
+SfcCounterStore::DecreaseCurrent (uint32_t i)
+{
+  m_current[Reserve (i)]--;
+}
+
+int
+SfcCounterStore::GetCurrent (uint32_t i) const
+{
+  return (i > 0 && i <= m_current.size ()) ? m_current[i - 1] : 0;
+}
+
+const std::vector<int>&
+SfcCounterStore::GetTotals (void) const
+{
+  return m_total;
+}
+
+const std::vector<int>&
+SfcCounterStore::GetSnapshots (void) const
+{
+  return m_snapshot;
+}
+
+void
+SfcCounterStore::IncreaseAll (void)
+{
+  m_all++;
+}
+
+int
+SfcCounterStore::GetAll (void) const
+{
+  return m_all;
+}
+
+void
+SfcCounterStore::SwapWindow (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_all = 0;
+  m_snapshot.swap (m_window);
+  std::fill (m_window.begin (), m_window.end (), 0);
+  m_generation++;
+}
+
+uint64_t
+SfcCounterStore::GetGeneration (void) const
+{
+  return m_generation;
+}
+
+} // namespace ns3
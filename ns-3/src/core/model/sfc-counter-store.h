@@ -0,0 +1,165 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef SFC_COUNTER_STORE_H
+#define SFC_COUNTER_STORE_H
+
+#include "object.h"
+#include "ptr.h"
+
+#include <vector>
+
+/**
+ * \file
+ * \ingroup simulator
+ * Declaration of class ns3::SfcCounterStore.
+ */
+
+namespace ns3 {
+
+/**
+ * \ingroup simulator
+ *
+ * \brief Function call counters of every service function instance
+ *
+ * Instances are numbered from 1, in the order used by the SFC scenarios
+ * (F1a = 1, ..., F5c = 15).  Each counter kind is kept in its own
+ * contiguous array, which grows when an instance beyond the current
+ * count is updated.
+ *
+ * Calls are counted into the current window.  SwapWindow() publishes
+ * the window as the snapshot read by the consumers and starts a new
+ * empty window.
+ *
+ * The store of the running simulation is aggregated to the simulator
+ * implementation, so it is discarded by Simulator::Destroy.
+ */
+class SfcCounterStore : public Object
+{
+public:
+  /**
+   * Get the registered TypeId for this class.
+   * \return The object TypeId.
+   */
+  static TypeId GetTypeId (void);
+
+  /** Number of instances in the default SFC scenarios. */
+  static const uint32_t DEFAULT_INSTANCE_COUNT = 15;
+
+  SfcCounterStore ();
+
+  /**
+   * Get the store of the running simulation, creating it if needed.
+   *
+   * The store is looked up once per simulation and cached until
+   * Simulator::Destroy.
+   * \return The store aggregated to the simulator implementation.
+   */
+  static Ptr<SfcCounterStore> Get (void);
+
+  /**
+   * Set the number of instances, keeping the counts of the existing ones.
+   * \param [in] count The new number of instances.
+   */
+  void SetInstanceCount (uint32_t count);
+
+  /** \return The number of instances. */
+  uint32_t GetInstanceCount (void) const;
+
+  /**
+   * Count a function call of instance \p i in the total and the current window.
+   * \param [in] i The instance number, starting from 1.
+   */
+  void IncreaseTotal (uint32_t i);
+
+  /**
+   * \param [in] i The instance number, starting from 1.
+   * \return The number of calls of instance \p i since the start of the run.
+   */
+  int GetTotal (uint32_t i) const;
+
+  /**
+   * \param [in] i The instance number, starting from 1.
+   * \return The number of calls of instance \p i in the current window.
+   */
+  int GetWindow (uint32_t i) const;
+
+  /**
+   * \param [in] i The instance number, starting from 1.
+   * \return The number of calls of instance \p i in the last completed window.
+   */
+  int GetSnapshot (uint32_t i) const;
+
+  /**
+   * \name Outstanding calls
+   * Calls that entered instance \p i and have not left it yet.
+   * \param [in] i The instance number, starting from 1.
+   * @{
+   */
+  void IncreaseCurrent (uint32_t i);
+  void DecreaseCurrent (uint32_t i);
+  int GetCurrent (uint32_t i) const;
+  /**@}*/
+
+  /**
+   * The totals of all instances; element 0 holds instance 1.
+   * \return A reference valid until the instance count changes.
+   */
+  const std::vector<int>& GetTotals (void) const;
+
+  /**
+   * The last completed window of all instances; element 0 holds instance 1.
+   * \return A reference valid until the instance count changes.
+   */
+  const std::vector<int>& GetSnapshots (void) const;
+
+  /** Count a function call of any instance in the current window. */
+  void IncreaseAll (void);
+
+  /** \return The number of calls of any instance in the current window. */
+  int GetAll (void) const;
+
+  /**
+   * Publish the current window as the snapshot and start a new window.
+   */
+  void SwapWindow (void);
+
+  /**
+   * The number of windows completed so far.  Readers caching values
+   * derived from the snapshot compare it to detect a new snapshot.
+   * \return The number of SwapWindow() calls since the start of the run.
+   */
+  uint64_t GetGeneration (void) const;
+
+private:
+  /**
+   * Make room for instance \p i.
+   * \param [in] i The instance number, starting from 1.
+   * \return The array index of instance \p i.
+   */
+  uint32_t Reserve (uint32_t i);
+
+  std::vector<int> m_total;     //!< Calls since the start of the run.
+  std::vector<int> m_window;    //!< Calls in the current window.
+  std::vector<int> m_snapshot;  //!< Calls in the last completed window.
+  std::vector<int> m_current;   //!< Outstanding calls.
+  int m_all;                    //!< Calls of any instance in the current window.
+  uint64_t m_generation;        //!< Completed windows.
+};
+
+} // namespace ns3
+
+#endif /* SFC_COUNTER_STORE_H */
@@ -0,0 +1,212 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "sfc-run-context.h"
+#include "simulator.h"
+#include "simulator-singleton.h"
+#include "log.h"
+
+/**
+ * \file
+ * \ingroup simulator
+ * Implementation of class ns3::SfcRunContext.
+ */
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("SfcRunContext");
+
+NS_OBJECT_ENSURE_REGISTERED (SfcRunContext);
+
+TypeId
+SfcRunContext::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::SfcRunContext")
+    .SetParent<Object> ()
+    .SetGroupName ("Core")
+    .AddConstructor<SfcRunContext> ()
+  ;
+  return tid;
+}
+
+SfcRunContext::SfcRunContext ()
+  : m_choiceType (SIRAIWA_NDN),
+    m_weight (0),
+    m_interestNum (0),
+    m_dataNum (0),
+    m_serviceNum (0),
+    m_totalSend (0),
+    m_totalHops (0),
+    m_totalServiceTime (0),
+    m_averageServiceTime (0)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+Ptr<SfcRunContext>
+SfcRunContext::Get (void)
+{
+  return SimulatorSingleton<SfcRunContext>::Get ();
+}
+
+bool
+SfcRunContext::ParseChoiceType (const std::string& name, ChoiceType& type)
+{
+  if (name == "siraiwaNDN")
+    {
+      type = SIRAIWA_NDN;
+    }
+  else if (name == "roundRobin")
+    {
+      type = ROUND_ROBIN;
+    }
+  else if (name == "duration")
+    {
+      type = DURATION;
+    }
+  else if (name == "randChoice")
+    {
+      type = RAND_CHOICE;
+    }
+  else if (name == "fibControl")
+    {
+      type = FIB_CONTROL;
+    }
+  else
+    {
+      return false;
+    }
+  return true;
+}
+
+void
+SfcRunContext::SetChoiceType (ChoiceType type)
+{
+  NS_LOG_FUNCTION (this << type);
+  m_choiceType = type;
+}
+
+SfcRunContext::ChoiceType
+SfcRunContext::GetChoiceType (void) const
+{
+  return m_choiceType;
+}
+
+void
+SfcRunContext::SetWeight (int weight)
+{
+  NS_LOG_FUNCTION (this << weight);
+  m_weight = weight;
+}
+
+int
+SfcRunContext::GetWeight (void) const
+{
+  return m_weight;
+}
+
+void
+SfcRunContext::IncreaseInterestNum (void)
+{
+  m_interestNum++;
+}
+
+int
+SfcRunContext::GetInterestNum (void) const
+{
+  return m_interestNum;
+}
+
+void
+SfcRunContext::IncreaseDataNum (void)
+{
+  m_dataNum++;
+}
+
+int
+SfcRunContext::GetDataNum (void) const
+{
+  return m_dataNum;
+}
+
+void
+SfcRunContext::IncreaseServiceNum (void)
+{
+  m_serviceNum++;
+}
+
+int
+SfcRunContext::GetServiceNum (void) const
+{
+  return m_serviceNum;
+}
+
+void
+SfcRunContext::IncreaseTotalSend (void)
+{
+  m_totalSend++;
+}
+
+int
+SfcRunContext::GetTotalSend (void) const
+{
+  return m_totalSend;
+}
+
+void
+SfcRunContext::IncreaseTotalHops (int hops)
+{
+  m_totalHops += hops;
+}
+
+int
+SfcRunContext::GetTotalHops (void) const
+{
+  return m_totalHops;
+}
+
+void
+SfcRunContext::IncreaseTotalServiceTime (int serviceTime)
+{
+  m_totalServiceTime += serviceTime;
+}
+
+int
+SfcRunContext::GetTotalServiceTime (void) const
+{
+  return m_totalServiceTime;
+}
+
+void
+SfcRunContext::SetAverageServiceTime (double serviceTime)
+{
+  m_averageServiceTime = serviceTime;
+}
+
+double
+SfcRunContext::GetAverageServiceTime (void) const
+{
+  return m_averageServiceTime;
+}
+
+void
+SfcRunContext::Print (std::ostream& os) const
+{
+  os << "AverageServiceTime: " << m_averageServiceTime << std::endl;
+  os << "ServiceNum: " << m_serviceNum << std::endl;
+}
+
+} // namespace ns3
@@ -0,0 +1,142 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef SFC_RUN_CONTEXT_H
+#define SFC_RUN_CONTEXT_H
+
+#include "object.h"
+#include "ptr.h"
+
+#include <ostream>
+#include <string>
+
+/**
+ * \file
+ * \ingroup simulator
+ * Declaration of class ns3::SfcRunContext.
+ */
+
+namespace ns3 {
+
+/**
+ * \ingroup simulator
+ *
+ * \brief Settings and result metrics of one SFC simulation run
+ *
+ * The context of the running simulation is aggregated to the simulator
+ * implementation, next to its SfcCounterStore.  Simulator::Destroy
+ * discards both, so that the next run starts from the default
+ * settings and empty metrics.
+ *
+ * Get() caches the context until Simulator::Destroy, so the per-packet
+ * accessors in simulator.h do not look it up on every call.
+ *
+ * \warning The first call to Get() (e.g. through setChoiceType() or
+ * setWeight()) creates the default simulator implementation.  A custom
+ * implementation must therefore be installed with
+ * Simulator::SetImplementation before any SFC setting is made;
+ * calling it afterwards is a fatal error until Simulator::Destroy.
+ */
+class SfcRunContext : public Object
+{
+public:
+  /**
+   * Get the registered TypeId for this class.
+   * \return The object TypeId.
+   */
+  static TypeId GetTypeId (void);
+
+  /** Instance selection modes of the SFC forwarding. */
+  enum ChoiceType
+  {
+    SIRAIWA_NDN = 0,
+    ROUND_ROBIN = 1,
+    DURATION = 2,
+    RAND_CHOICE = 3,
+    FIB_CONTROL = 4
+  };
+
+  SfcRunContext ();
+
+  /**
+   * Get the context of the running simulation, creating it if needed.
+   *
+   * The context is looked up once per simulation and cached until
+   * Simulator::Destroy.
+   * \return The context aggregated to the simulator implementation.
+   */
+  static Ptr<SfcRunContext> Get (void);
+
+  /**
+   * Parse the name of a selection mode, e.g. "fibControl".
+   * \param [in] name The mode name.
+   * \param [out] type The parsed mode, unchanged if \p name is unknown.
+   * \return Whether \p name is a known mode.
+   */
+  static bool ParseChoiceType (const std::string& name, ChoiceType& type);
+
+  /**
+   * \name Settings
+   * @{
+   */
+  void SetChoiceType (ChoiceType type);
+  ChoiceType GetChoiceType (void) const;
+  /** Weight of the call counts against the hop counts (load first = 100, hop first = 0). */
+  void SetWeight (int weight);
+  int GetWeight (void) const;
+  /**@}*/
+
+  /**
+   * \name Metrics
+   * @{
+   */
+  void IncreaseInterestNum (void);
+  int GetInterestNum (void) const;
+  void IncreaseDataNum (void);
+  int GetDataNum (void) const;
+  void IncreaseServiceNum (void);
+  int GetServiceNum (void) const;
+  void IncreaseTotalSend (void);
+  int GetTotalSend (void) const;
+  void IncreaseTotalHops (int hops);
+  int GetTotalHops (void) const;
+  void IncreaseTotalServiceTime (int serviceTime);
+  int GetTotalServiceTime (void) const;
+  void SetAverageServiceTime (double serviceTime);
+  double GetAverageServiceTime (void) const;
+  /**@}*/
+
+  /**
+   * Print the result summary of the run.
+   * \param [in] os The output stream.
+   */
+  void Print (std::ostream& os) const;
+
+private:
+  ChoiceType m_choiceType;       //!< Instance selection mode.
+  int m_weight;                  //!< Weight of the call counts.
+  int m_interestNum;             //!< Interests expressed by consumers.
+  int m_dataNum;                 //!< Data received by consumers.
+  int m_serviceNum;              //!< Completed services.
+  int m_totalSend;               //!< Interests sent by consumers.
+  int m_totalHops;               //!< Hops travelled by Data.
+  int m_totalServiceTime;        //!< Sum of the service times.
+  double m_averageServiceTime;   //!< Average service time.
+};
+
+} // namespace ns3
+
+#endif /* SFC_RUN_CONTEXT_H */
@@ -0,0 +1,119 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#ifndef SIMULATOR_SINGLETON_H
+#define SIMULATOR_SINGLETON_H
+
+#include "ptr.h"
+#include "object.h"
+
+/**
+ * \file
+ * \ingroup simulator
+ * ns3::SimulatorSingleton declaration and template implementation.
+ */
+
+namespace ns3 {
+
+/**
+ * \ingroup simulator
+ * An Object of type \p T aggregated to the simulator implementation,
+ * so that each simulation run has its own instance.
+ *
+ * Unlike SimulationSingleton, the instance is created with
+ * CreateObject, so its attributes are initialized, and it is owned by
+ * the simulator implementation, which releases it in
+ * Simulator::Destroy.  The instance is looked up once per run and
+ * cached in a static pointer; a destroy event clears the cache.
+ *
+ * The first call to Get() creates the simulator implementation, so
+ * Simulator::SetImplementation must be called before it.
+ */
+template <typename T>
+class SimulatorSingleton
+{
+public:
+  /**
+   * Get the instance of the running simulation, creating it if needed.
+   * \returns The instance aggregated to the simulator implementation.
+   */
+  static Ptr<T> Get (void);
+
+  /**
+   * Get the instance of the running simulation, if it has been created.
+   * \returns The instance, or 0 if Get() has not been called in this run.
+   */
+  static T *Peek (void);
+
+private:
+  /** Clear the cached instance when the simulation is destroyed. */
+  static void Reset (void);
+
+  /** The instance of the running simulation, owned by the simulator implementation. */
+  static T *s_current;
+};
+
+} // namespace ns3
+
+
+/********************************************************************
+ *  Implementation of the templates declared above.
+ ********************************************************************/
+
+#include "simulator.h"
+#include "simulator-impl.h"
+
+namespace ns3 {
+
+template <typename T>
+T *SimulatorSingleton<T>::s_current = 0;
+
+template <typename T>
+Ptr<T>
+SimulatorSingleton<T>::Get (void)
+{
+  if (s_current != 0)
+    {
+      return s_current;
+    }
+  Ptr<SimulatorImpl> impl = Simulator::GetImplementation ();
+  Ptr<T> instance = impl->GetObject<T> ();
+  if (instance == 0)
+    {
+      instance = CreateObject<T> ();
+      impl->AggregateObject (instance);
+    }
+  s_current = PeekPointer (instance);
+  Simulator::ScheduleDestroy (&SimulatorSingleton<T>::Reset);
+  return instance;
+}
+
+template <typename T>
+T *
+SimulatorSingleton<T>::Peek (void)
+{
+  return s_current;
+}
+
+template <typename T>
+void
+SimulatorSingleton<T>::Reset (void)
+{
+  s_current = 0;
+}
+
+} // namespace ns3
+
+#endif /* SIMULATOR_SINGLETON_H */
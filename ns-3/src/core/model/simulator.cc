@@ -20,6 +20,8 @@
 #include "ns3/core-config.h"
 #include "simulator.h"
 #include "simulator-impl.h"
+#include "sfc-counter-store.h"
+#include "sfc-run-context.h"
 #include "scheduler.h"
 #include "map-scheduler.h"
 #include "event-impl.h"
@@ -394,596 +396,120 @@ Simulator::GetImplementation (void)
   return GetImpl ();
 }
 
-int functionCallCount1 = 0;
-int functionCallCount2 = 0;
-int functionCallCount3 = 0;
-int functionCallCount4 = 0;
-int functionCallCount5 = 0;
-int functionCallCount6 = 0;
-int functionCallCount7 = 0;
-int functionCallCount8 = 0;
-int functionCallCount9 = 0;
-int functionCallCount10 = 0;
-int functionCallCount11 = 0;
-int functionCallCount12 = 0;
-int functionCallCount13 = 0;
-int functionCallCount14 = 0;
-int functionCallCount15 = 0;
-
-int totalFcc1 = 0;
-int totalFcc2 = 0;
-int totalFcc3 = 0;
-int totalFcc4 = 0;
-int totalFcc5 = 0;
-int totalFcc6 = 0;
-int totalFcc7 = 0;
-int totalFcc8 = 0;
-int totalFcc9 = 0;
-int totalFcc10 = 0;
-int totalFcc11 = 0;
-int totalFcc12 = 0;
-int totalFcc13 = 0;
-int totalFcc14 = 0;
-int totalFcc15 = 0;
-
-int totalFcc1temp = 0;
-int totalFcc2temp = 0;
-int totalFcc3temp = 0;
-int totalFcc4temp = 0;
-int totalFcc5temp = 0;
-int totalFcc6temp = 0;
-int totalFcc7temp = 0;
-int totalFcc8temp = 0;
-int totalFcc9temp = 0;
-int totalFcc10temp = 0;
-int totalFcc11temp = 0;
-int totalFcc12temp = 0;
-int totalFcc13temp = 0;
-int totalFcc14temp = 0;
-int totalFcc15temp = 0;
-
-int currentFcc1 = 0;
-int currentFcc2 = 0;
-int currentFcc3 = 0;
-int currentFcc4 = 0;
-int currentFcc5 = 0;
-int currentFcc6 = 0;
-int currentFcc7 = 0;
-int currentFcc8 = 0;
-int currentFcc9 = 0;
-int currentFcc10 = 0;
-int currentFcc11 = 0;
-int currentFcc12 = 0;
-int currentFcc13 = 0;
-int currentFcc14 = 0;
-int currentFcc15 = 0;
-
-
-int allFcc = 0;
-
-int totalHops = 0;
-
-int interestNum = 0;
-int dataNum = 0;
-int serviceNum = 0;
-
-int totalServiceTime = 0;
-
-static int choiceType = 0;
-
-int totalSend = 0;
-
-double averageServiceTime;
-
-int weight;
-
 int getFunctionCallCount(int i){
-  switch(i) {
-    case 1:
-      return functionCallCount1;
-      break;
-    case 2:
-      return functionCallCount2;
-      break;
-    case 3:
-      return functionCallCount3;
-      break;
-    case 4:
-      return functionCallCount4;
-      break;
-    case 5:
-      return functionCallCount5;
-      break;
-    case 6:
-      return functionCallCount6;
-      break;
-    case 7:
-      return functionCallCount7;
-      break;
-    case 8:
-      return functionCallCount8;
-      break;
-    case 9:
-      return functionCallCount9;
-      break;
-    case 10:
-      return functionCallCount10;
-      break;
-    case 11:
-      return functionCallCount11;
-      break;
-    case 12:
-      return functionCallCount12;
-      break;
-    case 13:
-      return functionCallCount13;
-      break;
-    case 14:
-      return functionCallCount14;
-      break;
-    case 15:
-      return functionCallCount15;
-      break;
-    default:
-      break;
-  }
+  return SfcCounterStore::Get ()->GetSnapshot (i);
 }
 
-
 void increaseFunctionCallCount(int i){
-  switch(i) {
-    case 1:
-      currentFcc1++;
-      break;
-    case 2:
-      currentFcc2++;
-      break;
-    case 3:
-      currentFcc3++;
-      break;
-    case 4:
-      currentFcc4++;
-      break;
-    case 5:
-      currentFcc5++;
-      break;
-    case 6:
-      currentFcc6++;
-      break;
-    case 7:
-      currentFcc7++;
-      break;
-    case 8:
-      currentFcc8++;
-      break;
-    case 9:
-      currentFcc9++;
-      break;
-    case 10:
-      currentFcc10++;
-      break;
-    case 11:
-      currentFcc11++;
-      break;
-    case 12:
-      currentFcc12++;
-      break;
-    case 13:
-      currentFcc13++;
-      break;
-    case 14:
-      currentFcc14++;
-      break;
-    case 15:
-      currentFcc15++;
-      break;
-    default:
-      break;
-  }
+  SfcCounterStore::Get ()->IncreaseCurrent (i);
 }
 
-
 void decreaseFunctionCallCount(int i){
-  switch(i) {
-    case 1:
-      currentFcc1--;
-      break;
-    case 2:
-      currentFcc2--;
-      break;
-    case 3:
-      currentFcc3--;
-      break;
-    case 4:
-      currentFcc4--;
-      break;
-    case 5:
-      currentFcc5--;
-      break;
-    case 6:
-      currentFcc6--;
-      break;
-    case 7:
-      currentFcc7--;
-      break;
-    case 8:
-      currentFcc8--;
-      break;
-    case 9:
-      currentFcc9--;
-      break;
-    case 10:
-      currentFcc10--;
-      break;
-    case 11:
-      currentFcc11--;
-      break;
-    case 12:
-      currentFcc12--;
-      break;
-    case 13:
-      currentFcc13--;
-      break;
-    case 14:
-      currentFcc14--;
-      break;
-    case 15:
-      currentFcc15--;
-      break;
-    default:
-      break;
-  }
+  SfcCounterStore::Get ()->DecreaseCurrent (i);
 }
 
 int getCurrentFcc(int i){
-  switch(i) {
-    case 1:
-      return currentFcc1;
-      break;
-    case 2:
-      return currentFcc2;
-      break;
-    case 3:
-      return currentFcc3;
-      break;
-    case 4:
-      return currentFcc4;
-      break;
-    case 5:
-      return currentFcc5;
-      break;
-    case 6:
-      return currentFcc6;
-      break;
-    case 7:
-      return currentFcc7;
-      break;
-    case 8:
-      return currentFcc8;
-      break;
-    case 9:
-      return currentFcc9;
-      break;
-    case 10:
-      return currentFcc10;
-      break;
-    case 11:
-      return currentFcc11;
-      break;
-    case 12:
-      return currentFcc12;
-      break;
-    case 13:
-      return currentFcc13;
-      break;
-    case 14:
-      return currentFcc14;
-      break;
-    case 15:
-      return currentFcc15;
-      break;
-    default:
-      break;
-  }
+  return SfcCounterStore::Get ()->GetCurrent (i);
 }
 
-
 int getTotalFcc(int i){
-  switch(i) {
-    case 1:
-      return totalFcc1;
-      break;
-    case 2:
-      return totalFcc2;
-      break;
-    case 3:
-      return totalFcc3;
-      break;
-    case 4:
-      return totalFcc4;
-      break;
-    case 5:
-      return totalFcc5;
-      break;
-    case 6:
-      return totalFcc6;
-      break;
-    case 7:
-      return totalFcc7;
-      break;
-    case 8:
-      return totalFcc8;
-      break;
-    case 9:
-      return totalFcc9;
-      break;
-    case 10:
-      return totalFcc10;
-      break;
-    case 11:
-      return totalFcc11;
-      break;
-    case 12:
-      return totalFcc12;
-      break;
-    case 13:
-      return totalFcc13;
-      break;
-    case 14:
-      return totalFcc14;
-      break;
-    case 15:
-      return totalFcc15;
-      break;
-    default:
-      break;
-  }
+  return SfcCounterStore::Get ()->GetTotal (i);
 }
 
 int getTotalFccTemp(int i){
-  switch(i) {
-    case 1:
-      return totalFcc1temp;
-      break;
-    case 2:
-      return totalFcc2temp;
-      break;
-    case 3:
-      return totalFcc3temp;
-      break;
-    case 4:
-      return totalFcc4temp;
-      break;
-    case 5:
-      return totalFcc5temp;
-      break;
-    case 6:
-      return totalFcc6temp;
-      break;
-    case 7:
-      return totalFcc7temp;
-      break;
-    case 8:
-      return totalFcc8temp;
-      break;
-    case 9:
-      return totalFcc9temp;
-      break;
-    case 10:
-      return totalFcc10temp;
-      break;
-    case 11:
-      return totalFcc11temp;
-      break;
-    case 12:
-      return totalFcc12temp;
-      break;
-    case 13:
-      return totalFcc13temp;
-      break;
-    case 14:
-      return totalFcc14temp;
-      break;
-    case 15:
-      return totalFcc15temp;
-      break;
-    default:
-      break;
-  }
+  return SfcCounterStore::Get ()->GetWindow (i);
 }
 
 void increaseTotalFcc(int i){
-  switch(i) {
-    case 1:
-      totalFcc1++;
-      totalFcc1temp++;
-      break;
-    case 2:
-      totalFcc2++;
-      totalFcc2temp++;
-      break;
-    case 3:
-      totalFcc3++;
-      totalFcc3temp++;
-      break;
-    case 4:
-      totalFcc4++;
-      totalFcc4temp++;
-      break;
-    case 5:
-      totalFcc5++;
-      totalFcc5temp++;
-      break;
-    case 6:
-      totalFcc6++;
-      totalFcc6temp++;
-      break;
-    case 7:
-      totalFcc7++;
-      totalFcc7temp++;
-      break;
-    case 8:
-      totalFcc8++;
-      totalFcc8temp++;
-      break;
-    case 9:
-      totalFcc9++;
-      totalFcc9temp++;
-      break;
-    case 10:
-      totalFcc10++;
-      totalFcc10temp++;
-      break;
-    case 11:
-      totalFcc11++;
-      totalFcc11temp++;
-      break;
-    case 12:
-      totalFcc12++;
-      totalFcc12temp++;
-      break;
-    case 13:
-      totalFcc13++;
-      totalFcc13temp++;
-      break;
-    case 14:
-      totalFcc14++;
-      totalFcc14temp++;
-      break;
-    case 15:
-      totalFcc15++;
-      totalFcc15temp++;
-      break;
-    default:
-      break;
-  }
+  SfcCounterStore::Get ()->IncreaseTotal (i);
 }
 
-int getInterestNum(){
-  return interestNum;
+void increaseAllFcc(){
+  SfcCounterStore::Get ()->IncreaseAll ();
 }
 
-int getDataNum(){
-  return dataNum;
+int getAllFcc(){
+  return SfcCounterStore::Get ()->GetAll ();
 }
 
-void increaseInterestNum(){
-  interestNum++;
+void resetFcc(){
+  SfcCounterStore::Get ()->SwapWindow ();
 }
 
-void increaseDataNum(){
-  dataNum++;
+int getInterestNum(){
+  return SfcRunContext::Get ()->GetInterestNum ();
 }
 
-int getServiceNum(){
-  return serviceNum;
+int getDataNum(){
+  return SfcRunContext::Get ()->GetDataNum ();
 }
 
-void increaseServiceNum(){
-  serviceNum++;
+void increaseInterestNum(){
+  SfcRunContext::Get ()->IncreaseInterestNum ();
 }
 
-void increaseAllFcc(){
-  allFcc++;
+void increaseDataNum(){
+  SfcRunContext::Get ()->IncreaseDataNum ();
 }
 
-int getAllFcc(){
-  return allFcc;
+int getServiceNum(){
+  return SfcRunContext::Get ()->GetServiceNum ();
 }
 
-void resetFcc(){
-  allFcc = 0;
-  functionCallCount1 = totalFcc1temp;
-  totalFcc1temp = 0;
-  functionCallCount2 = totalFcc2temp;
-  totalFcc2temp = 0;
-  functionCallCount3 = totalFcc3temp;
-  totalFcc3temp = 0;
-  functionCallCount4 = totalFcc4temp;
-  totalFcc4temp = 0;
-  functionCallCount5 = totalFcc5temp;
-  totalFcc5temp = 0;
-  functionCallCount6 = totalFcc6temp;
-  totalFcc6temp = 0;
-  functionCallCount7 = totalFcc7temp;
-  totalFcc7temp = 0;
-  functionCallCount8 = totalFcc8temp;
-  totalFcc8temp = 0;
-  functionCallCount9 = totalFcc9temp;
-  totalFcc9temp = 0;
-  functionCallCount10 = totalFcc10temp;
-  totalFcc10temp = 0;
-  functionCallCount11 = totalFcc11temp;
-  totalFcc11temp = 0;
-  functionCallCount12 = totalFcc12temp;
-  totalFcc12temp = 0;
-  functionCallCount13 = totalFcc13temp;
-  totalFcc13temp = 0;
-  functionCallCount14 = totalFcc14temp;
-  totalFcc14temp = 0;
-  functionCallCount15 = totalFcc15temp;
-  totalFcc15temp = 0;
+void increaseServiceNum(){
+  SfcRunContext::Get ()->IncreaseServiceNum ();
 }
 
 void increaseTotalHops(int i){
-  totalHops += i;
+  SfcRunContext::Get ()->IncreaseTotalHops (i);
 }
 
 void increaseTotalServiceTime(int i){
-  totalServiceTime += i;
+  SfcRunContext::Get ()->IncreaseTotalServiceTime (i);
 }
 
 int getTotalServiceTime(){
-  return totalServiceTime;
+  return SfcRunContext::Get ()->GetTotalServiceTime ();
 }
 
 void setChoiceType(const char* type){
-	std::string strType = type;
-	if(strType == "siraiwaNDN"){
-		choiceType = 0;
-	}else if(strType == "roundRobin"){
-		choiceType = 1;
-	}else if(strType == "duration"){
-		choiceType = 2;
-	}else if(strType == "randChoice"){
-		choiceType = 3;
-	}else if(strType == "fibControl"){
-		choiceType = 4;
+	SfcRunContext::ChoiceType choiceType;
+	if(SfcRunContext::ParseChoiceType(type, choiceType)){
+		SfcRunContext::Get()->SetChoiceType(choiceType);
 	}
 }
 
 int getChoiceType(){
-	return choiceType;
+	return SfcRunContext::Get()->GetChoiceType();
 }
 
 void increaseTotalSend(){
-	totalSend++;
+	SfcRunContext::Get()->IncreaseTotalSend();
 }
 
 int getTotalSend(){
-	return totalSend;
+	return SfcRunContext::Get()->GetTotalSend();
 }
 
 void setAverageServiceTime(double time){
-	averageServiceTime = time;
+	SfcRunContext::Get()->SetAverageServiceTime(time);
 }
 
 double getAverageServiceTime(){
-	return averageServiceTime;
+	return SfcRunContext::Get()->GetAverageServiceTime();
 }
 
 void printResult(){
-	std::cout << "AverageServiceTime: " << averageServiceTime << std::endl;
-	std::cout << "ServiceNum: " << serviceNum << std::endl;
+	SfcRunContext::Get()->Print(std::cout);
 }
 
 int getWeight(){
 	//LordFirst->100 HopFirst->0
-	return weight;
+	return SfcRunContext::Get()->GetWeight();
 }
 
 void setWeight(int w){
-	weight = w;
+	SfcRunContext::Get()->SetWeight(w);
 }
 
 } // namespace ns3
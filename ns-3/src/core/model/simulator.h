@@ -1554,6 +1554,12 @@ Simulator::ScheduleDestroy (void (*f)(U1,U2,U3,U4,U5), T1 a1, T2 a2, T3 a3, T4 a
   return DoScheduleDestroy (MakeEvent (f, a1, a2, a3, a4, a5));
 }
 
+/**
+ * \name Function call counters
+ * Shortcuts to the SfcCounterStore of the running simulation.
+ * \param i The instance number, starting from 1.
+ * @{
+ */
 int
 getFunctionCallCount(int i);
 
@@ -1575,6 +1581,21 @@ getTotalFccTemp(int i);
 void
 increaseTotalFcc(int i);
 
+void
+increaseAllFcc();
+
+int
+getAllFcc();
+
+void
+resetFcc();
+/**@}*/
+
+/**
+ * \name Run metrics
+ * Shortcuts to the SfcRunContext of the running simulation.
+ * @{
+ */
 int
 getInterestNum();
 
@@ -1593,15 +1614,6 @@ getServiceNum();
 void
 increaseServiceNum();
 
-void
-increaseAllFcc();
-
-int
-getAllFcc();
-
-void
-resetFcc();
-
 void increaseTotalHops(int i);
 
 void increaseTotalServiceTime(int i);
@@ -1625,6 +1637,7 @@ void printResult();
 int getWeight();
 
 void setWeight(int w);
+/**@}*/
 
 } // namespace ns3
 
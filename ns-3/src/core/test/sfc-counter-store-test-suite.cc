@@ -0,0 +1,80 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include "ns3/sfc-counter-store.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+
+using namespace ns3;
+
+class SfcCounterStoreWindowTestCase : public TestCase
+{
+public:
+  SfcCounterStoreWindowTestCase ();
+  virtual void DoRun (void);
+};
+
+SfcCounterStoreWindowTestCase::SfcCounterStoreWindowTestCase ()
+  : TestCase ("Check that SwapWindow publishes the counts of the current window")
+{
+}
+
+void
+SfcCounterStoreWindowTestCase::DoRun (void)
+{
+  Ptr<SfcCounterStore> store = SfcCounterStore::Get ();
+  NS_TEST_ASSERT_MSG_EQ (store, SfcCounterStore::Get (), "Each simulation has a single store");
+  NS_TEST_ASSERT_MSG_EQ (store->GetInstanceCount (), 15u, "Default scenarios have 15 instances");
+
+  store->IncreaseTotal (1);
+  store->IncreaseTotal (1);
+  store->IncreaseTotal (15);
+  store->IncreaseAll ();
+  NS_TEST_ASSERT_MSG_EQ (store->GetWindow (1), 2, "Calls are counted in the window");
+  NS_TEST_ASSERT_MSG_EQ (store->GetSnapshot (1), 0, "The snapshot is published on swap only");
+
+  NS_TEST_ASSERT_MSG_EQ (store->GetGeneration (), 0u, "No window is completed yet");
+  store->SwapWindow ();
+  NS_TEST_ASSERT_MSG_EQ (store->GetGeneration (), 1u, "Each swap completes a window");
+  NS_TEST_ASSERT_MSG_EQ (store->GetSnapshots ()[0], 2, "Wrong snapshot of instance 1");
+  NS_TEST_ASSERT_MSG_EQ (store->GetSnapshots ()[14], 1, "Wrong snapshot of instance 15");
+  NS_TEST_ASSERT_MSG_EQ (store->GetWindow (1), 0, "The window is cleared on swap");
+  NS_TEST_ASSERT_MSG_EQ (store->GetAll (), 0, "The call count of all instances is cleared on swap");
+
+  store->IncreaseTotal (1);
+  store->SwapWindow ();
+  NS_TEST_ASSERT_MSG_EQ (store->GetSnapshot (1), 1, "Wrong snapshot after the second window");
+  NS_TEST_ASSERT_MSG_EQ (store->GetTotal (1), 3, "Totals are kept across windows");
+
+  store->IncreaseTotal (40);
+  NS_TEST_ASSERT_MSG_EQ (store->GetInstanceCount (), 40u, "The store grows to the largest instance");
+  NS_TEST_ASSERT_MSG_EQ (store->GetTotal (40), 1, "Wrong total of instance 40");
+  NS_TEST_ASSERT_MSG_EQ (store->GetTotal (1), 3, "Growing keeps existing counts");
+  NS_TEST_ASSERT_MSG_EQ (store->GetTotal (41), 0, "Unknown instances have no calls");
+
+  Simulator::Destroy ();
+  NS_TEST_ASSERT_MSG_EQ (SfcCounterStore::Get ()->GetTotal (1), 0, "Simulator::Destroy discards the counts");
+  Simulator::Destroy ();
+}
+
+static class SfcCounterStoreTestSuite : public TestSuite
+{
+public:
+  SfcCounterStoreTestSuite ()
+    : TestSuite ("sfc-counter-store", UNIT)
+  {
+    AddTestCase (new SfcCounterStoreWindowTestCase (), TestCase::QUICK);
+  }
+} g_sfcCounterStoreTestSuite;
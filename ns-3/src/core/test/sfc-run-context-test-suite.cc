@@ -0,0 +1,71 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include "ns3/sfc-run-context.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+
+using namespace ns3;
+
+class SfcRunContextResetTestCase : public TestCase
+{
+public:
+  SfcRunContextResetTestCase ();
+  virtual void DoRun (void);
+};
+
+SfcRunContextResetTestCase::SfcRunContextResetTestCase ()
+  : TestCase ("Check that Simulator::Destroy resets the SFC run context")
+{
+}
+
+void
+SfcRunContextResetTestCase::DoRun (void)
+{
+  setChoiceType ("fibControl");
+  setWeight (100);
+  increaseServiceNum ();
+  increaseTotalServiceTime (40);
+  increaseTotalSend ();
+
+  Ptr<SfcRunContext> context = SfcRunContext::Get ();
+  NS_TEST_ASSERT_MSG_EQ (context->GetChoiceType (), SfcRunContext::FIB_CONTROL, "Wrong choice type");
+  NS_TEST_ASSERT_MSG_EQ (context->GetWeight (), 100, "Wrong weight");
+  NS_TEST_ASSERT_MSG_EQ (context->GetServiceNum (), 1, "Wrong service count");
+  NS_TEST_ASSERT_MSG_EQ (context->GetTotalServiceTime (), 40, "Wrong total service time");
+  NS_TEST_ASSERT_MSG_EQ (context->GetTotalSend (), 1, "Wrong send count");
+
+  setChoiceType ("unknown");
+  NS_TEST_ASSERT_MSG_EQ (getChoiceType (), SfcRunContext::FIB_CONTROL, "Unknown modes are ignored");
+
+  Simulator::Destroy ();
+
+  NS_TEST_ASSERT_MSG_EQ (getChoiceType (), SfcRunContext::SIRAIWA_NDN, "The choice type was not reset");
+  NS_TEST_ASSERT_MSG_EQ (getWeight (), 0, "The weight was not reset");
+  NS_TEST_ASSERT_MSG_EQ (getServiceNum (), 0, "The service count was not reset");
+  NS_TEST_ASSERT_MSG_EQ (getTotalServiceTime (), 0, "The total service time was not reset");
+  NS_TEST_ASSERT_MSG_EQ (getTotalSend (), 0, "The send count was not reset");
+  Simulator::Destroy ();
+}
+
+static class SfcRunContextTestSuite : public TestSuite
+{
+public:
+  SfcRunContextTestSuite ()
+    : TestSuite ("sfc-run-context", UNIT)
+  {
+    AddTestCase (new SfcRunContextResetTestCase (), TestCase::QUICK);
+  }
+} g_sfcRunContextTestSuite;
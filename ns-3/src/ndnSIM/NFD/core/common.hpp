@@ -99,6 +99,7 @@ using ndn::to_string;
 using ndn::Interest;
 using ndn::Data;
 using ndn::Name;
+using ndn::FunctionChain;
 using ndn::PartialName;
 using ndn::Exclude;
 using ndn::Link;
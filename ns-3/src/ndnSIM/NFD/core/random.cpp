@@ -24,19 +24,49 @@
  */
 
 #include "random.hpp"
-#include <boost/thread/tss.hpp>
+
+#include "ns3/random-variable-stream.h"
+#include "ns3/simulator-singleton.h"
+
+#include <limits>
 
 namespace nfd {
 
+/** \brief global random number generator of one simulation run
+ *
+ *  In ndnSIM the generator belongs to the simulation run rather than to the process, and its
+ *  seed is drawn from an ns-3 random stream, so that runs are reproducible and follow
+ *  RngSeed and RngRun.
+ */
+class GlobalRng : public ns3::Object
+{
+public:
+  static ns3::TypeId
+  GetTypeId()
+  {
+    static ns3::TypeId tid = ns3::TypeId("nfd::GlobalRng")
+      .SetGroupName("Ndn")
+      .SetParent<ns3::Object>()
+      .AddConstructor<GlobalRng>();
+    return tid;
+  }
+
+  GlobalRng()
+  {
+    ns3::Ptr<ns3::UniformRandomVariable> seed = ns3::CreateObject<ns3::UniformRandomVariable>();
+    rng.seed(seed->GetInteger(0, std::numeric_limits<uint32_t>::max() - 1));
+  }
+
+public:
+  std::mt19937 rng;
+};
+
+NS_OBJECT_ENSURE_REGISTERED(GlobalRng);
+
 std::mt19937&
 getGlobalRng()
 {
-  static boost::thread_specific_ptr<std::mt19937> rng;
-  if (rng.get() == nullptr) {
-    std::random_device rd;
-    rng.reset(new std::mt19937(rd()));
-  }
-  return *rng;
+  return ns3::SimulatorSingleton<GlobalRng>::Get()->rng;
 }
 
 } // namespace nfd
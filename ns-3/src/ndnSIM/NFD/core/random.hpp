@@ -42,6 +42,8 @@
 namespace nfd {
 
 /** \return the global random number generator instance
+ *
+ *  In ndnSIM, this is the generator of the running simulation, seeded from ns-3.
  */
 std::mt19937&
 getGlobalRng();
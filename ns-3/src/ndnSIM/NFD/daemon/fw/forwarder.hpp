@@ -31,6 +31,11 @@
 #include "forwarder-counters.hpp"
 #include "face-table.hpp"
 #include "unsolicited-data-policy.hpp"
+#include "function-instance-registry.hpp"
+#include "sfc-selection-policy.hpp"
+#include "sfc-feedback-aggregator.hpp"
+#include "sfc-load-advertiser.hpp"
+#include "sfc-data-trace.hpp"
 #include "table/fib.hpp"
 #include "table/pit.hpp"
 #include "table/cs.hpp"
@@ -42,6 +47,7 @@
 #include "ns3/ptr.h"
 #include "ns3/ndnSIM/model/ndn-l3-protocol.hpp"
 #include "ns3/ndnSIM/model/cs/ndn-content-store.hpp"
+#include "ns3/ndnSIM/model/ndn-function-processor.hpp"
 
 namespace nfd {
 
@@ -56,6 +62,10 @@ class Strategy;
 class Forwarder
 {
 public:
+	/** \brief straggler time used unless the tables section sets pit_straggler_time
+	 */
+	static const time::milliseconds DEFAULT_STRAGGLER_TIME;
+
 	Forwarder();
 
 	VIRTUAL_WITH_TESTS
@@ -118,6 +128,51 @@ public: // faces and policies
 		m_unsolicitedDataPolicy = std::move(policy);
 	}
 
+	fw::SfcSelectionPolicy&
+	getSfcSelectionPolicy() const
+	{
+		return *m_sfcSelectionPolicy;
+	}
+
+	void
+	setSfcSelectionPolicy(unique_ptr<fw::SfcSelectionPolicy> policy)
+	{
+		BOOST_ASSERT(policy != nullptr);
+		m_sfcSelectionPolicy = std::move(policy);
+	}
+
+	/** \brief how long a satisfied or rejected PIT entry is kept before it is finalized
+	 */
+	time::milliseconds
+	getStragglerTime() const
+	{
+		return m_stragglerTime;
+	}
+
+	void
+	setStragglerTime(time::milliseconds stragglerTime)
+	{
+		BOOST_ASSERT(stragglerTime >= time::milliseconds::zero());
+		m_stragglerTime = stragglerTime;
+	}
+
+	/** \brief whether a satisfied PIT entry is finalized as soon as no in-record is left
+	 *
+	 *  A PIT entry whose in-records are served one at a time, in the order of their sequence
+	 *  numbers, still waits for the straggler timer until its last in-record has been served.
+	 */
+	bool
+	shouldFinalizeWhenServed() const
+	{
+		return m_shouldFinalizeWhenServed;
+	}
+
+	void
+	setFinalizeWhenServed(bool shouldFinalize)
+	{
+		m_shouldFinalizeWhenServed = shouldFinalize;
+	}
+
 public: // forwarding entrypoints and tables
 	/** \brief start incoming Interest processing
 	 *  \param face face on which Interest is received
@@ -188,6 +243,47 @@ public: // forwarding entrypoints and tables
 		return m_networkRegionTable;
 	}
 
+	/** \brief function instances hosted on this forwarder
+	 */
+	fw::FunctionInstanceRegistry&
+	getFunctionInstanceRegistry()
+	{
+		return m_functionInstances;
+	}
+
+	/** \brief get the aggregator applying the feedback carried by Data to FIB entries
+	 */
+	fw::SfcFeedbackAggregator&
+	getSfcFeedbackAggregator()
+	{
+		return m_sfcFeedbackAggregator;
+	}
+
+	/** \brief get the advertiser exchanging the call load of function instances with neighbors
+	 */
+	fw::SfcLoadAdvertiser&
+	getSfcLoadAdvertiser()
+	{
+		return m_sfcLoadAdvertiser;
+	}
+
+	/** \brief set the service model of the function instances hosted on this forwarder
+	 *
+	 *  Data processed by a hosted instance is held by \p processor until its processing
+	 *  completes.  Without a processor, the Data is forwarded without delay.
+	 */
+	void
+	setFunctionProcessor(ns3::Ptr<ns3::ndn::FunctionProcessor> processor)
+	{
+		m_functionProcessor = processor;
+	}
+
+	ns3::Ptr<ns3::ndn::FunctionProcessor>
+	getFunctionProcessor() const
+	{
+		return m_functionProcessor;
+	}
+
 public: // allow enabling ndnSIM content store (will be removed in the future)
 	void
 	setCsFromNdnSim(ns3::Ptr<ns3::ndn::ContentStore> cs)
@@ -206,6 +302,10 @@ public:
 	 */
 	signal::Signal<Forwarder, pit::Entry> beforeExpirePendingInterest;
 
+	/** \brief trigger on every incoming Data, with the SFC tags it arrived with
+	 */
+	signal::Signal<Forwarder, Data, fw::SfcDataTrace> afterReceiveSfcData;
+
 	PUBLIC_WITH_TESTS_ELSE_PRIVATE: // pipelines
 	/** \brief incoming Interest pipeline
 	 */
@@ -256,6 +356,11 @@ public:
 	VIRTUAL_WITH_TESTS void
 	onIncomingData(Face& inFace, const Data& data);
 
+	/** \brief incoming Data pipeline, after the hosted function instance has processed the Data
+	 */
+	VIRTUAL_WITH_TESTS void
+	onProcessedData(Face& inFace, const Data& data);
+
 	/** \brief Data unsolicited pipeline
 	 */
 	VIRTUAL_WITH_TESTS void
@@ -309,6 +414,11 @@ public:
 		trigger(m_strategyChoice.findEffectiveStrategy(pitEntry));
 	}
 
+	/** \brief emit afterReceiveSfcData for incoming \p data
+	 */
+	void
+	emitSfcDataTrace(const Data& data);
+
 private:
 	ForwarderCounters m_counters;
 
@@ -316,6 +426,7 @@ private:
 
 	FaceTable m_faceTable;
 	unique_ptr<fw::UnsolicitedDataPolicy> m_unsolicitedDataPolicy;
+	unique_ptr<fw::SfcSelectionPolicy> m_sfcSelectionPolicy;
 
 	NameTree           m_nameTree;
 	Fib                m_fib;
@@ -325,24 +436,20 @@ private:
 	StrategyChoice     m_strategyChoice;
 	DeadNonceList      m_deadNonceList;
 	NetworkRegionTable m_networkRegionTable;
+	fw::FunctionInstanceRegistry m_functionInstances;
+	fw::SfcFeedbackAggregator m_sfcFeedbackAggregator;
+	fw::SfcLoadAdvertiser m_sfcLoadAdvertiser;
 	shared_ptr<Face>   m_csFace;
 
+	time::milliseconds m_stragglerTime;
+	bool m_shouldFinalizeWhenServed;
+
 	ns3::Ptr<ns3::ndn::ContentStore> m_csFromNdnSim;
-	int table[2][6][3]={
-			{{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}},
-			{{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}},
-	};
-	/*table index
-	 * 1st hop or count
-	 *  0:hop
-	 *  1:count
-	 * 2nd function number 1 to 5
-	 * 3rd function character 0 to 2 = a to c
-	 *
-	 * ex) table[1][1][0] means f1a count
+	/** \brief copy of the Data of the last hit in m_csFromNdnSim, carrying the service time and
+	 *         per-hop tags of the hit
 	 */
-
-	time::milliseconds m_resetTime;
+	shared_ptr<Data> m_csHitData;
+	ns3::Ptr<ns3::ndn::FunctionProcessor> m_functionProcessor;
 	/*
   int fcc1a =0;
   int fcc1b =0;
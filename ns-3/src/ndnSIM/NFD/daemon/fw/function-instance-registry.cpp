@@ -0,0 +1,81 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "function-instance-registry.hpp"
+#include "core/logger.hpp"
+
+#include "ns3/ndnSIM/utils/ndn-sfc-catalog.hpp"
+
+namespace nfd {
+namespace fw {
+
+NFD_LOG_INIT("FunctionInstanceRegistry");
+
+static int
+parseFunctionNumber(const std::string& function)
+{
+  size_t pos = function.find_first_of("0123456789");
+  if (pos == std::string::npos) {
+    return 0;
+  }
+  return std::atoi(function.c_str() + pos);
+}
+
+const FunctionInstance&
+FunctionInstanceRegistry::insert(const std::string& function, char instance)
+{
+  BOOST_ASSERT(instance >= 'a' && instance <= 'z');
+
+  FunctionChain::FunctionId instanceId = FunctionChain::intern(function + instance);
+  const FunctionInstance* existing = this->findByInstance(instanceId);
+  if (existing != nullptr) {
+    return *existing;
+  }
+
+  FunctionInstance fi;
+  fi.function = FunctionChain::intern(function);
+  fi.instance = instanceId;
+  fi.functionNumber = parseFunctionNumber(function);
+  fi.instanceIndex = instance - 'a';
+  fi.counterIndex = ns3::ndn::SfcCatalog::Get()->GetCounterIndex(function, fi.instanceIndex);
+  m_instances.push_back(fi);
+  const FunctionInstance* inserted = &m_instances.back();
+
+  size_t maxId = std::max(fi.function, fi.instance);
+  if (m_byFunction.size() <= maxId) {
+    m_byFunction.resize(maxId + 1, nullptr);
+    m_byInstance.resize(maxId + 1, nullptr);
+  }
+  if (m_byFunction[fi.function] == nullptr) {
+    m_byFunction[fi.function] = inserted;
+  }
+  m_byInstance[fi.instance] = inserted;
+
+  NFD_LOG_DEBUG("insert function=" << function << " instance=" << instance);
+  return *inserted;
+}
+
+} // namespace fw
+} // namespace nfd
@@ -0,0 +1,130 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FW_FUNCTION_INSTANCE_REGISTRY_HPP
+#define NFD_DAEMON_FW_FUNCTION_INSTANCE_REGISTRY_HPP
+
+#include "core/common.hpp"
+
+#include <deque>
+
+namespace nfd {
+namespace fw {
+
+/** \brief a service function instance hosted on a forwarder
+ */
+struct FunctionInstance
+{
+  /** \brief interned name of the function, e.g. "F1"
+   */
+  FunctionChain::FunctionId function;
+
+  /** \brief interned name of the instance, e.g. "F1a"
+   */
+  FunctionChain::FunctionId instance;
+
+  /** \brief number in the function name, e.g. 1 for "F1"; 0 if the name has no number
+   */
+  int functionNumber;
+
+  /** \brief index of the instance among instances of the same function, e.g. 0 for 'a'
+   */
+  int instanceIndex;
+
+  /** \brief instance number in ns3::SfcCounterStore, as given by ns3::ndn::SfcCatalog;
+   *         0 if the instance is not in the catalog
+   */
+  uint32_t counterIndex;
+};
+
+/** \brief function instances hosted on a forwarder
+ *
+ *  The registry is populated by scenarios (see ns3::ndn::FunctionHelper) and is looked up
+ *  by interned function identifier in constant time on every Interest and Data.
+ */
+class FunctionInstanceRegistry : noncopyable
+{
+public:
+  typedef std::deque<FunctionInstance>::const_iterator const_iterator;
+
+  /** \brief register instance \p instance of function \p function
+   *  \return the registered instance; an existing one if it was registered already
+   */
+  const FunctionInstance&
+  insert(const std::string& function, char instance);
+
+  /** \brief find an instance of \p function hosted on this forwarder
+   *  \return the first registered instance of the function, or nullptr
+   */
+  const FunctionInstance*
+  findByFunction(FunctionChain::FunctionId function) const
+  {
+    return function < m_byFunction.size() ? m_byFunction[function] : nullptr;
+  }
+
+  /** \brief find instance \p instance hosted on this forwarder
+   */
+  const FunctionInstance*
+  findByInstance(FunctionChain::FunctionId instance) const
+  {
+    return instance < m_byInstance.size() ? m_byInstance[instance] : nullptr;
+  }
+
+  /** \return whether any function instance is hosted on this forwarder
+   */
+  bool
+  empty() const
+  {
+    return m_instances.empty();
+  }
+
+  size_t
+  size() const
+  {
+    return m_instances.size();
+  }
+
+  const_iterator
+  begin() const
+  {
+    return m_instances.begin();
+  }
+
+  const_iterator
+  end() const
+  {
+    return m_instances.end();
+  }
+
+private:
+  std::deque<FunctionInstance> m_instances;
+  std::vector<const FunctionInstance*> m_byFunction;
+  std::vector<const FunctionInstance*> m_byInstance;
+};
+
+} // namespace fw
+} // namespace nfd
+
+#endif // NFD_DAEMON_FW_FUNCTION_INSTANCE_REGISTRY_HPP
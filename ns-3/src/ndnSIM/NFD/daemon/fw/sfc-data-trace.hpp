@@ -0,0 +1,70 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FW_SFC_DATA_TRACE_HPP
+#define NFD_DAEMON_FW_SFC_DATA_TRACE_HPP
+
+#include "core/common.hpp"
+
+namespace nfd {
+namespace fw {
+
+/** \brief SFC state of a Data received by a forwarder
+ *
+ *  Emitted by Forwarder::afterReceiveSfcData on every incoming Data, with the tags the Data
+ *  carried when it arrived.
+ */
+struct SfcDataTrace
+{
+  /** \brief ID of the ns-3 node of the forwarder
+   */
+  uint32_t nodeId;
+
+  /** \brief interned name of the function instance hosted on the forwarder, e.g. "F1a";
+   *         FunctionChain::INVALID_FUNCTION on a router
+   *
+   *  On a node hosting one instance, this is that instance. On a node hosting several, it is
+   *  the first hosted instance named by the FunctionNameTag of the Data, or INVALID_FUNCTION
+   *  if the Data names none of them.
+   */
+  FunctionChain::FunctionId instance;
+
+  /** \brief instance number of \ref instance in ns3::ndn::SfcCatalog; 0 without an instance
+   */
+  uint32_t counterIndex;
+
+  /** \brief function call count carried by the Data, or -1 without CountTag
+   */
+  int functionCount;
+
+  /** \brief hop count carried by the Data, or -1 without PartialHopTag
+   */
+  int hopCount;
+};
+
+} // namespace fw
+} // namespace nfd
+
+#endif // NFD_DAEMON_FW_SFC_DATA_TRACE_HPP
@@ -0,0 +1,99 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "sfc-feedback-aggregator.hpp"
+
+namespace nfd {
+namespace fw {
+
+SfcFeedbackAggregator::SfcFeedbackAggregator(Fib& fib)
+  : m_fib(fib)
+  , m_interval(time::nanoseconds::zero())
+{
+}
+
+void
+SfcFeedbackAggregator::setInterval(time::nanoseconds interval)
+{
+  BOOST_ASSERT(interval >= time::nanoseconds::zero());
+  this->flush();
+  m_interval = interval;
+}
+
+void
+SfcFeedbackAggregator::report(fib::EntryHandle instance, int fcc, int phc)
+{
+  ++m_counters.nReports;
+  Report report{instance, fcc, phc, time::steady_clock::now()};
+
+  if (m_interval == time::nanoseconds::zero()) {
+    this->apply(report);
+    return;
+  }
+
+  if (instance.getSlot() >= m_pendingIndex.size()) {
+    m_pendingIndex.resize(instance.getSlot() + 1, 0);
+  }
+  uint32_t& index = m_pendingIndex[instance.getSlot()];
+  if (index != 0) {
+    // the entry in this slot may have been replaced since; the latest report wins either way
+    ++m_counters.nCoalesced;
+    m_pending[index - 1] = report;
+    return;
+  }
+
+  if (m_pending.empty()) {
+    m_flushEvent = scheduler::schedule(m_interval, [this] { this->flush(); });
+  }
+  m_pending.push_back(report);
+  index = m_pending.size();
+}
+
+void
+SfcFeedbackAggregator::flush()
+{
+  m_flushEvent.cancel();
+  for (const Report& report : m_pending) {
+    this->apply(report);
+    m_pendingIndex[report.instance.getSlot()] = 0;
+  }
+  m_pending.clear();
+}
+
+void
+SfcFeedbackAggregator::apply(const Report& report)
+{
+  // the FIB entry may have been erased since the Interest was forwarded
+  fib::Entry* entry = m_fib.get(report.instance);
+  if (entry == nullptr) {
+    return;
+  }
+  entry->setFeedback(report.fcc, report.phc);
+  ++m_counters.nApplied;
+  m_counters.totalDelay += time::steady_clock::now() - report.time;
+}
+
+} // namespace fw
+} // namespace nfd
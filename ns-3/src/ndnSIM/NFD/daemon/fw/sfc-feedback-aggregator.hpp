@@ -0,0 +1,133 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FW_SFC_FEEDBACK_AGGREGATOR_HPP
+#define NFD_DAEMON_FW_SFC_FEEDBACK_AGGREGATOR_HPP
+
+#include "core/common.hpp"
+#include "core/scheduler.hpp"
+#include "table/fib.hpp"
+
+namespace nfd {
+namespace fw {
+
+/** \brief get a tag holding \p value, shared with other packets if \p value is small
+ *  \tparam T a SimpleTag of uint64_t, e.g. lp::CountTag
+ *
+ *  SimpleTag is immutable, so the tags of small values are allocated once and attached to
+ *  every packet carrying the same value, instead of allocating a tag per packet.
+ */
+template<typename T>
+shared_ptr<T>
+makeFeedbackTag(uint64_t value)
+{
+  static const size_t POOL_SIZE = 256;
+  static std::vector<shared_ptr<T>> pool(POOL_SIZE);
+
+  if (value >= POOL_SIZE) {
+    return make_shared<T>(value);
+  }
+  shared_ptr<T>& tag = pool[value];
+  if (tag == nullptr) {
+    tag = make_shared<T>(value);
+  }
+  return tag;
+}
+
+/** \brief coalesces the call count and hop count feedback carried by Data into FIB entries
+ *
+ *  With a zero interval, every report is applied to its FIB entry immediately. Otherwise,
+ *  reports are held for up to the interval and applied in one pass, and only the latest
+ *  report of each instance is applied, so the interval sets the staleness of the costs seen
+ *  by Fib::selectFunction.
+ */
+class SfcFeedbackAggregator : noncopyable
+{
+public:
+  struct Counters
+  {
+    uint64_t nReports = 0;   ///< reports received
+    uint64_t nCoalesced = 0; ///< reports replaced by a later report before being applied
+    uint64_t nApplied = 0;   ///< reports applied to an existing FIB entry
+    time::nanoseconds totalDelay = time::nanoseconds::zero(); ///< sum of the delays of applied reports
+  };
+
+  explicit
+  SfcFeedbackAggregator(Fib& fib);
+
+  /** \brief set the longest time a report is held before being applied
+   *
+   *  Pending reports are applied before the interval changes.
+   */
+  void
+  setInterval(time::nanoseconds interval);
+
+  time::nanoseconds
+  getInterval() const
+  {
+    return m_interval;
+  }
+
+  /** \brief report call count \p fcc and partial hop count \p phc of \p instance
+   */
+  void
+  report(fib::EntryHandle instance, int fcc, int phc);
+
+  /** \brief apply all pending reports
+   */
+  void
+  flush();
+
+  const Counters&
+  getCounters() const
+  {
+    return m_counters;
+  }
+
+private:
+  struct Report
+  {
+    fib::EntryHandle instance;
+    int fcc;
+    int phc;
+    time::steady_clock::TimePoint time;
+  };
+
+  void
+  apply(const Report& report);
+
+private:
+  Fib& m_fib;
+  time::nanoseconds m_interval;
+  std::vector<Report> m_pending;
+  std::vector<uint32_t> m_pendingIndex; // index in m_pending plus one, by handle slot
+  scheduler::ScopedEventId m_flushEvent;
+  Counters m_counters;
+};
+
+} // namespace fw
+} // namespace nfd
+
+#endif // NFD_DAEMON_FW_SFC_FEEDBACK_AGGREGATOR_HPP
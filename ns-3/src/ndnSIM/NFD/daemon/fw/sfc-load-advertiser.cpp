@@ -0,0 +1,169 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "sfc-load-advertiser.hpp"
+#include "forwarder.hpp"
+#include "core/logger.hpp"
+#include "core/random.hpp"
+
+namespace nfd {
+namespace fw {
+
+NFD_LOG_INIT("SfcLoadAdvertiser");
+
+const Name SfcLoadAdvertiser::PREFIX("/localhop/sfc-load");
+
+// name components after PREFIX
+enum {
+  INSTANCE,
+  SEQUENCE,
+  CALL_COUNT,
+  HOPS,
+  TTL,
+  N_COMPONENTS
+};
+
+SfcLoadAdvertiser::SfcLoadAdvertiser(Forwarder& forwarder)
+  : m_forwarder(forwarder)
+  , m_period(time::nanoseconds::zero())
+  , m_ttl(0)
+  , m_lastSequence(0)
+{
+}
+
+void
+SfcLoadAdvertiser::enable(time::nanoseconds period, uint32_t ttl)
+{
+  BOOST_ASSERT(period >= time::nanoseconds::zero());
+  m_period = period;
+  m_ttl = ttl;
+
+  m_advertiseEvent.cancel();
+  if (m_period > time::nanoseconds::zero()) {
+    // random phase, so that function nodes do not advertise at the same time
+    std::uniform_int_distribution<time::nanoseconds::rep> phase(0, m_period.count() - 1);
+    m_advertiseEvent = scheduler::schedule(time::nanoseconds(phase(getGlobalRng())),
+                                           [this] { this->advertise(); });
+  }
+}
+
+void
+SfcLoadAdvertiser::advertise()
+{
+  m_advertiseEvent = scheduler::schedule(m_period, [this] { this->advertise(); });
+  if (m_ttl == 0) {
+    return;
+  }
+
+  uint64_t callCount = std::max(m_forwarder.getFib().getFcc(), 0);
+  ++m_lastSequence;
+  for (const FunctionInstance& instance : m_forwarder.getFunctionInstanceRegistry()) {
+    Name name(PREFIX);
+    name.append(FunctionChain::toString(instance.instance))
+        .appendNumber(m_lastSequence)
+        .appendNumber(callCount)
+        .appendNumber(0)
+        .appendNumber(m_ttl);
+    this->isNew(name.get(PREFIX.size() + INSTANCE), m_lastSequence);
+
+    Interest interest(name);
+    ++m_counters.nOriginated;
+    this->send(interest, nullptr);
+  }
+}
+
+void
+SfcLoadAdvertiser::onAdvertisement(const Face& inFace, const Interest& interest)
+{
+  ++m_counters.nReceived;
+
+  const Name& name = interest.getName();
+  if (name.size() != PREFIX.size() + N_COMPONENTS) {
+    NFD_LOG_DEBUG("onAdvertisement face=" << inFace.getId() << " name=" << name << " malformed");
+    return;
+  }
+
+  const Name::Component& instance = name.get(PREFIX.size() + INSTANCE);
+  uint64_t sequence, callCount, hops, ttl;
+  try {
+    sequence = name.get(PREFIX.size() + SEQUENCE).toNumber();
+    callCount = name.get(PREFIX.size() + CALL_COUNT).toNumber();
+    hops = name.get(PREFIX.size() + HOPS).toNumber();
+    ttl = name.get(PREFIX.size() + TTL).toNumber();
+  }
+  catch (const tlv::Error&) {
+    NFD_LOG_DEBUG("onAdvertisement face=" << inFace.getId() << " name=" << name << " malformed");
+    return;
+  }
+
+  if (!this->isNew(instance, sequence)) {
+    ++m_counters.nDuplicates;
+    return;
+  }
+
+  Fib& fib = m_forwarder.getFib();
+  fib::Entry* entry = fib.findExactMatch(Name().append(instance));
+  if (entry != nullptr) {
+    ++m_counters.nApplied;
+    m_forwarder.getSfcFeedbackAggregator().report(fib.getHandle(*entry),
+                                                  static_cast<int>(callCount),
+                                                  static_cast<int>(hops));
+  }
+
+  if (hops + 1 < ttl) {
+    Name relayName = name.getPrefix(PREFIX.size() + HOPS);
+    relayName.appendNumber(hops + 1).appendNumber(ttl);
+    this->send(Interest(relayName), &inFace);
+  }
+}
+
+void
+SfcLoadAdvertiser::send(const Interest& interest, const Face* inFace)
+{
+  size_t wireSize = interest.wireEncode().size();
+  for (Face& face : m_forwarder.getFaceTable()) {
+    if (&face == inFace || face.getId() <= face::FACEID_RESERVED_MAX ||
+        face.getScope() != ndn::nfd::FACE_SCOPE_NON_LOCAL) {
+      continue;
+    }
+    face.sendInterest(interest);
+    ++m_counters.nSent;
+    m_counters.nSentBytes += wireSize;
+  }
+}
+
+bool
+SfcLoadAdvertiser::isNew(const Name::Component& instance, uint64_t sequence)
+{
+  auto lastSeen = m_lastSeen.find(instance);
+  if (lastSeen != m_lastSeen.end() && lastSeen->second >= sequence) {
+    return false;
+  }
+  m_lastSeen[instance] = sequence;
+  return true;
+}
+
+} // namespace fw
+} // namespace nfd
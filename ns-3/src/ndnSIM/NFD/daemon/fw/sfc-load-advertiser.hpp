@@ -0,0 +1,132 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FW_SFC_LOAD_ADVERTISER_HPP
+#define NFD_DAEMON_FW_SFC_LOAD_ADVERTISER_HPP
+
+#include "core/common.hpp"
+#include "core/scheduler.hpp"
+#include "face/face.hpp"
+
+namespace nfd {
+
+class Forwarder;
+
+namespace fw {
+
+/** \brief advertises the call load of hosted function instances to nearby routers
+ *
+ *  Without advertisements, a router learns the cost of an instance only from Data returning
+ *  through it, so routers away from active flows keep stale costs. When enabled on a node
+ *  hosting function instances, the advertiser periodically floods a control Interest per
+ *  instance named
+ *
+ *      /localhop/sfc-load/<instance>/<sequence>/<call count>/<hops>/<TTL>
+ *
+ *  over all non-local faces. Every forwarder handles these Interests outside the forwarding
+ *  pipelines: it applies the call count and hop count of the first copy of each sequence to
+ *  the FIB entry of the instance through the SfcFeedbackAggregator, and relays the copy with
+ *  one more hop until TTL hops are reached. The hop count has the meaning of PartialHopTag:
+ *  0 at the routers adjacent to the function node.
+ */
+class SfcLoadAdvertiser : noncopyable
+{
+public:
+  struct Counters
+  {
+    uint64_t nOriginated = 0; ///< advertisements created by this node
+    uint64_t nSent = 0;       ///< advertisements sent, including relayed ones
+    uint64_t nSentBytes = 0;  ///< wire size of sent advertisements
+    uint64_t nReceived = 0;   ///< advertisements received
+    uint64_t nDuplicates = 0; ///< received advertisements with a sequence seen before
+    uint64_t nApplied = 0;    ///< received advertisements of an instance in the FIB
+  };
+
+  /** \brief name prefix of advertisements
+   */
+  static const Name PREFIX;
+
+  explicit
+  SfcLoadAdvertiser(Forwarder& forwarder);
+
+  /** \brief advertise the hosted instances every \p period, up to \p ttl hops away
+   *
+   *  A zero period, the default, stops advertising. Advertisements received from other nodes
+   *  are always applied and relayed.
+   */
+  void
+  enable(time::nanoseconds period, uint32_t ttl);
+
+  time::nanoseconds
+  getPeriod() const
+  {
+    return m_period;
+  }
+
+  /** \return whether \p interest is an advertisement
+   */
+  static bool
+  isAdvertisement(const Interest& interest)
+  {
+    return PREFIX.isPrefixOf(interest.getName());
+  }
+
+  /** \brief apply and relay advertisement \p interest received on \p inFace
+   */
+  void
+  onAdvertisement(const Face& inFace, const Interest& interest);
+
+  const Counters&
+  getCounters() const
+  {
+    return m_counters;
+  }
+
+private:
+  void
+  advertise();
+
+  void
+  send(const Interest& interest, const Face* inFace);
+
+  /** \return whether \p sequence of \p instance has not been seen before, recording it if so
+   */
+  bool
+  isNew(const Name::Component& instance, uint64_t sequence);
+
+private:
+  Forwarder& m_forwarder;
+  time::nanoseconds m_period;
+  uint32_t m_ttl;
+  uint64_t m_lastSequence;
+  std::map<Name::Component, uint64_t> m_lastSeen; // latest sequence, by instance
+  scheduler::ScopedEventId m_advertiseEvent;
+  Counters m_counters;
+};
+
+} // namespace fw
+} // namespace nfd
+
+#endif // NFD_DAEMON_FW_SFC_LOAD_ADVERTISER_HPP
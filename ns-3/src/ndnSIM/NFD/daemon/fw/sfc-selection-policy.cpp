@@ -0,0 +1,392 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "sfc-selection-policy.hpp"
+#include "forwarder.hpp"
+#include "core/logger.hpp"
+#include "ns3/simulator.h"
+#include "ns3/ndnSIM/utils/ndn-sfc-catalog.hpp"
+#include <ndn-cxx/lp/tags.hpp>
+
+#include <cmath>
+#include <limits>
+
+namespace nfd {
+namespace fw {
+
+NFD_LOG_INIT("SfcSelectionPolicy");
+
+SfcSelectionPolicy::SfcSelectionPolicy(Forwarder& forwarder)
+  : m_forwarder(forwarder)
+{
+}
+
+SfcSelectionPolicy::Registry&
+SfcSelectionPolicy::getRegistry()
+{
+  static Registry registry;
+  return registry;
+}
+
+unique_ptr<SfcSelectionPolicy>
+SfcSelectionPolicy::create(const std::string& key, Forwarder& forwarder)
+{
+  Registry& registry = getRegistry();
+  auto i = registry.find(key);
+  return i == registry.end() ? nullptr : i->second(forwarder);
+}
+
+bool
+SfcSelectionPolicy::isRegistered(const std::string& key)
+{
+  return getRegistry().count(key) > 0;
+}
+
+bool
+SfcSelectionPolicy::isEndpointNode() const
+{
+  return m_forwarder.getNode() != nullptr && m_forwarder.getNode()->GetNApplications() != 0;
+}
+
+const FunctionInstance*
+SfcSelectionPolicy::findLocalInstance(const FunctionChain& chain) const
+{
+  return m_forwarder.getFunctionInstanceRegistry().findByInstance(chain.getHead());
+}
+
+void
+SfcSelectionPolicy::afterReceiveInterestAtFunction(const FunctionInstance& instance,
+                                                   const Interest& interest)
+{
+  interest.removeHeadFunction(interest);
+  interest.setFunctionFlag(1);
+}
+
+fib::Entry*
+SfcSelectionPolicy::chooseNextInstance(const Interest& interest, pit::Entry& pitEntry)
+{
+  return m_forwarder.getFib().findLongestPrefixMatchFunction(interest.getFunction());
+}
+
+bool
+SfcSelectionPolicy::canSatisfy(const Interest& interest, const Data& data) const
+{
+  return true;
+}
+
+void
+SfcSelectionPolicy::afterReceiveDataAtFunction(const Data& data,
+                                               const pit::DataMatchResult& pitMatches)
+{
+}
+
+void
+SfcSelectionPolicy::afterReceiveDataAtRouter(const Data& data,
+                                             const pit::DataMatchResult& pitMatches)
+{
+}
+
+void
+SfcSelectionPolicy::beforeExpressInterest(Interest& interest) const
+{
+}
+
+void
+SfcSelectionPolicy::beforeSendData(const Interest& interest, Data& data) const
+{
+}
+
+NFD_REGISTER_SFC_SELECTION_POLICY(SiraiwaNdnSfcSelectionPolicy, "siraiwa-ndn");
+
+void
+SiraiwaNdnSfcSelectionPolicy::afterReceiveInterestAtFunction(const FunctionInstance& instance,
+                                                             const Interest& interest)
+{
+  SfcSelectionPolicy::afterReceiveInterestAtFunction(instance, interest);
+
+  ns3::increaseAllFcc();
+  if (ns3::getAllFcc() == 30) {
+    ns3::resetFcc();
+  }
+}
+
+NFD_REGISTER_SFC_SELECTION_POLICY(RoundRobinSfcSelectionPolicy, "round-robin");
+
+NFD_REGISTER_SFC_SELECTION_POLICY(RandChoiceSfcSelectionPolicy, "rand-choice");
+
+NFD_REGISTER_SFC_SELECTION_POLICY(DurationSfcSelectionPolicy, "duration");
+
+std::string
+DurationSfcSelectionPolicy::selectInstance(FunctionChain::FunctionId function)
+{
+  ns3::Ptr<ns3::ndn::SfcCatalog> catalog = ns3::ndn::SfcCatalog::Get();
+  int index = catalog->FindFunction(FunctionChain::toString(function));
+  if (index < 0) {
+    return "";
+  }
+  const ns3::ndn::SfcCatalog::Function& fn = catalog->GetFunction(index);
+
+  // the first instance with the smallest call count; function nodes learn no hop counts
+  size_t selected = 0;
+  int bestCost = std::numeric_limits<int>::max();
+  for (size_t i = 0; i < fn.instances.size(); ++i) {
+    int cost = getCount(fn.firstCounterIndex + i);
+    if (cost < bestCost) {
+      bestCost = cost;
+      selected = i;
+    }
+  }
+  getCount(fn.firstCounterIndex + selected) += ns3::getWeight();
+  return fn.instances[selected];
+}
+
+int&
+DurationSfcSelectionPolicy::getCount(uint32_t counterIndex)
+{
+  BOOST_ASSERT(counterIndex > 0);
+  if (m_counts.size() < counterIndex) {
+    m_counts.resize(counterIndex, 0);
+  }
+  return m_counts[counterIndex - 1];
+}
+
+fib::LoadEstimator&
+DurationSfcSelectionPolicy::getLoad(uint32_t counterIndex)
+{
+  BOOST_ASSERT(counterIndex > 0);
+  if (m_loads.size() < counterIndex) {
+    m_loads.resize(counterIndex);
+  }
+  unique_ptr<fib::LoadEstimator>& load = m_loads[counterIndex - 1];
+  if (load == nullptr) {
+    load = getForwarder().getFib().getLoadEstimator().makeEmpty();
+  }
+  return *load;
+}
+
+void
+DurationSfcSelectionPolicy::afterReceiveInterestAtFunction(const FunctionInstance& instance,
+                                                           const Interest& interest)
+{
+  SfcSelectionPolicy::afterReceiveInterestAtFunction(instance, interest);
+
+  // the call count of the local instance is its own current load
+  if (instance.counterIndex != 0) {
+    fib::LoadEstimator& load = this->getLoad(instance.counterIndex);
+    time::steady_clock::TimePoint now = time::steady_clock::now();
+    load.add(now, ns3::getWeight());
+    getCount(instance.counterIndex) = static_cast<int>(std::lround(load.get(now)));
+  }
+
+  // the head function has been removed, so select an instance of the next one
+  const FunctionChain& chain = interest.getFunctionChain();
+  if (chain.empty()) {
+    return;
+  }
+  std::string nextInstance = this->selectInstance(chain.getHead());
+  if (nextInstance.empty()) {
+    NFD_LOG_DEBUG("afterReceiveInterestAtFunction unknown-function=" << chain.getHeadComponent());
+    return;
+  }
+  FunctionChain::FunctionId nextInstanceId = FunctionChain::intern(nextInstance);
+  interest.replaceHeadFunction(nextInstanceId);
+  interest.addFunctionFullName(nextInstanceId);
+}
+
+void
+DurationSfcSelectionPolicy::afterReceiveDataAtFunction(const Data& data,
+                                                       const pit::DataMatchResult& pitMatches)
+{
+  if (data.getTag<lp::FunctionNameTag>() == nullptr || this->isEndpointNode()) {
+    return;
+  }
+
+  // the function sequence in Data is handled in reverse order of the Interest
+  Name funcName = *data.getTag<lp::FunctionNameTag>();
+  if (data.getTag<lp::PartialHopTag>() != nullptr) {
+    funcName = funcName.getSubName(1);
+  }
+
+  const FunctionInstance& localInstance = *getForwarder().getFunctionInstanceRegistry().begin();
+  data.setTag<lp::FunctionNameTag>(make_shared<lp::FunctionNameTag>(funcName));
+  data.setTag<lp::PartialHopTag>(makeFeedbackTag<lp::PartialHopTag>(0));
+  data.setTag<lp::CountTag>(makeFeedbackTag<lp::CountTag>(localInstance.counterIndex != 0 ?
+      getCount(localInstance.counterIndex) : 0));
+}
+
+void
+DurationSfcSelectionPolicy::afterReceiveDataAtRouter(const Data& data,
+                                                     const pit::DataMatchResult& pitMatches)
+{
+  if (data.getTag<lp::FunctionNameTag>() == nullptr || this->isEndpointNode()) {
+    return;
+  }
+
+  shared_ptr<lp::PartialHopTag> hopTag = data.getTag<lp::PartialHopTag>();
+  if (hopTag != nullptr) {
+    data.setTag<lp::PartialHopTag>(makeFeedbackTag<lp::PartialHopTag>(*hopTag + 1));
+  }
+}
+
+void
+DurationSfcSelectionPolicy::beforeExpressInterest(Interest& interest) const
+{
+  // the consumer has already selected the first instance
+  interest.setFunctionFullName(interest.getFunction().getPrefix(1));
+}
+
+void
+DurationSfcSelectionPolicy::beforeSendData(const Interest& interest, Data& data) const
+{
+  data.setTag<lp::FunctionNameTag>(make_shared<lp::FunctionNameTag>(interest.getFunctionFullName()));
+  data.setTag<lp::PartialHopTag>(nullptr);
+  data.setTag<lp::CountTag>(nullptr);
+  data.setTag<lp::PreviousFunctionTag>(make_shared<lp::PreviousFunctionTag>(Name("")));
+}
+
+NFD_REGISTER_SFC_SELECTION_POLICY(FibControlSfcSelectionPolicy, "fib-control");
+
+const FunctionInstance*
+FibControlSfcSelectionPolicy::findLocalInstance(const FunctionChain& chain) const
+{
+  // the head is a function; the instance has been selected through the FIB
+  return getForwarder().getFunctionInstanceRegistry().findByFunction(chain.getHead());
+}
+
+void
+FibControlSfcSelectionPolicy::afterReceiveInterestAtFunction(const FunctionInstance& instance,
+                                                             const Interest& interest)
+{
+  SfcSelectionPolicy::afterReceiveInterestAtFunction(instance, interest);
+
+  getForwarder().getFib().increaseFcc();
+
+  // the head function has been removed, so mark the next one for instance selection
+  const FunctionChain& chain = interest.getFunctionChain();
+  if (!chain.empty()) {
+    interest.replaceHeadFunction(FunctionChain::mark(chain.getHead()));
+  }
+}
+
+fib::Entry*
+FibControlSfcSelectionPolicy::chooseNextInstance(const Interest& interest, pit::Entry& pitEntry)
+{
+  Fib& fib = getForwarder().getFib();
+
+  FunctionChain::FunctionId function = FunctionChain::unmark(interest.getFunctionChain().getHead());
+  if (function == FunctionChain::INVALID_FUNCTION) {
+    // the instance has been selected upstream
+    return fib.findLongestPrefixMatchFunction(interest.getFunctionNextName());
+  }
+
+  // instance of this function is selected here
+  interest.replaceHeadFunction(function);
+  fib::Entry* fibEntry = fib.selectFunction(function, interest.getName());
+  if (fibEntry == nullptr) {
+    NFD_LOG_DEBUG("chooseNextInstance no-instance=" << FunctionChain::getComponent(function));
+    return nullptr;
+  }
+  pitEntry.setSelectedInstance(fib.getHandle(*fibEntry));
+  interest.setFunctionNextName(fibEntry->getPrefix());
+  interest.addFunctionFullName(fibEntry->getPrefix());
+  return fibEntry;
+}
+
+bool
+FibControlSfcSelectionPolicy::canSatisfy(const Interest& interest, const Data& data) const
+{
+  shared_ptr<lp::FunctionNameTag> funcNameTag = data.getTag<lp::FunctionNameTag>();
+  return funcNameTag == nullptr || interest.getFunction() == *funcNameTag;
+}
+
+void
+FibControlSfcSelectionPolicy::updateSelectedInstance(const Data& data,
+                                                     const pit::DataMatchResult& pitMatches)
+{
+  shared_ptr<lp::PartialHopTag> hopTag = data.getTag<lp::PartialHopTag>();
+  shared_ptr<lp::CountTag> countTag = data.getTag<lp::CountTag>();
+  if (pitMatches.empty() || hopTag == nullptr || countTag == nullptr) {
+    return;
+  }
+
+  getForwarder().getSfcFeedbackAggregator().report(pitMatches.front()->getSelectedInstance(),
+                                                   *countTag, *hopTag);
+}
+
+void
+FibControlSfcSelectionPolicy::afterReceiveDataAtFunction(const Data& data,
+                                                         const pit::DataMatchResult& pitMatches)
+{
+  this->updateSelectedInstance(data, pitMatches);
+  if (pitMatches.empty()) {
+    return;
+  }
+
+  data.setTag<lp::CountTag>(makeFeedbackTag<lp::CountTag>(getForwarder().getFib().getFcc()));
+  data.setTag<lp::PartialHopTag>(makeFeedbackTag<lp::PartialHopTag>(0));
+}
+
+void
+FibControlSfcSelectionPolicy::afterReceiveDataAtRouter(const Data& data,
+                                                       const pit::DataMatchResult& pitMatches)
+{
+  this->updateSelectedInstance(data, pitMatches);
+  if (pitMatches.empty()) {
+    return;
+  }
+
+  shared_ptr<lp::PartialHopTag> hopTag = data.getTag<lp::PartialHopTag>();
+  if (hopTag != nullptr) {
+    data.setTag<lp::PartialHopTag>(makeFeedbackTag<lp::PartialHopTag>(*hopTag + 1));
+  }
+}
+
+void
+FibControlSfcSelectionPolicy::beforeSendData(const Interest& interest, Data& data) const
+{
+  data.setTag<lp::FunctionNameTag>(nullptr);
+  data.setTag<lp::PartialHopTag>(nullptr);
+  data.setTag<lp::CountTag>(nullptr);
+}
+
+unique_ptr<SfcSelectionPolicy>
+makeDefaultSfcSelectionPolicy(Forwarder& forwarder)
+{
+  switch (ns3::getChoiceType()) {
+    case 1:
+      return make_unique<RoundRobinSfcSelectionPolicy>(forwarder);
+    case 2:
+      return make_unique<DurationSfcSelectionPolicy>(forwarder);
+    case 3:
+      return make_unique<RandChoiceSfcSelectionPolicy>(forwarder);
+    case 4:
+      return make_unique<FibControlSfcSelectionPolicy>(forwarder);
+    default:
+      return make_unique<SiraiwaNdnSfcSelectionPolicy>(forwarder);
+  }
+}
+
+} // namespace fw
+} // namespace nfd
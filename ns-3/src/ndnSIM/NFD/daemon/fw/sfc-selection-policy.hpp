@@ -0,0 +1,294 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_FW_SFC_SELECTION_POLICY_HPP
+#define NFD_DAEMON_FW_SFC_SELECTION_POLICY_HPP
+
+#include "function-instance-registry.hpp"
+#include "sfc-feedback-aggregator.hpp"
+#include "table/fib-entry.hpp"
+#include "table/fib-load-estimator.hpp"
+#include "table/pit.hpp"
+
+namespace nfd {
+
+class Forwarder;
+
+namespace fw {
+
+/** \brief determines how service function instances are selected
+ *
+ *  An SfcSelectionPolicy is attached to each forwarder. The forwarding pipelines call its
+ *  triggers when an Interest reaches a node hosting the head function of its chain, when
+ *  an Interest carrying a function chain is forwarded, and when Data travels back along
+ *  the chain. Consumer and producer applications call the endpoint triggers of the policy
+ *  installed on their own node.
+ */
+class SfcSelectionPolicy : noncopyable
+{
+public:
+  explicit
+  SfcSelectionPolicy(Forwarder& forwarder);
+
+  virtual
+  ~SfcSelectionPolicy() = default;
+
+public: // triggers at forwarders
+  /** \brief find the function instance on this node that processes the head of \p chain
+   *  \return the hosted instance, or nullptr if this node does not process the head function
+   *
+   *  The default implementation expects the head to name a specific instance, e.g. "F1a".
+   */
+  virtual const FunctionInstance*
+  findLocalInstance(const FunctionChain& chain) const;
+
+  /** \brief trigger after an Interest is received at a node hosting the head function
+   *  \param instance the hosted instance that processes the Interest
+   *
+   *  The policy must remove the processed function from the chain of \p interest.
+   *  The default implementation removes it and marks the Interest as processed.
+   */
+  virtual void
+  afterReceiveInterestAtFunction(const FunctionInstance& instance, const Interest& interest);
+
+  /** \brief choose the FIB entry toward the next function instance
+   *  \param interest an Interest whose function chain is not empty
+   *  \return the FIB entry to forward \p interest with, or nullptr to fall back to the strategy
+   *
+   *  The default implementation performs a longest prefix match on the function chain.
+   */
+  virtual fib::Entry*
+  chooseNextInstance(const Interest& interest, pit::Entry& pitEntry);
+
+  /** \brief whether \p data can satisfy \p interest, in addition to Interest::matchesData
+   */
+  virtual bool
+  canSatisfy(const Interest& interest, const Data& data) const;
+
+  /** \brief trigger after Data is received at a node hosting function instances
+   *  \param pitMatches PIT entries satisfied by \p data
+   */
+  virtual void
+  afterReceiveDataAtFunction(const Data& data, const pit::DataMatchResult& pitMatches);
+
+  /** \brief trigger after Data is received at a node without function instances
+   *  \param pitMatches PIT entries satisfied by \p data
+   */
+  virtual void
+  afterReceiveDataAtRouter(const Data& data, const pit::DataMatchResult& pitMatches);
+
+public: // triggers at applications
+  /** \brief trigger before a consumer expresses \p interest
+   */
+  virtual void
+  beforeExpressInterest(Interest& interest) const;
+
+  /** \brief trigger before a producer answers \p interest with \p data
+   */
+  virtual void
+  beforeSendData(const Interest& interest, Data& data) const;
+
+public: // registry
+  template<typename P>
+  static void
+  registerPolicy(const std::string& key)
+  {
+    Registry& registry = getRegistry();
+    BOOST_ASSERT(registry.count(key) == 0);
+    registry[key] = [] (Forwarder& forwarder) { return make_unique<P>(ref(forwarder)); };
+  }
+
+  /** \return an SfcSelectionPolicy identified by \p key, or nullptr if \p key is unknown
+   */
+  static unique_ptr<SfcSelectionPolicy>
+  create(const std::string& key, Forwarder& forwarder);
+
+  /** \return whether a policy identified by \p key is registered
+   */
+  static bool
+  isRegistered(const std::string& key);
+
+protected:
+  Forwarder&
+  getForwarder() const
+  {
+    return m_forwarder;
+  }
+
+  /** \return whether this node runs consumer or producer applications
+   */
+  bool
+  isEndpointNode() const;
+
+private:
+  typedef std::function<unique_ptr<SfcSelectionPolicy>(Forwarder&)> CreateFunc;
+  typedef std::map<std::string, CreateFunc> Registry; // indexed by key
+
+  static Registry&
+  getRegistry();
+
+private:
+  Forwarder& m_forwarder;
+};
+
+/** \brief siraiwaNDN: the consumer source-routes every Interest through specific instances
+ */
+class SiraiwaNdnSfcSelectionPolicy : public SfcSelectionPolicy
+{
+public:
+  using SfcSelectionPolicy::SfcSelectionPolicy;
+
+  void
+  afterReceiveInterestAtFunction(const FunctionInstance& instance, const Interest& interest) final;
+};
+
+/** \brief roundRobin: the consumer assigns instances in turn
+ */
+class RoundRobinSfcSelectionPolicy : public SfcSelectionPolicy
+{
+public:
+  using SfcSelectionPolicy::SfcSelectionPolicy;
+};
+
+/** \brief randChoice: the consumer assigns instances at random
+ */
+class RandChoiceSfcSelectionPolicy : public SfcSelectionPolicy
+{
+public:
+  using SfcSelectionPolicy::SfcSelectionPolicy;
+};
+
+/** \brief duration: each function node picks the next instance by hop count plus function
+ *         call count, learned from tags carried by Data
+ */
+class DurationSfcSelectionPolicy : public SfcSelectionPolicy
+{
+public:
+  using SfcSelectionPolicy::SfcSelectionPolicy;
+
+  void
+  afterReceiveInterestAtFunction(const FunctionInstance& instance, const Interest& interest) final;
+
+  void
+  afterReceiveDataAtFunction(const Data& data, const pit::DataMatchResult& pitMatches) final;
+
+  void
+  afterReceiveDataAtRouter(const Data& data, const pit::DataMatchResult& pitMatches) final;
+
+  void
+  beforeExpressInterest(Interest& interest) const final;
+
+  void
+  beforeSendData(const Interest& interest, Data& data) const final;
+
+private:
+  /** \brief select the instance of \p function with the smallest call count
+   *  \return the selected instance, e.g. "F1b", or an empty string if \p function is unknown
+   */
+  std::string
+  selectInstance(FunctionChain::FunctionId function);
+
+  /** \return the function call count of instance number \p counterIndex, see ns3::ndn::SfcCatalog
+   */
+  int&
+  getCount(uint32_t counterIndex);
+
+  /** \return the call load of instance number \p counterIndex
+   *
+   *  The estimator is created on first use, of the same kind as the node's estimator in FIB.
+   */
+  fib::LoadEstimator&
+  getLoad(uint32_t counterIndex);
+
+private:
+  /** \brief function call count of every instance, by instance number - 1
+   */
+  std::vector<int> m_counts;
+
+  /** \brief call load of every local instance, by instance number - 1
+   */
+  std::vector<unique_ptr<fib::LoadEstimator>> m_loads;
+};
+
+/** \brief fibControl: the node that processed a function picks the next instance from FIB
+ *         entries annotated with call count and hop count learned from Data
+ */
+class FibControlSfcSelectionPolicy : public SfcSelectionPolicy
+{
+public:
+  using SfcSelectionPolicy::SfcSelectionPolicy;
+
+  const FunctionInstance*
+  findLocalInstance(const FunctionChain& chain) const final;
+
+  void
+  afterReceiveInterestAtFunction(const FunctionInstance& instance, const Interest& interest) final;
+
+  fib::Entry*
+  chooseNextInstance(const Interest& interest, pit::Entry& pitEntry) final;
+
+  bool
+  canSatisfy(const Interest& interest, const Data& data) const final;
+
+  void
+  afterReceiveDataAtFunction(const Data& data, const pit::DataMatchResult& pitMatches) final;
+
+  void
+  afterReceiveDataAtRouter(const Data& data, const pit::DataMatchResult& pitMatches) final;
+
+  void
+  beforeSendData(const Interest& interest, Data& data) const final;
+
+private:
+  /** \brief update the instance selected by the first PIT entry with the tags of \p data
+   */
+  void
+  updateSelectedInstance(const Data& data, const pit::DataMatchResult& pitMatches);
+};
+
+/** \return the policy selected by ns3::setChoiceType, used by forwarders without an
+ *          explicitly installed policy
+ */
+unique_ptr<SfcSelectionPolicy>
+makeDefaultSfcSelectionPolicy(Forwarder& forwarder);
+
+} // namespace fw
+} // namespace nfd
+
+/** \brief registers an SFC instance selection policy
+ *  \param P a subclass of nfd::fw::SfcSelectionPolicy
+ *  \param key the policy keyword, which is available for selection in SfcSelectionPolicyHelper
+ */
+#define NFD_REGISTER_SFC_SELECTION_POLICY(P, key)                \
+static class NfdAuto ## P ## SfcSelectionPolicyRegistrationClass \
+{                                                                \
+public:                                                          \
+  NfdAuto ## P ## SfcSelectionPolicyRegistrationClass()          \
+  {                                                              \
+    ::nfd::fw::SfcSelectionPolicy::registerPolicy<P>(key);       \
+  }                                                              \
+} g_nfdAuto ## P ## SfcSelectionPolicyRegistrationVariable
+
+#endif // NFD_DAEMON_FW_SFC_SELECTION_POLICY_HPP
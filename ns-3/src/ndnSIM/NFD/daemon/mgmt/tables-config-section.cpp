@@ -51,6 +51,9 @@ TablesConfigSection::ensureConfigured()
 
   m_forwarder.getCs().setLimit(DEFAULT_CS_MAX_PACKETS);
   m_forwarder.setUnsolicitedDataPolicy(make_unique<fw::DefaultUnsolicitedDataPolicy>());
+  m_forwarder.setStragglerTime(Forwarder::DEFAULT_STRAGGLER_TIME);
+  m_forwarder.setFinalizeWhenServed(false);
+  m_forwarder.getPit().setArenaEnabled(false);
 
   m_isConfigured = true;
 }
@@ -80,6 +83,26 @@ TablesConfigSection::processConfig(const ConfigSection& section, bool isDryRun)
     unsolicitedDataPolicy = make_unique<fw::DefaultUnsolicitedDataPolicy>();
   }
 
+  time::milliseconds stragglerTime = Forwarder::DEFAULT_STRAGGLER_TIME;
+  OptionalNode stragglerTimeNode = section.get_child_optional("pit_straggler_time");
+  if (stragglerTimeNode) {
+    stragglerTime = time::milliseconds(
+      ConfigFile::parseNumber<uint64_t>(*stragglerTimeNode, "pit_straggler_time", "tables"));
+  }
+
+  bool shouldFinalizeWhenServed = false;
+  OptionalNode finalizeWhenServedNode = section.get_child_optional("pit_finalize_when_served");
+  if (finalizeWhenServedNode) {
+    shouldFinalizeWhenServed = ConfigFile::parseYesNo(*finalizeWhenServedNode,
+                                                      "pit_finalize_when_served", "tables");
+  }
+
+  bool isPitArenaEnabled = false;
+  OptionalNode pitArenaNode = section.get_child_optional("pit_arena");
+  if (pitArenaNode) {
+    isPitArenaEnabled = ConfigFile::parseYesNo(*pitArenaNode, "pit_arena", "tables");
+  }
+
   OptionalNode strategyChoiceSection = section.get_child_optional("strategy_choice");
   if (strategyChoiceSection) {
     processStrategyChoiceSection(*strategyChoiceSection, isDryRun);
@@ -98,6 +121,10 @@ TablesConfigSection::processConfig(const ConfigSection& section, bool isDryRun)
 
   m_forwarder.setUnsolicitedDataPolicy(std::move(unsolicitedDataPolicy));
 
+  m_forwarder.setStragglerTime(stragglerTime);
+  m_forwarder.setFinalizeWhenServed(shouldFinalizeWhenServed);
+  m_forwarder.getPit().setArenaEnabled(isPitArenaEnabled);
+
   m_isConfigured = true;
 }
 
@@ -41,6 +41,10 @@ namespace nfd {
  *
  *    cs_unsolicited_policy drop-all
  *
+ *    pit_straggler_time 100
+ *    pit_finalize_when_served yes
+ *    pit_arena yes
+ *
  *    strategy_choice
  *    {
  *      /               /localhost/nfd/strategy/best-route
@@ -58,8 +62,9 @@ namespace nfd {
  *  \endcode
  *
  *  During a configuration reload,
- *  \li cs_max_packets and cs_unsolicited_policy are applied;
- *      defaults are used if an option is omitted.
+ *  \li cs_max_packets, cs_unsolicited_policy, pit_straggler_time (in milliseconds),
+ *      pit_finalize_when_served and pit_arena are applied; defaults are used if an option is
+ *      omitted.
  *  \li strategy_choice entries are inserted, but old entries are not deleted.
  *  \li network_region is applied; it's kept unchanged if the section is omitted.
  *
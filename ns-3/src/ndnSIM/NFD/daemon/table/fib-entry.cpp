@@ -24,13 +24,19 @@
  */
 
 #include "fib-entry.hpp"
+#include "fib-function-group-index.hpp"
 
 namespace nfd {
 namespace fib {
 
 Entry::Entry(const Name& prefix)
   : m_prefix(prefix)
-  , m_nameTreeEntry(nullptr), m_phc(0), m_fcc(0)
+  , m_fcc(0)
+  , m_phc(0)
+  , m_nameTreeEntry(nullptr)
+  , m_functionGroup(nullptr)
+  , m_functionGroupSlot(0)
+  , m_handleSlot(0)
 {
 }
 
@@ -88,6 +94,9 @@ void
 Entry::setFcc(int fcc)
 {
 	m_fcc = fcc;
+	if (m_functionGroup != nullptr) {
+		m_functionGroup->updateCost(m_functionGroupSlot, getCost());
+	}
 }
 
 int
@@ -99,6 +108,19 @@ Entry::getPhc()
 void
 Entry::setPhc(int phc){
 	m_phc = phc;
+	if (m_functionGroup != nullptr) {
+		m_functionGroup->updateCost(m_functionGroupSlot, getCost());
+	}
+}
+
+void
+Entry::setFeedback(int fcc, int phc)
+{
+	m_fcc = fcc;
+	m_phc = phc;
+	if (m_functionGroup != nullptr) {
+		m_functionGroup->updateCost(m_functionGroupSlot, getCost());
+	}
 }
 
 int
@@ -36,6 +36,9 @@ class Entry;
 
 namespace fib {
 
+class FunctionGroup;
+class FunctionGroupIndex;
+
 /** \class NextHopList
  *  \brief represents a collection of nexthops
  *
@@ -46,6 +49,53 @@ namespace fib {
  */
 typedef std::vector<fib::NextHop> NextHopList;
 
+/** \brief refers to a FIB entry that may be erased while the handle is kept
+ *
+ *  A handle is a slot index in the entry slab of the Fib plus the generation of that slot.
+ *  Erasing the entry bumps the generation, so a stale handle resolves to nullptr
+ *  instead of a dangling pointer. A default-constructed handle refers to no entry.
+ *  \sa Fib::getHandle, Fib::get
+ */
+class EntryHandle
+{
+public:
+  EntryHandle()
+    : m_slot(0)
+    , m_generation(0)
+  {
+  }
+
+  EntryHandle(uint32_t slot, uint32_t generation)
+    : m_slot(slot)
+    , m_generation(generation)
+  {
+  }
+
+  uint32_t
+  getSlot() const
+  {
+    return m_slot;
+  }
+
+  uint32_t
+  getGeneration() const
+  {
+    return m_generation;
+  }
+
+  /** \return whether the handle was obtained from a FIB entry; it may still be stale
+   */
+  explicit
+  operator bool() const
+  {
+    return m_generation != 0;
+  }
+
+private:
+  uint32_t m_slot;
+  uint32_t m_generation;
+};
+
 /** \brief represents a FIB entry
  */
 class Entry : noncopyable
@@ -96,15 +146,24 @@ public:
   int
   getFcc();
 
+  /** \brief set function call count; this updates the cost cached by the function group
+   */
   void
   setFcc(int fcc);
 
   int
   getPhc();
 
+  /** \brief set partial hop count; this updates the cost cached by the function group
+   */
   void
   setPhc(int phc);
 
+  /** \brief set function call count and partial hop count, updating the cached cost once
+   */
+  void
+  setFeedback(int fcc, int phc);
+
   int
   getCost();
 
@@ -127,7 +186,15 @@ private:
 
   name_tree::Entry* m_nameTreeEntry;
 
+  FunctionGroup* m_functionGroup;
+  size_t m_functionGroupSlot;
+
+  uint32_t m_handleSlot;
+
   friend class name_tree::Entry;
+  friend class Fib;
+  friend class FunctionGroup;
+  friend class FunctionGroupIndex;
 };
 
 } // namespace fib
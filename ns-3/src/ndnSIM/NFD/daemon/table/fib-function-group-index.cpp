@@ -0,0 +1,263 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "fib-function-group-index.hpp"
+#include "fib-entry.hpp"
+
+namespace nfd {
+namespace fib {
+
+void
+FunctionGroup::insert(Entry& entry, char instance)
+{
+  auto it = std::upper_bound(m_instanceLetters.begin(), m_instanceLetters.end(), instance);
+  size_t slot = it - m_instanceLetters.begin();
+
+  m_instances.insert(m_instances.begin() + slot, &entry);
+  m_instanceLetters.insert(it, instance);
+  m_costs.insert(m_costs.begin() + slot, entry.getCost());
+  entry.m_functionGroup = this;
+  this->renumber(slot);
+  this->findMinCostInstance();
+  m_isAliasTableStale = true;
+}
+
+void
+FunctionGroup::erase(Entry& entry)
+{
+  size_t slot = entry.m_functionGroupSlot;
+  BOOST_ASSERT(slot < m_instances.size() && m_instances[slot] == &entry);
+
+  m_instances.erase(m_instances.begin() + slot);
+  m_instanceLetters.erase(m_instanceLetters.begin() + slot);
+  m_costs.erase(m_costs.begin() + slot);
+  entry.m_functionGroup = nullptr;
+  this->renumber(slot);
+  this->findMinCostInstance();
+  m_isAliasTableStale = true;
+}
+
+void
+FunctionGroup::updateCost(size_t slot, int cost)
+{
+  int oldCost = m_costs[slot];
+  if (cost == oldCost) {
+    return;
+  }
+  m_costs[slot] = cost;
+  m_isAliasTableStale = true;
+
+  if (slot == m_minSlot) {
+    if (cost > oldCost) {
+      this->findMinCostInstance();
+    }
+  }
+  else if (cost < m_costs[m_minSlot] || (cost == m_costs[m_minSlot] && slot < m_minSlot)) {
+    m_minSlot = slot;
+  }
+}
+
+void
+FunctionGroup::findMinCostInstance()
+{
+  m_minSlot = std::min_element(m_costs.begin(), m_costs.end()) - m_costs.begin();
+  if (m_minSlot == m_costs.size()) {
+    m_minSlot = 0;
+  }
+}
+
+Entry*
+FunctionGroup::getWeightedInstance(std::mt19937& rng)
+{
+  if (m_instances.empty()) {
+    return nullptr;
+  }
+  if (m_isAliasTableStale) {
+    this->buildAliasTable();
+  }
+
+  size_t slot = std::uniform_int_distribution<size_t>(0, m_instances.size() - 1)(rng);
+  if (std::uniform_real_distribution<double>(0, 1)(rng) >= m_aliasProbabilities[slot]) {
+    slot = m_aliases[slot];
+  }
+  return m_instances[slot];
+}
+
+Entry*
+FunctionGroup::getPowerOfTwoInstance(std::mt19937& rng) const
+{
+  if (m_instances.size() < 2) {
+    return this->getMinCostInstance();
+  }
+
+  size_t first = std::uniform_int_distribution<size_t>(0, m_instances.size() - 1)(rng);
+  size_t second = std::uniform_int_distribution<size_t>(0, m_instances.size() - 2)(rng);
+  if (second >= first) {
+    ++second;
+  }
+  return m_instances[m_costs[second] < m_costs[first] ? second : first];
+}
+
+/** \return the score of instance \p instance for a flow with hash \p flowHash (SplitMix64)
+ */
+static uint64_t
+getRendezvousScore(uint64_t flowHash, char instance)
+{
+  uint64_t z = flowHash + static_cast<uint64_t>(instance) * 0x9e3779b97f4a7c15ULL;
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  return z ^ (z >> 31);
+}
+
+Entry*
+FunctionGroup::getAffinityInstance(uint64_t flowHash, int costThreshold) const
+{
+  size_t best = m_instances.size();
+  size_t bestOverThreshold = m_instances.size();
+  uint64_t bestScore = 0;
+  uint64_t bestScoreOverThreshold = 0;
+  for (size_t slot = 0; slot < m_instances.size(); ++slot) {
+    uint64_t score = getRendezvousScore(flowHash, m_instanceLetters[slot]);
+    if (m_costs[slot] <= costThreshold) {
+      if (best == m_instances.size() || score > bestScore) {
+        best = slot;
+        bestScore = score;
+      }
+    }
+    else if (bestOverThreshold == m_instances.size() || score > bestScoreOverThreshold) {
+      bestOverThreshold = slot;
+      bestScoreOverThreshold = score;
+    }
+  }
+
+  if (best == m_instances.size()) {
+    best = bestOverThreshold;
+  }
+  return best == m_instances.size() ? nullptr : m_instances[best];
+}
+
+void
+FunctionGroup::buildAliasTable()
+{
+  size_t n = m_costs.size();
+  std::vector<double> scaled(n);
+  double total = 0;
+  for (size_t slot = 0; slot < n; ++slot) {
+    scaled[slot] = 1.0 / (1 + std::max(m_costs[slot], 0));
+    total += scaled[slot];
+  }
+
+  std::vector<size_t> small, large;
+  for (size_t slot = 0; slot < n; ++slot) {
+    scaled[slot] *= n / total;
+    (scaled[slot] < 1 ? small : large).push_back(slot);
+  }
+
+  m_aliasProbabilities.assign(n, 1);
+  m_aliases.resize(n);
+  for (size_t slot = 0; slot < n; ++slot) {
+    m_aliases[slot] = slot;
+  }
+  while (!small.empty() && !large.empty()) {
+    size_t less = small.back();
+    small.pop_back();
+    size_t more = large.back();
+
+    m_aliasProbabilities[less] = scaled[less];
+    m_aliases[less] = more;
+    scaled[more] -= 1 - scaled[less];
+    if (scaled[more] < 1) {
+      large.pop_back();
+      small.push_back(more);
+    }
+  }
+  // slots left in either list keep probability 1, absorbing rounding errors
+
+  m_isAliasTableStale = false;
+}
+
+void
+FunctionGroup::renumber(size_t first)
+{
+  for (size_t slot = first; slot < m_instances.size(); ++slot) {
+    m_instances[slot]->m_functionGroupSlot = slot;
+  }
+}
+
+/** \brief split a FIB prefix naming a function instance, e.g. /F1a into F1 and 'a'
+ *  \return whether \p prefix names a function instance
+ */
+static bool
+parseInstancePrefix(const Name& prefix, std::string& function, char& instance)
+{
+  if (prefix.size() != 1) {
+    return false;
+  }
+
+  const name::Component& component = prefix.get(0);
+  if (component.value_size() < 2) {
+    return false;
+  }
+
+  std::string value(reinterpret_cast<const char*>(component.value()), component.value_size());
+  instance = value.back();
+  char last = value[value.size() - 2];
+  if (instance < 'a' || instance > 'z' || last < '0' || last > '9') {
+    return false;
+  }
+  value.pop_back();
+  function = std::move(value);
+  return true;
+}
+
+void
+FunctionGroupIndex::insert(Entry& entry)
+{
+  std::string function;
+  char instance;
+  if (!parseInstancePrefix(entry.getPrefix(), function, instance)) {
+    return;
+  }
+
+  FunctionChain::FunctionId id = FunctionChain::intern(function);
+  if (id >= m_groups.size()) {
+    m_groups.resize(id + 1);
+  }
+  if (m_groups[id] == nullptr) {
+    m_groups[id] = make_unique<FunctionGroup>();
+  }
+  m_groups[id]->insert(entry, instance);
+}
+
+void
+FunctionGroupIndex::erase(Entry& entry)
+{
+  if (entry.m_functionGroup != nullptr) {
+    entry.m_functionGroup->erase(entry);
+  }
+}
+
+} // namespace fib
+} // namespace nfd
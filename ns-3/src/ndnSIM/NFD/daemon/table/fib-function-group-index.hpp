@@ -0,0 +1,183 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_FIB_FUNCTION_GROUP_INDEX_HPP
+#define NFD_DAEMON_TABLE_FIB_FUNCTION_GROUP_INDEX_HPP
+
+#include "core/common.hpp"
+
+#include <random>
+
+namespace nfd {
+namespace fib {
+
+class Entry;
+
+/** \brief the FIB entries of all instances of a service function
+ *
+ *  For example, the group of F1 holds the entries of /F1a, /F1b and /F1c.
+ *  The costs of the instances are cached in a contiguous array, and the instance with the
+ *  smallest cost is kept up to date as fib::Entry::setFcc and fib::Entry::setPhc are called.
+ */
+class FunctionGroup : noncopyable
+{
+public:
+  bool
+  empty() const
+  {
+    return m_instances.empty();
+  }
+
+  size_t
+  size() const
+  {
+    return m_instances.size();
+  }
+
+  /** \return the FIB entries of the instances, ordered by instance letter
+   */
+  const std::vector<Entry*>&
+  getInstances() const
+  {
+    return m_instances;
+  }
+
+  /** \return the instance with the smallest cost, or nullptr if the group is empty
+   *
+   *  If several instances have the smallest cost, the first one in instance order is returned.
+   */
+  Entry*
+  getMinCostInstance() const
+  {
+    return m_instances.empty() ? nullptr : m_instances[m_minSlot];
+  }
+
+  /** \return an instance drawn with probability inversely proportional to 1 + its cost,
+   *          or nullptr if the group is empty
+   *
+   *  The instance is drawn from an alias table in constant time. The table is rebuilt on the
+   *  first draw after a cost changes.
+   */
+  Entry*
+  getWeightedInstance(std::mt19937& rng);
+
+  /** \return the instance with the smaller cost among two instances drawn at random,
+   *          or nullptr if the group is empty
+   */
+  Entry*
+  getPowerOfTwoInstance(std::mt19937& rng) const;
+
+  /** \return the instance a flow with hash \p flowHash is pinned to, or nullptr if the
+   *          group is empty
+   *
+   *  The flow is pinned by rendezvous hashing over the instance letters, among the instances
+   *  whose cost does not exceed \p costThreshold, or among all instances if every cost does.
+   *  When an instance crosses the threshold or leaves the group, only the flows pinned to it
+   *  move, and they come back when it returns.
+   */
+  Entry*
+  getAffinityInstance(uint64_t flowHash, int costThreshold) const;
+
+private:
+  void
+  insert(Entry& entry, char instance);
+
+  void
+  erase(Entry& entry);
+
+  /** \brief update the cached cost of the instance in \p slot
+   */
+  void
+  updateCost(size_t slot, int cost);
+
+  /** \brief recompute the instance with the smallest cost
+   */
+  void
+  findMinCostInstance();
+
+  /** \brief update the slots stored in the entries from \p first on
+   */
+  void
+  renumber(size_t first);
+
+  /** \brief build the alias table of the weights 1 / (1 + cost) (Vose's method)
+   */
+  void
+  buildAliasTable();
+
+private:
+  std::vector<Entry*> m_instances;
+  std::vector<char> m_instanceLetters;
+  std::vector<int> m_costs;
+  size_t m_minSlot = 0;
+
+  std::vector<double> m_aliasProbabilities; // probability of keeping the drawn slot
+  std::vector<size_t> m_aliases;            // slot taken otherwise
+  bool m_isAliasTableStale = true;
+
+  friend class FunctionGroupIndex;
+  friend class Entry;
+};
+
+/** \brief maps a service function to the FIB entries of its instances
+ *
+ *  A FIB entry belongs to a function group if its prefix has a single component made of a
+ *  function name ending in a digit followed by one instance letter, e.g. /F1a is instance 'a'
+ *  of F1. Groups are indexed by interned function identifier, so that selecting an instance
+ *  needs neither a name conversion nor a NameTree lookup.
+ */
+class FunctionGroupIndex : noncopyable
+{
+public:
+  /** \brief add \p entry to the group of its function, if its prefix names a function instance
+   */
+  void
+  insert(Entry& entry);
+
+  /** \brief remove \p entry from its group, if any
+   */
+  void
+  erase(Entry& entry);
+
+  /** \return the group of \p function, or nullptr if no instance of \p function is in the FIB
+   */
+  FunctionGroup*
+  find(FunctionChain::FunctionId function) const
+  {
+    if (function >= m_groups.size() || m_groups[function] == nullptr ||
+        m_groups[function]->empty()) {
+      return nullptr;
+    }
+    return m_groups[function].get();
+  }
+
+private:
+  std::vector<unique_ptr<FunctionGroup>> m_groups; // indexed by FunctionId
+};
+
+} // namespace fib
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_FIB_FUNCTION_GROUP_INDEX_HPP
@@ -0,0 +1,178 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "fib-load-estimator.hpp"
+
+#include <cmath>
+
+namespace nfd {
+namespace fib {
+
+EwmaLoadEstimator::EwmaLoadEstimator(time::nanoseconds timeConstant)
+  : m_timeConstant(static_cast<double>(timeConstant.count()))
+{
+  BOOST_ASSERT(timeConstant > time::nanoseconds::zero());
+}
+
+void
+EwmaLoadEstimator::decay(time::steady_clock::TimePoint now)
+{
+  if (now <= m_lastUpdate) {
+    return;
+  }
+  double elapsed = static_cast<double>(time::duration_cast<time::nanoseconds>(now - m_lastUpdate).count());
+  m_value *= std::exp(-elapsed / m_timeConstant);
+  m_lastUpdate = now;
+}
+
+void
+EwmaLoadEstimator::add(time::steady_clock::TimePoint now, double amount)
+{
+  this->decay(now);
+  m_value += amount;
+}
+
+double
+EwmaLoadEstimator::get(time::steady_clock::TimePoint now)
+{
+  this->decay(now);
+  return m_value;
+}
+
+void
+EwmaLoadEstimator::reset()
+{
+  m_value = 0;
+}
+
+unique_ptr<LoadEstimator>
+EwmaLoadEstimator::makeEmpty() const
+{
+  return make_unique<EwmaLoadEstimator>(time::nanoseconds(static_cast<int64_t>(m_timeConstant)));
+}
+
+SlidingWindowLoadEstimator::SlidingWindowLoadEstimator(time::nanoseconds window, size_t nBuckets)
+  : m_bucketWidth(window / nBuckets)
+  , m_buckets(nBuckets, 0)
+{
+  BOOST_ASSERT(nBuckets > 0);
+  BOOST_ASSERT(m_bucketWidth > time::nanoseconds::zero());
+}
+
+void
+SlidingWindowLoadEstimator::advance(time::steady_clock::TimePoint now)
+{
+  int64_t bucket = time::duration_cast<time::nanoseconds>(now.time_since_epoch()).count() /
+                   m_bucketWidth.count();
+  if (bucket <= m_currentBucket) {
+    return;
+  }
+
+  int64_t nCleared = std::min<int64_t>(bucket - m_currentBucket, m_buckets.size());
+  for (int64_t i = 1; i <= nCleared; ++i) {
+    double& expired = m_buckets[(m_currentBucket + i) % m_buckets.size()];
+    m_sum -= expired;
+    expired = 0;
+  }
+  if (nCleared == static_cast<int64_t>(m_buckets.size())) {
+    m_sum = 0; // no rounding error is carried over an empty window
+  }
+  m_currentBucket = bucket;
+}
+
+void
+SlidingWindowLoadEstimator::add(time::steady_clock::TimePoint now, double amount)
+{
+  this->advance(now);
+  m_buckets[m_currentBucket % m_buckets.size()] += amount;
+  m_sum += amount;
+}
+
+double
+SlidingWindowLoadEstimator::get(time::steady_clock::TimePoint now)
+{
+  this->advance(now);
+  return std::max(m_sum, 0.0);
+}
+
+void
+SlidingWindowLoadEstimator::reset()
+{
+  std::fill(m_buckets.begin(), m_buckets.end(), 0);
+  m_sum = 0;
+}
+
+unique_ptr<LoadEstimator>
+SlidingWindowLoadEstimator::makeEmpty() const
+{
+  return make_unique<SlidingWindowLoadEstimator>(m_bucketWidth * m_buckets.size(),
+                                                 m_buckets.size());
+}
+
+TokenBucketLoadEstimator::TokenBucketLoadEstimator(double rate)
+  : m_rate(rate / 1e9)
+{
+  BOOST_ASSERT(rate > 0);
+}
+
+void
+TokenBucketLoadEstimator::drain(time::steady_clock::TimePoint now)
+{
+  if (now <= m_lastUpdate) {
+    return;
+  }
+  double elapsed = static_cast<double>(time::duration_cast<time::nanoseconds>(now - m_lastUpdate).count());
+  m_level = std::max(m_level - elapsed * m_rate, 0.0);
+  m_lastUpdate = now;
+}
+
+void
+TokenBucketLoadEstimator::add(time::steady_clock::TimePoint now, double amount)
+{
+  this->drain(now);
+  m_level += amount;
+}
+
+double
+TokenBucketLoadEstimator::get(time::steady_clock::TimePoint now)
+{
+  this->drain(now);
+  return m_level;
+}
+
+void
+TokenBucketLoadEstimator::reset()
+{
+  m_level = 0;
+}
+
+unique_ptr<LoadEstimator>
+TokenBucketLoadEstimator::makeEmpty() const
+{
+  return make_unique<TokenBucketLoadEstimator>(m_rate * 1e9);
+}
+
+} // namespace fib
+} // namespace nfd
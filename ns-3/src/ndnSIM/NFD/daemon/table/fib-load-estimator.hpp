@@ -0,0 +1,178 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_FIB_LOAD_ESTIMATOR_HPP
+#define NFD_DAEMON_TABLE_FIB_LOAD_ESTIMATOR_HPP
+
+#include "core/common.hpp"
+
+namespace nfd {
+namespace fib {
+
+/** \brief estimates the current call load of the function instances on a node
+ *
+ *  The load replaces a call counter that was reset at fixed intervals: such a counter drops
+ *  to zero at every reset, so all nodes see the same instance as idle at the same time.
+ *  An estimator instead forgets old calls gradually. Both add and get take constant time.
+ */
+class LoadEstimator : noncopyable
+{
+public:
+  virtual
+  ~LoadEstimator() = default;
+
+  /** \brief count \p amount calls at time \p now
+   */
+  virtual void
+  add(time::steady_clock::TimePoint now, double amount = 1) = 0;
+
+  /** \return the load at time \p now, in calls
+   *
+   *  \p now must not be earlier than the time of the last add.
+   */
+  virtual double
+  get(time::steady_clock::TimePoint now) = 0;
+
+  /** \brief forget all counted calls
+   */
+  virtual void
+  reset() = 0;
+
+  /** \return an estimator of the same kind and parameters, with no counted calls
+   */
+  virtual unique_ptr<LoadEstimator>
+  makeEmpty() const = 0;
+};
+
+/** \brief exponentially decayed call count
+ *
+ *  Every call weighs exp(-age / timeConstant), so the load approximates the number of calls
+ *  in the last \p timeConstant and follows changes of the call rate without steps.
+ */
+class EwmaLoadEstimator : public LoadEstimator
+{
+public:
+  explicit
+  EwmaLoadEstimator(time::nanoseconds timeConstant);
+
+  void
+  add(time::steady_clock::TimePoint now, double amount = 1) final;
+
+  double
+  get(time::steady_clock::TimePoint now) final;
+
+  void
+  reset() final;
+
+  unique_ptr<LoadEstimator>
+  makeEmpty() const final;
+
+private:
+  void
+  decay(time::steady_clock::TimePoint now);
+
+private:
+  double m_timeConstant; // in nanoseconds
+  double m_value = 0;
+  time::steady_clock::TimePoint m_lastUpdate;
+};
+
+/** \brief number of calls in a sliding window
+ *
+ *  The window is divided into \p nBuckets buckets held in a ring buffer, so the load counts
+ *  the calls of the last \p window with a granularity of one bucket. With a single bucket,
+ *  this is the counter reset at fixed intervals.
+ */
+class SlidingWindowLoadEstimator : public LoadEstimator
+{
+public:
+  SlidingWindowLoadEstimator(time::nanoseconds window, size_t nBuckets);
+
+  void
+  add(time::steady_clock::TimePoint now, double amount = 1) final;
+
+  double
+  get(time::steady_clock::TimePoint now) final;
+
+  void
+  reset() final;
+
+  unique_ptr<LoadEstimator>
+  makeEmpty() const final;
+
+private:
+  /** \brief clear the buckets that left the window, and make the bucket of \p now current
+   *
+   *  At most nBuckets buckets are cleared, and each bucket once per bucket period, so the
+   *  cost is constant when amortized over the calls.
+   */
+  void
+  advance(time::steady_clock::TimePoint now);
+
+private:
+  time::nanoseconds m_bucketWidth;
+  std::vector<double> m_buckets; // indexed by bucket number modulo nBuckets
+  int64_t m_currentBucket = 0;   // bucket number of the last update
+  double m_sum = 0;
+};
+
+/** \brief backlog of calls above a provisioned call rate
+ *
+ *  The load is the level of a bucket filled by the calls and drained at \p rate calls per
+ *  second. It stays near zero while an instance receives fewer calls than it can serve, and
+ *  grows with the calls it cannot serve in time.
+ */
+class TokenBucketLoadEstimator : public LoadEstimator
+{
+public:
+  explicit
+  TokenBucketLoadEstimator(double rate);
+
+  void
+  add(time::steady_clock::TimePoint now, double amount = 1) final;
+
+  double
+  get(time::steady_clock::TimePoint now) final;
+
+  void
+  reset() final;
+
+  unique_ptr<LoadEstimator>
+  makeEmpty() const final;
+
+private:
+  void
+  drain(time::steady_clock::TimePoint now);
+
+private:
+  double m_rate; // in calls per nanosecond
+  double m_level = 0;
+  time::steady_clock::TimePoint m_lastUpdate;
+};
+
+} // namespace fib
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_FIB_LOAD_ESTIMATOR_HPP
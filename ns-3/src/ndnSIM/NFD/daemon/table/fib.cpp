@@ -27,10 +27,13 @@
 #include "fib.hpp"
 #include "pit-entry.hpp"
 #include "measurements-entry.hpp"
+#include "core/random.hpp"
 
 #include <boost/concept/assert.hpp>
 #include <boost/concept_check.hpp>
 #include <type_traits>
+#include <cmath>
+#include <limits>
 
 namespace nfd {
 namespace fib {
@@ -57,7 +60,10 @@ nteHasFibEntry(const name_tree::Entry& nte)
 Fib::Fib(NameTree& nameTree)
 : m_nameTree(nameTree)
 , m_nItems(0)
-, m_fcc(0)
+, m_loadEstimator(make_unique<EwmaLoadEstimator>(time::milliseconds(50)))
+, m_instanceSelection(InstanceSelection::MIN_COST)
+, m_affinityCostThreshold(std::numeric_limits<int>::max())
+, m_rng(getGlobalRng()())
 {
 }
 
@@ -84,39 +90,61 @@ Fib::findLongestPrefixMatch(const pit::Entry& pitEntry) const
 	return this->findLongestPrefixMatchImpl(pitEntry);
 }
 
+/** \return FNV-1a hash of the components of \p flow, without a trailing sequence number
+ */
+static uint64_t
+hashFlow(const Name& flow)
+{
+	size_t nComponents = flow.size();
+	if (nComponents > 0 && flow.get(-1).isSequenceNumber()) {
+		--nComponents;
+	}
+
+	uint64_t hash = 0xcbf29ce484222325ULL;
+	for (size_t i = 0; i < nComponents; ++i) {
+		for (uint8_t byte : flow.get(i)) {
+			hash = (hash ^ byte) * 0x100000001b3ULL;
+		}
+		hash = (hash ^ 0xff) * 0x100000001b3ULL; // component separator
+	}
+	return hash;
+}
+
 //2020/11/18
+fib::Entry*
+Fib::selectFunction(FunctionChain::FunctionId function, const Name& flow) const
+{
+	FunctionGroup* group = m_functionGroups.find(function);
+	if (group == nullptr) {
+		return nullptr;
+	}
+
+	fib::Entry* entry = nullptr;
+	switch (m_instanceSelection) {
+	case InstanceSelection::WEIGHTED:
+		// the random split spreads the load, so costs change only with feedback
+		return group->getWeightedInstance(m_rng);
+	case InstanceSelection::POWER_OF_TWO:
+		entry = group->getPowerOfTwoInstance(m_rng);
+		break;
+	case InstanceSelection::AFFINITY:
+		entry = group->getAffinityInstance(hashFlow(flow), m_affinityCostThreshold);
+		break;
+	default:
+		entry = group->getMinCostInstance();
+		break;
+	}
+	entry->setFcc(entry->getFcc() + 1);
+	return entry;
+}
+
 fib::Entry*
 Fib::selectFunction(const Name& prefix) const
 {
-	fib::Entry* fibEntrY = nullptr;
-	int indicatorNum = 3;
-	char indicator = 'a';
-	std::string headFunction = prefix.toUri();
-	auto separator = std::string("/");
-	auto separator_length = separator.length();
-
-	auto pos = headFunction.find(separator,separator_length);
-	if(pos != std::string::npos)
-		headFunction.erase(pos, headFunction.size() - pos);
-
-
-	for(int i = 0; i < indicatorNum; i++){
-		Name exFunctionName = Name(headFunction + indicator);
-		//std::cout << "Candidate:" << exFunctionName.toUri() << std::endl;
-		fib::Entry* entry = this->findLongestPrefixMatchFunction(exFunctionName);
-		//std::cout<<"the cost is " << entry->getCost() << std::endl;
-		if(fibEntrY == nullptr){
-			fibEntrY = entry;
-			//std::cout << "Selected:" << exFunctionName.toUri() << std::endl;
-		}else if(entry->getCost() < fibEntrY->getCost()){
-			fibEntrY = entry;
-			//std::cout << "Selected2:" << exFunctionName.toUri() << std::endl;
-		}
-		indicator++;
+	if (prefix.empty()) {
+		return nullptr;
 	}
-	//std::cout << "FCC:" << fibEntrY->getFcc() << std::endl;
-	fibEntrY->setFcc(fibEntrY->getFcc() + 1);
-	return fibEntrY;
+	return this->selectFunction(FunctionChain::intern(prefix.get(0)));
 }
 
 //ADDED Longest Prefix Match for Function Chaining
@@ -136,17 +164,24 @@ Fib::findLongestPrefixMatchFunction(const Name& prefix) const
 //added 2020/11/25
 void
 Fib::resetFcc(){
-	m_fcc = 0;
+	m_loadEstimator->reset();
 }
 
 void
 Fib::increaseFcc(){
-	m_fcc++;
+	m_loadEstimator->add(time::steady_clock::now());
 }
 
 int
 Fib::getFcc(){
-	return m_fcc;
+	return static_cast<int>(std::lround(m_loadEstimator->get(time::steady_clock::now())));
+}
+
+void
+Fib::setLoadEstimator(unique_ptr<LoadEstimator> loadEstimator)
+{
+	BOOST_ASSERT(loadEstimator != nullptr);
+	m_loadEstimator = std::move(loadEstimator);
 }
 
 
@@ -177,6 +212,8 @@ Fib::insert(const Name& prefix)
 
 	nte.setFibEntry(make_unique<Entry>(prefix));
 	++m_nItems;
+	this->allocateSlot(*nte.getFibEntry());
+	m_functionGroups.insert(*nte.getFibEntry());
 	return std::make_pair(nte.getFibEntry(), true);
 }
 
@@ -185,6 +222,8 @@ Fib::erase(name_tree::Entry* nte, bool canDeleteNte)
 {
 	BOOST_ASSERT(nte != nullptr);
 
+	m_functionGroups.erase(*nte->getFibEntry());
+	this->releaseSlot(*nte->getFibEntry());
 	nte->setFibEntry(nullptr);
 	if (canDeleteNte) {
 		m_nameTree.eraseIfEmpty(nte);
@@ -192,6 +231,33 @@ Fib::erase(name_tree::Entry* nte, bool canDeleteNte)
 	--m_nItems;
 }
 
+void
+Fib::allocateSlot(Entry& entry)
+{
+	if (m_freeSlots.empty()) {
+		entry.m_handleSlot = static_cast<uint32_t>(m_slots.size());
+		m_slots.push_back({&entry, 1});
+	}
+	else {
+		entry.m_handleSlot = m_freeSlots.back();
+		m_freeSlots.pop_back();
+		m_slots[entry.m_handleSlot].entry = &entry;
+	}
+}
+
+void
+Fib::releaseSlot(Entry& entry)
+{
+	Slot& slot = m_slots[entry.m_handleSlot];
+	BOOST_ASSERT(slot.entry == &entry);
+	slot.entry = nullptr;
+	// invalidate outstanding handles; generation 0 is reserved for empty handles
+	if (++slot.generation == 0) {
+		slot.generation = 1;
+	}
+	m_freeSlots.push_back(entry.m_handleSlot);
+}
+
 void
 Fib::erase(const Name& prefix)
 {
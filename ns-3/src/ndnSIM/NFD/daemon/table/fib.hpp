@@ -27,6 +27,8 @@
 #define NFD_DAEMON_TABLE_FIB_HPP
 
 #include "fib-entry.hpp"
+#include "fib-function-group-index.hpp"
+#include "fib-load-estimator.hpp"
 #include "name-tree.hpp"
 
 #include <boost/range/adaptor/transformed.hpp>
@@ -42,6 +44,25 @@ class Entry;
 
 namespace fib {
 
+/** \brief how Fib::selectFunction chooses among the instances of a function
+ */
+enum class InstanceSelection {
+  /** \brief the instance with the smallest cost, counting one more call on it
+   */
+  MIN_COST,
+  /** \brief an instance drawn with probability inversely proportional to 1 + its cost;
+   *         costs change only with reported feedback
+   */
+  WEIGHTED,
+  /** \brief the cheaper of two instances drawn at random, counting one more call on it
+   */
+  POWER_OF_TWO,
+  /** \brief the instance the flow of the Interest is pinned to by a hash of its name,
+   *         counting one more call on it
+   */
+  AFFINITY
+};
+
 /** \brief represents the Forwarding Information Base (FIB)
  */
 class Fib : noncopyable
@@ -65,19 +86,91 @@ public: // lookup
   fib::Entry*
   findLongestPrefixMatchFunction(const Name& prefix) const;
 
+  /** \brief forget the function calls counted on this node
+   */
   void
   resetFcc();
 
+  /** \brief count one function call on this node
+   */
   void
   increaseFcc();
 
+  /** \return the current function call load of this node, rounded to a whole number of calls
+   */
   int
   getFcc();
 
+  /** \brief replace the estimator of the function call load of this node
+   *
+   *  The default estimator is an EwmaLoadEstimator with a time constant of 50 ms.
+   */
+  void
+  setLoadEstimator(unique_ptr<LoadEstimator> loadEstimator);
+
+  LoadEstimator&
+  getLoadEstimator() const
+  {
+    return *m_loadEstimator;
+  }
+
+  /** \brief select an instance of \p function as set by setInstanceSelection
+   *  \param flow name of the Interest, used by InstanceSelection::AFFINITY; a trailing
+   *              sequence number is ignored, so that all segments of a content are one flow
+   *  \return the FIB entry of the selected instance, or nullptr if \p function has no instance
+   */
+  fib::Entry*
+  selectFunction(FunctionChain::FunctionId function, const Name& flow = Name()) const;
 
+  /** \brief select an instance of the first component of \p prefix
+   *  \sa selectFunction(FunctionChain::FunctionId)
+   */
   fib::Entry*
   selectFunction(const Name& prefix) const;
 
+  /** \brief set how selectFunction chooses among instances; the default is MIN_COST
+   */
+  void
+  setInstanceSelection(InstanceSelection selection)
+  {
+    m_instanceSelection = selection;
+  }
+
+  InstanceSelection
+  getInstanceSelection() const
+  {
+    return m_instanceSelection;
+  }
+
+  /** \brief set the cost above which InstanceSelection::AFFINITY moves flows away from an
+   *         instance; by default flows never move
+   */
+  void
+  setAffinityCostThreshold(int threshold)
+  {
+    m_affinityCostThreshold = threshold;
+  }
+
+  /** \brief restart the random draws of InstanceSelection::WEIGHTED and POWER_OF_TWO from
+   *         \p seed
+   *
+   *  By default the generator is seeded from the global generator, which follows the RngSeed
+   *  and RngRun of the simulation.
+   */
+  void
+  seedRng(uint32_t seed)
+  {
+    m_rng.seed(seed);
+  }
+
+  /** \return the instances of \p function in the FIB, or nullptr if there is none
+   */
+  const FunctionGroup*
+  findFunctionGroup(FunctionChain::FunctionId function) const
+  {
+    return m_functionGroups.find(function);
+  }
+
   /** \brief performs a longest prefix match
    *
    *  This is equivalent to .findLongestPrefixMatch(pitEntry.getName())
@@ -97,6 +190,30 @@ public: // lookup
   Entry*
   findExactMatch(const Name& prefix);
 
+public: // handles
+  /** \return a handle to \p entry, or an empty handle if \p entry is not in this FIB
+   */
+  EntryHandle
+  getHandle(const Entry& entry) const
+  {
+    if (entry.m_handleSlot >= m_slots.size() || m_slots[entry.m_handleSlot].entry != &entry) {
+      return EntryHandle();
+    }
+    return EntryHandle(entry.m_handleSlot, m_slots[entry.m_handleSlot].generation);
+  }
+
+  /** \return the entry referred to by \p handle, or nullptr if it has been erased
+   */
+  Entry*
+  get(EntryHandle handle) const
+  {
+    if (handle.getSlot() >= m_slots.size()) {
+      return nullptr;
+    }
+    const Slot& slot = m_slots[handle.getSlot()];
+    return slot.generation == handle.getGeneration() ? slot.entry : nullptr;
+  }
+
 public: // mutation
   /** \brief inserts a FIB entry for prefix
    *
@@ -154,10 +271,30 @@ private:
   Range
   getRange() const;
 
+  void
+  allocateSlot(Entry& entry);
+
+  void
+  releaseSlot(Entry& entry);
+
 private:
+  /** \brief an element of the entry slab referred to by EntryHandle
+   */
+  struct Slot
+  {
+    Entry* entry;
+    uint32_t generation; ///< starts at 1, so that an empty EntryHandle never matches
+  };
+
   NameTree& m_nameTree;
   size_t m_nItems;
-  int m_fcc;
+  unique_ptr<LoadEstimator> m_loadEstimator;
+  InstanceSelection m_instanceSelection;
+  int m_affinityCostThreshold;
+  mutable std::mt19937 m_rng;
+  FunctionGroupIndex m_functionGroups;
+  std::vector<Slot> m_slots;
+  std::vector<uint32_t> m_freeSlots;
 
   /** \brief the empty FIB entry.
    *
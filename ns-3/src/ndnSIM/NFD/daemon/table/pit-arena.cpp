@@ -0,0 +1,101 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "pit-arena.hpp"
+
+#include <algorithm>
+
+namespace nfd {
+namespace pit {
+
+const size_t Arena::ALIGNMENT = 16;
+const size_t Arena::MAX_BLOCK_SIZE = 512;
+const size_t Arena::SLAB_SIZE = 65536;
+
+/** \return index of the free list of blocks of \p size bytes
+ */
+static size_t
+getSizeClass(size_t size)
+{
+  return std::max<size_t>((size + Arena::ALIGNMENT - 1) / Arena::ALIGNMENT, 1);
+}
+
+Arena::Arena()
+  : m_freeLists(MAX_BLOCK_SIZE / ALIGNMENT + 1, nullptr)
+  , m_slabEnd(nullptr)
+  , m_slabCursor(nullptr)
+  , m_nBlocks(0)
+{
+}
+
+void*
+Arena::allocate(size_t size)
+{
+  if (size > MAX_BLOCK_SIZE) {
+    ++m_nBlocks;
+    return ::operator new(size);
+  }
+
+  size_t sizeClass = getSizeClass(size);
+  FreeBlock*& freeList = m_freeLists[sizeClass];
+  if (freeList != nullptr) {
+    FreeBlock* block = freeList;
+    freeList = block->next;
+    ++m_nBlocks;
+    return block;
+  }
+
+  size_t blockSize = sizeClass * ALIGNMENT;
+  if (static_cast<size_t>(m_slabEnd - m_slabCursor) < blockSize) {
+    // the rest of the current slab is left unused
+    m_slabs.emplace_back(new char[SLAB_SIZE]);
+    m_slabCursor = m_slabs.back().get();
+    m_slabEnd = m_slabCursor + SLAB_SIZE;
+  }
+  void* block = m_slabCursor;
+  m_slabCursor += blockSize;
+  ++m_nBlocks;
+  return block;
+}
+
+void
+Arena::deallocate(void* block, size_t size) noexcept
+{
+  BOOST_ASSERT(m_nBlocks > 0);
+  --m_nBlocks;
+
+  if (size > MAX_BLOCK_SIZE) {
+    ::operator delete(block);
+    return;
+  }
+
+  FreeBlock*& freeList = m_freeLists[getSizeClass(size)];
+  FreeBlock* freeBlock = static_cast<FreeBlock*>(block);
+  freeBlock->next = freeList;
+  freeList = freeBlock;
+}
+
+} // namespace pit
+} // namespace nfd
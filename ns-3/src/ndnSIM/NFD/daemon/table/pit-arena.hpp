@@ -0,0 +1,164 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2014-2016,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_PIT_ARENA_HPP
+#define NFD_DAEMON_TABLE_PIT_ARENA_HPP
+
+#include "core/common.hpp"
+
+namespace nfd {
+namespace pit {
+
+/** \brief a slab allocator for PIT entries and their in-records and out-records
+ *
+ *  Blocks are carved out of slabs taken from the system, and freed blocks are kept in a free list
+ *  per size class to be reused.  Slabs are returned to the system only when the arena is
+ *  destroyed, so the arena keeps the peak memory of the PIT in exchange for allocations that
+ *  do not go through the system allocator.  Blocks larger than MAX_BLOCK_SIZE are taken from
+ *  the system allocator directly.
+ */
+class Arena : noncopyable
+{
+public:
+  Arena();
+
+  void*
+  allocate(size_t size);
+
+  void
+  deallocate(void* block, size_t size) noexcept;
+
+  /** \return number of blocks allocated and not yet deallocated
+   */
+  size_t
+  getNBlocks() const
+  {
+    return m_nBlocks;
+  }
+
+  /** \return number of slabs taken from the system
+   */
+  size_t
+  getNSlabs() const
+  {
+    return m_slabs.size();
+  }
+
+public:
+  static const size_t ALIGNMENT;
+  static const size_t MAX_BLOCK_SIZE;
+  static const size_t SLAB_SIZE;
+
+private:
+  struct FreeBlock
+  {
+    FreeBlock* next;
+  };
+
+  std::vector<FreeBlock*> m_freeLists; ///< indexed by block size in units of ALIGNMENT
+  std::vector<unique_ptr<char[]>> m_slabs;
+  char* m_slabEnd;
+  char* m_slabCursor;
+  size_t m_nBlocks;
+};
+
+/** \brief an allocator of PIT entries and records from an Arena
+ *
+ *  An allocator without an arena uses the system allocator.  Allocators share the ownership of
+ *  their arena, so that the arena outlives the PIT entries that are still referenced after
+ *  the PIT is destroyed.
+ */
+template<typename T>
+class ArenaAllocator
+{
+public:
+  typedef T value_type;
+
+  explicit
+  ArenaAllocator(shared_ptr<Arena> arena = nullptr) noexcept
+    : m_arena(std::move(arena))
+  {
+  }
+
+  template<typename U>
+  ArenaAllocator(const ArenaAllocator<U>& other) noexcept
+    : m_arena(other.getArena())
+  {
+  }
+
+  T*
+  allocate(size_t n)
+  {
+    if (m_arena == nullptr) {
+      return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+    return static_cast<T*>(m_arena->allocate(n * sizeof(T)));
+  }
+
+  void
+  deallocate(T* p, size_t n) noexcept
+  {
+    if (m_arena == nullptr) {
+      ::operator delete(p);
+    }
+    else {
+      m_arena->deallocate(p, n * sizeof(T));
+    }
+  }
+
+  const shared_ptr<Arena>&
+  getArena() const
+  {
+    return m_arena;
+  }
+
+  template<typename U>
+  struct rebind
+  {
+    typedef ArenaAllocator<U> other;
+  };
+
+private:
+  shared_ptr<Arena> m_arena;
+};
+
+template<typename T, typename U>
+bool
+operator==(const ArenaAllocator<T>& lhs, const ArenaAllocator<U>& rhs)
+{
+  return lhs.getArena() == rhs.getArena();
+}
+
+template<typename T, typename U>
+bool
+operator!=(const ArenaAllocator<T>& lhs, const ArenaAllocator<U>& rhs)
+{
+  return lhs.getArena() != rhs.getArena();
+}
+
+} // namespace pit
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_PIT_ARENA_HPP
@@ -29,8 +29,10 @@
 namespace nfd {
 namespace pit {
 
-Entry::Entry(const Interest& interest)
+Entry::Entry(const Interest& interest, const ArenaAllocator<Entry>& allocator)
   : m_interest(interest.shared_from_this())
+  , m_inRecords(allocator)
+  , m_outRecords(allocator)
   , m_nameTreeEntry(nullptr)
 {
 }
@@ -26,6 +26,7 @@
 #ifndef NFD_DAEMON_TABLE_PIT_ENTRY_HPP
 #define NFD_DAEMON_TABLE_PIT_ENTRY_HPP
 
+#include "pit-arena.hpp"
 #include "pit-in-record.hpp"
 #include "pit-out-record.hpp"
 #include "core/scheduler.hpp"
@@ -41,11 +42,11 @@ namespace pit {
 
 /** \brief an unordered collection of in-records
  */
-typedef std::list<InRecord> InRecordCollection;
+typedef std::list<InRecord, ArenaAllocator<InRecord>> InRecordCollection;
 
 /** \brief an unordered collection of out-records
  */
-typedef std::list<OutRecord> OutRecordCollection;
+typedef std::list<OutRecord, ArenaAllocator<OutRecord>> OutRecordCollection;
 
 /** \brief an Interest table entry
  *
@@ -58,8 +59,11 @@ typedef std::list<OutRecord> OutRecordCollection;
 class Entry : public StrategyInfoHost, noncopyable
 {
 public:
+  /** \param interest the representative Interest
+   *  \param allocator allocator of the in-records and out-records
+   */
   explicit
-  Entry(const Interest& interest);
+  Entry(const Interest& interest, const ArenaAllocator<Entry>& allocator = ArenaAllocator<Entry>());
 
   /** \return the representative Interest of the PIT entry
    *  \note Every Interest in in-records and out-records should have same Name and Selectors
@@ -218,14 +222,19 @@ public: // out-record
   void
   deleteOutRecord(const Face& face);
 
-  fib::Entry*
-  getSelectedInstance(){
-	  return m_selectedInstance;
+  /** \brief get the function instance selected for this Interest
+   *  \sa Fib::get
+   */
+  fib::EntryHandle
+  getSelectedInstance() const
+  {
+    return m_selectedInstance;
   }
 
   void
-  setSelectedInstance(fib::Entry* selectedInstance){
-	  m_selectedInstance = selectedInstance;
+  setSelectedInstance(fib::EntryHandle selectedInstance)
+  {
+    m_selectedInstance = selectedInstance;
   }
 
 public:
@@ -256,7 +265,7 @@ private:
   OutRecordCollection m_outRecords;
 
   name_tree::Entry* m_nameTreeEntry;
-  fib::Entry* m_selectedInstance = nullptr;
+  fib::EntryHandle m_selectedInstance;
 
   friend class name_tree::Entry;
 };
@@ -64,38 +64,24 @@ Pit::findOrInsert(const Interest& interest, bool allowInsert)
 	size_t nteNameLen = nteName.size();
 	const std::vector<shared_ptr<Entry>>& pitEntries = nte->getPitEntries();
 
-	if(ns3::getChoiceType() == 4){
-		auto it = std::find_if(pitEntries.begin(), pitEntries.end(),
-				[&interest, nteNameLen] (const shared_ptr<Entry>& entry) {
-			// initial part of name is guaranteed to be equal by NameTree
-			// check implicit digest (or its absence) only
-			//return entry->canMatchFunction(interest, nteNameLen);
-			return entry->canMatch(interest, nteNameLen);
-		});
-
-		if (it != pitEntries.end()) {
-			return {*it, false};
-		}
-	}else{
-		auto it = std::find_if(pitEntries.begin(), pitEntries.end(),
-				[&interest, nteNameLen] (const shared_ptr<Entry>& entry) {
-			// initial part of name is guaranteed to be equal by NameTree
-			// check implicit digest (or its absence) only
-			return entry->canMatch(interest, nteNameLen);
-		});
-
-		if (it != pitEntries.end()) {
-			return {*it, false};
-		}
+	auto it = std::find_if(pitEntries.begin(), pitEntries.end(),
+			[&interest, nteNameLen] (const shared_ptr<Entry>& entry) {
+		// initial part of name is guaranteed to be equal by NameTree
+		// check implicit digest (or its absence) only
+		return entry->canMatch(interest, nteNameLen);
+	});
+
+	if (it != pitEntries.end()) {
+		return {*it, false};
 	}
 
-
 	if (!allowInsert) {
 		BOOST_ASSERT(!nte->isEmpty()); // nte shouldn't be created in this call
 		return {nullptr, true};
 	}
 
-	auto entry = make_shared<Entry>(interest);
+	ArenaAllocator<Entry> allocator(m_arena);
+	auto entry = std::allocate_shared<Entry>(allocator, interest, allocator);
 	nte->insertPitEntry(entry);
 	++m_nItems;
 	return {entry, true};
@@ -140,6 +126,17 @@ Pit::deleteInOutRecords(Entry* entry, const Face& face)
 	/// \todo decide whether to delete PIT entry if there's no more in/out-record left
 }
 
+void
+Pit::setArenaEnabled(bool isEnabled)
+{
+	if (!isEnabled) {
+		m_arena = nullptr;
+	}
+	else if (m_arena == nullptr) {
+		m_arena = make_shared<Arena>();
+	}
+}
+
 Pit::const_iterator
 Pit::begin() const
 {
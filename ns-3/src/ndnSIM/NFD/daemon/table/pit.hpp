@@ -97,6 +97,21 @@ public:
   void
   deleteInOutRecords(Entry* entry, const Face& face);
 
+  /** \brief sets whether new entries and their records are allocated from an Arena
+   *
+   *  Existing entries keep the memory they were allocated from.
+   */
+  void
+  setArenaEnabled(bool isEnabled);
+
+  /** \return the arena of new entries, or nullptr if entries are allocated from the system
+   */
+  shared_ptr<const Arena>
+  getArena() const
+  {
+    return m_arena;
+  }
+
 public: // enumeration
   typedef Iterator const_iterator;
 
@@ -135,6 +150,7 @@ private:
 private:
   NameTree& m_nameTree;
   size_t m_nItems;
+  shared_ptr<Arena> m_arena;
 };
 
 } // namespace pit
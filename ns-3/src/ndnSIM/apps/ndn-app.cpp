@@ -26,6 +26,8 @@
 #include "model/ndn-app-link-service.hpp"
 #include "model/null-transport.hpp"
 
+#include "ns3/ndnSIM/NFD/daemon/fw/forwarder.hpp"
+
 NS_LOG_COMPONENT_DEFINE("ndn.App");
 
 namespace ns3 {
@@ -158,6 +160,12 @@ App::StartApplication() // Called at time specified by Start
   GetNode()->GetObject<L3Protocol>()->addFace(m_face);
 }
 
+nfd::fw::SfcSelectionPolicy&
+App::GetSfcSelectionPolicy() const
+{
+  return GetNode()->GetObject<L3Protocol>()->getForwarder()->getSfcSelectionPolicy();
+}
+
 void
 App::StopApplication() // Called at time specified by Stop
 {
@@ -29,6 +29,12 @@
 #include "ns3/callback.h"
 #include "ns3/traced-callback.h"
 
+namespace nfd {
+namespace fw {
+class SfcSelectionPolicy;
+} // namespace fw
+} // namespace nfd
+
 namespace ns3 {
 
 class Packet;
@@ -99,6 +105,12 @@ protected:
   virtual void
   StopApplication(); ///< @brief Called at time specified by Stop
 
+  /**
+   * @brief Get SFC instance selection policy of the forwarder on this application's node
+   */
+  nfd::fw::SfcSelectionPolicy&
+  GetSfcSelectionPolicy() const;
+
 protected:
   bool m_active; ///< @brief Flag to indicate that application is active (set by StartApplication and StopApplication)
   shared_ptr<Face> m_face;
@@ -20,6 +20,8 @@
  **/
 
 #include "ndn-consumer-zipf-mandelbrot.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/sfc-selection-policy.hpp"
+#include "ns3/ndnSIM/utils/ndn-sfc-catalog.hpp"
 
 #include <math.h>
 
@@ -175,18 +177,14 @@ ConsumerZipfMandelbrot::SendPacket()
   ns3::increaseTotalSend();
 	//
 
-	//choose Function Type from 1 to 6
-	uint32_t functionType = ::ndn::random::generateWord32() % 12 + 1;
+	//choose Function Type from the request mix of the catalog
+	uint32_t functionType = m_catalog->DrawChainType(drawWord());
 
-	int currentNode = ns3::Simulator::GetContext();
-	//std::cout << "Consumer Node: " <<  currentNode << std::endl;
 	//std::cout << "function type:"  <<  functionType << std::endl;
 
-	//dijkstra
-	int sRoute[N];
 	//need to change
 	double weight = ns3::getWeight();
-	shared_ptr<Name> functionName = sourceRouting(functionType, currentNode, sRoute, weight);
+	shared_ptr<Name> functionName = sourceRouting(functionType, weight);
 
   ns3::increaseInterestNum();
 
@@ -200,14 +198,7 @@ ConsumerZipfMandelbrot::SendPacket()
 
   //ここから
   interest->setFunction(*functionName);
-	if(getChoiceType() == 2){
-		std::string headFunc = functionName->toUri();
-		int pos = headFunc.find("/",1);
-		headFunc.erase(pos, headFunc.size()-1);
-		Name headFuncName(headFunc);
-		shared_ptr<Name> headFuncNamePtr = make_shared<Name>(headFuncName);
-		interest->setFunctionFullName(*headFuncNamePtr);
-	}
+  GetSfcSelectionPolicy().beforeExpressInterest(*interest);
 
   time::milliseconds interestLifeTime(m_interestLifeTime.GetMilliSeconds());
 	//time::milliseconds interestLifeTime(1000);
@@ -223,6 +214,7 @@ ConsumerZipfMandelbrot::SendPacket()
   NS_LOG_DEBUG("Trying to add " << seq << " with " << Simulator::Now() << ". already "
                                 << m_seqTimeouts.size() << " items");
 
+  m_latencyRecorder.OnSend(seq, functionType);
   m_seqTimeouts.insert(SeqTimeout(seq, Simulator::Now()));
   m_seqFullDelay.insert(SeqTimeout(seq, Simulator::Now()));
 
@@ -18,6 +18,9 @@
  **/
 
 #include "ndn-consumer.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/sfc-selection-policy.hpp"
+#include "ns3/ndnSIM/utils/ndn-sfc-path-planner.hpp"
+#include "ns3/ndnSIM/utils/ndn-sfc-catalog.hpp"
 #include "ns3/ptr.h"
 #include "ns3/log.h"
 #include "ns3/simulator.h"
@@ -28,7 +31,6 @@
 #include "ns3/uinteger.h"
 #include "ns3/integer.h"
 #include "ns3/double.h"
-#include "util/random.hpp"
 #include "util/crypto.hpp"
 
 #include "utils/ndn-ns3-packet-tag.hpp"
@@ -36,11 +38,11 @@
 
 #include <ndn-cxx/lp/tags.hpp>
 
+#include <algorithm>
+
 #include <boost/lexical_cast.hpp>
 #include <boost/ref.hpp>
 
-#define N 39 //us24=26,Sinet,Geant=39
-
 NS_LOG_COMPONENT_DEFINE("ndn.Consumer");
 
 namespace ns3 {
@@ -88,13 +90,6 @@ Consumer::Consumer()
 , m_seqMax(0) // don't request anything
 {
 	NS_LOG_FUNCTION_NOARGS();
-	for(int i=0;i<2;i++){
-		for(int j=1;j<6;j++){
-			for(int k=0;k<3;k++){
-				table[i][j][k]=0;
-			}
-		}
-	}
 
 	m_rtt = CreateObject<RttMeanDeviation>();
 }
@@ -118,6 +113,12 @@ Consumer::GetRetxTimer() const
 	return m_retxTimer;
 }
 
+const SfcLatencyRecorder&
+Consumer::GetLatencyRecorder() const
+{
+	return m_latencyRecorder;
+}
+
 void
 Consumer::CheckRetxTimeout()
 {
@@ -151,6 +152,8 @@ Consumer::StartApplication() // Called at time specified by Start
 	// do base stuff
 	App::StartApplication();
 
+	m_catalog = SfcCatalog::Get();
+
 	ScheduleNextPacket();
 }
 
@@ -167,6543 +170,156 @@ Consumer::StopApplication() // Called at time specified by Stop
 }
 
 
-double
-Consumer::dijkstra(int sp, int dp, int sRoute[N], int functionType, int consumerNode, double weight, int flag){
-
-	double Distance[N][N];
-	double fcc1 = ns3::getFunctionCallCount(1) * weight;
-	double fcc2 = ns3::getFunctionCallCount(2) * weight;
-	double fcc3 = ns3::getFunctionCallCount(3) * weight;
-	double fcc4 = ns3::getFunctionCallCount(4) * weight;
-	double fcc5 = ns3::getFunctionCallCount(5) * weight;
-	double fcc6 = ns3::getFunctionCallCount(6) * weight;
-	double fcc7 = ns3::getFunctionCallCount(7) * weight;
-	double fcc8 = ns3::getFunctionCallCount(8) * weight;
-	double fcc9 = ns3::getFunctionCallCount(9) * weight;
-	double fcc10 = ns3::getFunctionCallCount(10) * weight;
-	double fcc11 = ns3::getFunctionCallCount(11) * weight;
-	double fcc12 = ns3::getFunctionCallCount(12) * weight;
-	double fcc13 = ns3::getFunctionCallCount(13) * weight;
-	double fcc14 = ns3::getFunctionCallCount(14) * weight;
-	double fcc15 = ns3::getFunctionCallCount(15) * weight;
-
-	double fcc1t = ns3::getTotalFcc(1) * weight;
-	double fcc2t = ns3::getTotalFcc(2) * weight;
-	double fcc3t = ns3::getTotalFcc(3) * weight;
-	double fcc4t = ns3::getTotalFcc(4) * weight;
-	double fcc5t = ns3::getTotalFcc(5) * weight;
-	double fcc6t = ns3::getTotalFcc(6) * weight;
-	double fcc7t = ns3::getTotalFcc(7) * weight;
-	double fcc8t = ns3::getTotalFcc(8) * weight;
-	double fcc9t = ns3::getTotalFcc(9) * weight;
-	double fcc10t = ns3::getTotalFcc(10) * weight;
-	double fcc11t = ns3::getTotalFcc(11) * weight;
-	double fcc12t = ns3::getTotalFcc(12) * weight;
-	double fcc13t = ns3::getTotalFcc(13) * weight;
-	double fcc14t = ns3::getTotalFcc(14) * weight;
-	double fcc15t = ns3::getTotalFcc(15) * weight;
-
-	for(int i = 0; i < N; i++) {
-		for(int j = 0; j < N; j++)
-			Distance[i][j] = -1;
-	}
-
-
-	for(int i = 0; i < N; i++)
-		Distance[i][i] = 0;
-
-
-	if(flag == 0){
-		//us-1
-		/*
-		if (consumerNode == 0){
-
-			//F1->F2->F4
-			if (functionType == 1) {
-				Distance[0][3] = 2 + fcc1;
-				Distance[0][10] = 3 + fcc2;
-				Distance[0][21] = 7 + fcc3;
-				Distance[3][7] = 1 + fcc4;
-				Distance[3][13] = 4 + fcc5;
-				Distance[3][23] = 6 + fcc6;
-				Distance[10][7] = 2 + fcc4;
-				Distance[10][13] = 1 + fcc5;
-				Distance[10][23] = 3 + fcc6;
-				Distance[21][7] = 5 + fcc4;
-				Distance[21][13] = 3 + fcc5;
-				Distance[21][23] = 2 + fcc6;
-				Distance[7][6] = 1 + fcc10;
-				Distance[7][9] = 2 + fcc11;
-				Distance[7][15] = 3 + fcc12;
-				Distance[13][6] = 3 + fcc10;
-				Distance[13][9] = 2 + fcc11;
-				Distance[13][15] = 3 + fcc12;
-				Distance[23][6] = 5 + fcc10;
-				Distance[23][9] = 4 + fcc11;
-				Distance[23][15] = 3 + fcc12;
-				Distance[6][25] = 2;
-				Distance[9][25] = 2;
-				Distance[15][25] = 2;
-			}
-
-			//F1->F2->F5
-			if (functionType == 2) {
-				Distance[0][3] = 2 + fcc1;
-				Distance[0][10] = 3 + fcc2;
-				Distance[0][21] = 7 + fcc3;
-				Distance[3][7] = 1 + fcc4;
-				Distance[3][13] = 4 + fcc5;
-				Distance[3][23] = 6 + fcc6;
-				Distance[10][7] = 2 + fcc4;
-				Distance[10][13] = 1 + fcc5;
-				Distance[10][23] = 3 + fcc6;
-				Distance[21][7] = 5 + fcc4;
-				Distance[21][13] = 3 + fcc5;
-				Distance[21][23] = 2 + fcc6;
-				Distance[7][2] = 2 + fcc13;
-				Distance[7][11] = 2 + fcc14;
-				Distance[7][20] = 4 + fcc15;
-				Distance[13][2] = 4 + fcc13;
-				Distance[13][11] = 2 + fcc14;
-				Distance[13][20] = 4 + fcc15;
-				Distance[23][2] = 6 + fcc13;
-				Distance[23][11] = 4 + fcc14;
-				Distance[23][20] = 3 + fcc15;
-				Distance[2][25] = 3;
-				Distance[11][25] = 1;
-				Distance[20][25] = 1;
-			}
-
-			//F2->F1->F4
-			if (functionType == 3) {
-				Distance[0][7] = 3 + fcc4;
-				Distance[0][13] = 4 + fcc5;
-				Distance[0][23] = 6 + fcc6;
-				Distance[7][3] = 1 + fcc1;
-				Distance[7][10] = 2 + fcc2;
-				Distance[7][21] = 5 + fcc3;
-				Distance[13][3] = 4 + fcc1;
-				Distance[13][10] = 1 + fcc2;
-				Distance[13][21] = 3 + fcc3;
-				Distance[23][3] = 6 + fcc1;
-				Distance[23][10] = 3 + fcc2;
-				Distance[23][21] = 2 + fcc3;
-				Distance[3][6] = 2 + fcc10;
-				Distance[3][9] = 3 + fcc11;
-				Distance[3][15] = 4 + fcc12;
-				Distance[10][6] = 2 + fcc10;
-				Distance[10][9] = 1 + fcc11;
-				Distance[10][15] = 3 + fcc12;
-				Distance[21][6] = 4 + fcc10;
-				Distance[21][9] = 3 + fcc11;
-				Distance[21][15] = 2 + fcc12;
-				Distance[6][25] = 2;
-				Distance[9][25] = 2;
-				Distance[15][25] = 2;
-			}
-
-			//F2->F1->F5
-			if (functionType == 4) {
-				Distance[0][7] = 3 + fcc4;
-				Distance[0][13] = 4 + fcc5;
-				Distance[0][23] = 6 + fcc6;
-				Distance[7][3] = 1 + fcc1;
-				Distance[7][10] = 2 + fcc2;
-				Distance[7][21] = 5 + fcc3;
-				Distance[13][3] = 4 + fcc1;
-				Distance[13][10] = 1 + fcc2;
-				Distance[13][21] = 3 + fcc3;
-				Distance[23][3] = 6 + fcc1;
-				Distance[23][10] = 3 + fcc2;
-				Distance[23][21] = 2 + fcc3;
-				Distance[3][2] = 1 + fcc13;
-				Distance[3][11] = 3 + fcc14;
-				Distance[3][20] = 5 + fcc15;
-				Distance[10][2] = 3 + fcc13;
-				Distance[10][11] = 2 + fcc14;
-				Distance[10][20] = 4 + fcc15;
-				Distance[21][2] = 5 + fcc13;
-				Distance[21][11] = 3 + fcc14;
-				Distance[21][20] = 1 + fcc15;
-				Distance[2][25] = 3;
-				Distance[11][25] = 1;
-				Distance[20][25] = 1;
-			}
-
-			//F1->F3->F4
-			if (functionType == 5) {
-				Distance[0][3] = 2 + fcc1;
-				Distance[0][10] = 3 + fcc2;
-				Distance[0][21] = 7 + fcc3;
-				Distance[3][4] = 1 + fcc7;
-				Distance[3][12] = 4 + fcc8;
-				Distance[3][17] = 5 + fcc9;
-				Distance[10][4] = 3 + fcc7;
-				Distance[10][12] = 2 + fcc8;
-				Distance[10][17] = 2 + fcc9;
-				Distance[21][4] = 6 + fcc7;
-				Distance[21][12] = 2 + fcc8;
-				Distance[21][17] = 2 + fcc9;
-				Distance[4][6] = 2 + fcc10;
-				Distance[4][9] = 3 + fcc11;
-				Distance[4][15] = 4 + fcc12;
-				Distance[12][6] = 2 + fcc10;
-				Distance[12][9] = 1 + fcc11;
-				Distance[12][15] = 2 + fcc12;
-				Distance[17][6] = 4 + fcc10;
-				Distance[17][9] = 3 + fcc11;
-				Distance[17][15] = 2 + fcc12;
-				Distance[6][25] = 2;
-				Distance[9][25] = 2;
-				Distance[15][25] = 2;
-			}
-
-			//F1->F3->F5
-			if (functionType == 6) {
-				Distance[0][3] = 2 + fcc1;
-				Distance[0][10] = 3 + fcc2;
-				Distance[0][21] = 7 + fcc3;
-				Distance[3][4] = 1 + fcc7;
-				Distance[3][12] = 4 + fcc8;
-				Distance[3][17] = 5 + fcc9;
-				Distance[10][4] = 3 + fcc7;
-				Distance[10][12] = 2 + fcc8;
-				Distance[10][17] = 2 + fcc9;
-				Distance[21][4] = 6 + fcc7;
-				Distance[21][12] = 2 + fcc8;
-				Distance[21][17] = 2 + fcc9;
-				Distance[4][2] = 2 + fcc13;
-				Distance[4][11] = 3 + fcc14;
-				Distance[4][20] = 5 + fcc15;
-				Distance[12][2] = 3 + fcc13;
-				Distance[12][11] = 1 + fcc14;
-				Distance[12][20] = 3 + fcc15;
-				Distance[17][2] = 5 + fcc13;
-				Distance[17][11] = 3 + fcc14;
-				Distance[17][20] = 3 + fcc15;
-				Distance[2][25] = 3;
-				Distance[11][25] = 1;
-				Distance[20][25] = 1;
-			}
-
-			//F3->F1->F4
-			if (functionType == 7) {
-				Distance[0][4] = 2 + fcc7;
-				Distance[0][12] = 5 + fcc8;
-				Distance[0][17] = 5 + fcc9;
-				Distance[4][3] = 1 + fcc1;
-				Distance[4][10] = 3 + fcc2;
-				Distance[4][21] = 6 + fcc3;
-				Distance[12][3] = 4 + fcc1;
-				Distance[12][10] = 2 + fcc2;
-				Distance[12][21] = 2 + fcc3;
-				Distance[17][3] = 5 + fcc1;
-				Distance[17][10] = 2 + fcc2;
-				Distance[17][21] = 2 + fcc3;
-				Distance[3][6] = 2 + fcc10;
-				Distance[3][9] = 3 + fcc11;
-				Distance[3][15] = 4 + fcc12;
-				Distance[10][6] = 2 + fcc10;
-				Distance[10][9] = 1 + fcc11;
-				Distance[10][15] = 3 + fcc12;
-				Distance[21][6] = 4 + fcc10;
-				Distance[21][9] = 3 + fcc11;
-				Distance[21][15] = 2 + fcc12;
-				Distance[6][25] = 2;
-				Distance[9][25] = 2;
-				Distance[15][25] = 2;
-			}
-
-			//F3->F1->F5
-			if (functionType == 8) {
-				Distance[0][4] = 2 + fcc7;
-				Distance[0][12] = 5 + fcc8;
-				Distance[0][17] = 5 + fcc9;
-				Distance[4][3] = 1 + fcc1;
-				Distance[4][10] = 3 + fcc2;
-				Distance[4][21] = 6 + fcc3;
-				Distance[12][3] = 4 + fcc1;
-				Distance[12][10] = 2 + fcc2;
-				Distance[12][21] = 2 + fcc3;
-				Distance[17][3] = 5 + fcc1;
-				Distance[17][10] = 2 + fcc2;
-				Distance[17][21] = 2 + fcc3;
-				Distance[3][2] = 1 + fcc13;
-				Distance[3][11] = 3 + fcc14;
-				Distance[3][20] = 5 + fcc15;
-				Distance[10][2] = 3 + fcc13;
-				Distance[10][11] = 2 + fcc14;
-				Distance[10][20] = 4 + fcc15;
-				Distance[21][2] = 5 + fcc13;
-				Distance[21][11] = 3 + fcc14;
-				Distance[21][20] = 1 + fcc15;
-				Distance[2][25] = 3;
-				Distance[11][25] = 1;
-				Distance[20][25] = 1;
-			}
-
-			//F2->F3->F4
-			if (functionType == 9) {
-				Distance[0][7] = 3 + fcc4;
-				Distance[0][13] = 4 + fcc5;
-				Distance[0][23] = 6 + fcc6;
-				Distance[7][4] = 1 + fcc7;
-				Distance[7][12] = 3 + fcc8;
-				Distance[7][17] = 4 + fcc9;
-				Distance[13][4] = 4 + fcc7;
-				Distance[13][12] = 1 + fcc8;
-				Distance[13][17] = 1 + fcc9;
-				Distance[23][4] = 6 + fcc7;
-				Distance[23][12] = 3 + fcc8;
-				Distance[23][17] = 1 + fcc9;
-				Distance[4][6] = 2 + fcc10;
-				Distance[4][9] = 3 + fcc11;
-				Distance[4][15] = 4 + fcc12;
-				Distance[12][6] = 2 + fcc10;
-				Distance[12][9] = 1 + fcc11;
-				Distance[12][15] = 2 + fcc12;
-				Distance[17][6] = 4 + fcc10;
-				Distance[17][9] = 3 + fcc11;
-				Distance[17][15] = 2 + fcc12;
-				Distance[6][25] = 2;
-				Distance[9][25] = 2;
-				Distance[15][25] = 2;
-			}
-
-			//F2->F3->F5
-			if (functionType == 10) {
-				Distance[0][7] = 3 + fcc4;
-				Distance[0][13] = 4 + fcc5;
-				Distance[0][23] = 6 + fcc6;
-				Distance[7][4] = 1 + fcc7;
-				Distance[7][12] = 3 + fcc8;
-				Distance[7][17] = 4 + fcc9;
-				Distance[13][4] = 4 + fcc7;
-				Distance[13][12] = 1 + fcc8;
-				Distance[13][17] = 1 + fcc9;
-				Distance[23][4] = 6 + fcc7;
-				Distance[23][12] = 3 + fcc8;
-				Distance[23][17] = 1 + fcc9;
-				Distance[4][2] = 2 + fcc13;
-				Distance[4][11] = 3 + fcc14;
-				Distance[4][20] = 5 + fcc15;
-				Distance[12][2] = 3 + fcc13;
-				Distance[12][11] = 1 + fcc14;
-				Distance[12][20] = 3 + fcc15;
-				Distance[17][2] = 5 + fcc13;
-				Distance[17][11] = 3 + fcc14;
-				Distance[17][20] = 3 + fcc15;
-				Distance[2][25] = 3;
-				Distance[11][25] = 1;
-				Distance[20][25] = 1;
-			}
-
-			//F3->F2->F4
-			if (functionType == 11) {
-				Distance[0][4] = 2 + fcc4;
-				Distance[0][12] = 5 + fcc5;
-				Distance[0][17] = 5 + fcc6;
-				Distance[4][7] = 2 + fcc7;
-				Distance[4][13] = 3 + fcc8;
-				Distance[4][23] = 4 + fcc9;
-				Distance[12][7] = 3 + fcc7;
-				Distance[12][13] = 1 + fcc8;
-				Distance[12][23] = 3 + fcc9;
-				Distance[17][7] = 4 + fcc7;
-				Distance[17][13] = 1 + fcc8;
-				Distance[17][23] = 1 + fcc9;
-				Distance[7][6] = 1 + fcc10;
-				Distance[7][9] = 2 + fcc11;
-				Distance[7][15] = 3 + fcc12;
-				Distance[13][6] = 3 + fcc10;
-				Distance[13][9] = 2 + fcc11;
-				Distance[13][15] = 3 + fcc12;
-				Distance[23][6] = 5 + fcc10;
-				Distance[23][9] = 4 + fcc11;
-				Distance[23][15] = 3 + fcc12;
-				Distance[6][25] = 2;
-				Distance[9][25] = 2;
-				Distance[15][25] = 2;
-			}
-
-			//F3->F2->F5
-			if (functionType == 12) {
-				Distance[0][4] = 2 + fcc4;
-				Distance[0][12] = 5 + fcc5;
-				Distance[0][17] = 5 + fcc6;
-				Distance[4][7] = 1 + fcc7;
-				Distance[4][13] = 4 + fcc8;
-				Distance[4][23] = 6 + fcc9;
-				Distance[12][7] = 3 + fcc7;
-				Distance[12][13] = 1 + fcc8;
-				Distance[12][23] = 3 + fcc9;
-				Distance[17][7] = 4 + fcc7;
-				Distance[17][13] = 1 + fcc8;
-				Distance[17][23] = 1 + fcc9;
-				Distance[7][2] = 2 + fcc13;
-				Distance[7][11] = 2 + fcc14;
-				Distance[7][20] = 4 + fcc15;
-				Distance[13][2] = 4 + fcc13;
-				Distance[13][11] = 2 + fcc14;
-				Distance[13][20] = 4 + fcc15;
-				Distance[23][2] = 6 + fcc13;
-				Distance[23][11] = 4 + fcc14;
-				Distance[23][20] = 3 + fcc15;
-				Distance[2][25] = 3;
-				Distance[11][25] = 1;
-				Distance[20][25] = 1;
-			}
-
-		}
-
-		if (consumerNode == 41){
-
-			//F1->F2->F4
-			if (functionType == 1) {
-				Distance[0][3] = 3 + fcc1;
-				Distance[0][10] = 2 + fcc2;
-				Distance[0][21] = 6 + fcc3;
-				Distance[3][7] = 1 + fcc4;
-				Distance[3][13] = 4 + fcc5;
-				Distance[3][23] = 6 + fcc6;
-				Distance[10][7] = 2 + fcc4;
-				Distance[10][13] = 1 + fcc5;
-				Distance[10][23] = 3 + fcc6;
-				Distance[21][7] = 5 + fcc4;
-				Distance[21][13] = 3 + fcc5;
-				Distance[21][23] = 2 + fcc6;
-				Distance[7][6] = 1 + fcc10;
-				Distance[7][9] = 2 + fcc11;
-				Distance[7][15] = 3 + fcc12;
-				Distance[13][6] = 3 + fcc10;
-				Distance[13][9] = 2 + fcc11;
-				Distance[13][15] = 3 + fcc12;
-				Distance[23][6] = 5 + fcc10;
-				Distance[23][9] = 4 + fcc11;
-				Distance[23][15] = 3 + fcc12;
-				Distance[6][25] = 2;
-				Distance[9][25] = 2;
-				Distance[15][25] = 2;
-			}
-
-			//F1->F2->F5
-			if (functionType == 2) {
-				Distance[0][3] = 3 + fcc1;
-				Distance[0][10] = 2 + fcc2;
-				Distance[0][21] = 6 + fcc3;
-				Distance[3][7] = 1 + fcc4;
-				Distance[3][13] = 4 + fcc5;
-				Distance[3][23] = 6 + fcc6;
-				Distance[10][7] = 2 + fcc4;
-				Distance[10][13] = 1 + fcc5;
-				Distance[10][23] = 3 + fcc6;
-				Distance[21][7] = 5 + fcc4;
-				Distance[21][13] = 3 + fcc5;
-				Distance[21][23] = 2 + fcc6;
-				Distance[7][2] = 2 + fcc13;
-				Distance[7][11] = 2 + fcc14;
-				Distance[7][20] = 4 + fcc15;
-				Distance[13][2] = 4 + fcc13;
-				Distance[13][11] = 2 + fcc14;
-				Distance[13][20] = 4 + fcc15;
-				Distance[23][2] = 6 + fcc13;
-				Distance[23][11] = 4 + fcc14;
-				Distance[23][20] = 3 + fcc15;
-				Distance[2][25] = 3;
-				Distance[11][25] = 1;
-				Distance[20][25] = 1;
-			}
-
-			//F2->F1->F4
-			if (functionType == 3) {
-				Distance[0][7] = 2 + fcc4;
-				Distance[0][13] = 3 + fcc5;
-				Distance[0][23] = 5 + fcc6;
-				Distance[7][3] = 1 + fcc1;
-				Distance[7][10] = 2 + fcc2;
-				Distance[7][21] = 5 + fcc3;
-				Distance[13][3] = 4 + fcc1;
-				Distance[13][10] = 1 + fcc2;
-				Distance[13][21] = 3 + fcc3;
-				Distance[23][3] = 6 + fcc1;
-				Distance[23][10] = 3 + fcc2;
-				Distance[23][21] = 2 + fcc3;
-				Distance[3][6] = 2 + fcc10;
-				Distance[3][9] = 3 + fcc11;
-				Distance[3][15] = 4 + fcc12;
-				Distance[10][6] = 2 + fcc10;
-				Distance[10][9] = 1 + fcc11;
-				Distance[10][15] = 3 + fcc12;
-				Distance[21][6] = 4 + fcc10;
-				Distance[21][9] = 3 + fcc11;
-				Distance[21][15] = 2 + fcc12;
-				Distance[6][25] = 2;
-				Distance[9][25] = 2;
-				Distance[15][25] = 2;
-			}
-
-			//F2->F1->F5
-			if (functionType == 4) {
-				Distance[0][7] = 2 + fcc4;
-				Distance[0][13] = 3 + fcc5;
-				Distance[0][23] = 5 + fcc6;
-				Distance[7][3] = 1 + fcc1;
-				Distance[7][10] = 2 + fcc2;
-				Distance[7][21] = 5 + fcc3;
-				Distance[13][3] = 4 + fcc1;
-				Distance[13][10] = 1 + fcc2;
-				Distance[13][21] = 3 + fcc3;
-				Distance[23][3] = 6 + fcc1;
-				Distance[23][10] = 3 + fcc2;
-				Distance[23][21] = 2 + fcc3;
-				Distance[3][2] = 1 + fcc13;
-				Distance[3][11] = 3 + fcc14;
-				Distance[3][20] = 5 + fcc15;
-				Distance[10][2] = 3 + fcc13;
-				Distance[10][11] = 2 + fcc14;
-				Distance[10][20] = 4 + fcc15;
-				Distance[21][2] = 5 + fcc13;
-				Distance[21][11] = 3 + fcc14;
-				Distance[21][20] = 1 + fcc15;
-				Distance[2][25] = 3;
-				Distance[11][25] = 1;
-				Distance[20][25] = 1;
-			}
-
-			//F1->F3->F4
-			if (functionType == 5) {
-				Distance[0][3] = 3 + fcc1;
-				Distance[0][10] = 2 + fcc2;
-				Distance[0][21] = 6 + fcc3;
-				Distance[3][4] = 1 + fcc7;
-				Distance[3][12] = 4 + fcc8;
-				Distance[3][17] = 5 + fcc9;
-				Distance[10][4] = 3 + fcc7;
-				Distance[10][12] = 2 + fcc8;
-				Distance[10][17] = 2 + fcc9;
-				Distance[21][4] = 6 + fcc7;
-				Distance[21][12] = 2 + fcc8;
-				Distance[21][17] = 2 + fcc9;
-				Distance[4][6] = 2 + fcc10;
-				Distance[4][9] = 3 + fcc11;
-				Distance[4][15] = 4 + fcc12;
-				Distance[12][6] = 2 + fcc10;
-				Distance[12][9] = 1 + fcc11;
-				Distance[12][15] = 2 + fcc12;
-				Distance[17][6] = 4 + fcc10;
-				Distance[17][9] = 3 + fcc11;
-				Distance[17][15] = 2 + fcc12;
-				Distance[6][25] = 2;
-				Distance[9][25] = 2;
-				Distance[15][25] = 2;
-			}
-
-			//F1->F3->F5
-			if (functionType == 6) {
-				Distance[0][3] = 3 + fcc1;
-				Distance[0][10] = 2 + fcc2;
-				Distance[0][21] = 6 + fcc3;
-				Distance[3][4] = 1 + fcc7;
-				Distance[3][12] = 4 + fcc8;
-				Distance[3][17] = 5 + fcc9;
-				Distance[10][4] = 3 + fcc7;
-				Distance[10][12] = 2 + fcc8;
-				Distance[10][17] = 2 + fcc9;
-				Distance[21][4] = 6 + fcc7;
-				Distance[21][12] = 2 + fcc8;
-				Distance[21][17] = 2 + fcc9;
-				Distance[4][2] = 2 + fcc13;
-				Distance[4][11] = 3 + fcc14;
-				Distance[4][20] = 5 + fcc15;
-				Distance[12][2] = 3 + fcc13;
-				Distance[12][11] = 1 + fcc14;
-				Distance[12][20] = 3 + fcc15;
-				Distance[17][2] = 5 + fcc13;
-				Distance[17][11] = 3 + fcc14;
-				Distance[17][20] = 3 + fcc15;
-				Distance[2][25] = 3;
-				Distance[11][25] = 1;
-				Distance[20][25] = 1;
-			}
-
-			//F3->F1->F4
-			if (functionType == 7) {
-				Distance[0][4] = 3 + fcc7;
-				Distance[0][12] = 4 + fcc8;
-				Distance[0][17] = 4 + fcc9;
-				Distance[4][3] = 1 + fcc1;
-				Distance[4][10] = 3 + fcc2;
-				Distance[4][21] = 6 + fcc3;
-				Distance[12][3] = 4 + fcc1;
-				Distance[12][10] = 2 + fcc2;
-				Distance[12][21] = 2 + fcc3;
-				Distance[17][3] = 5 + fcc1;
-				Distance[17][10] = 2 + fcc2;
-				Distance[17][21] = 2 + fcc3;
-				Distance[3][6] = 2 + fcc10;
-				Distance[3][9] = 3 + fcc11;
-				Distance[3][15] = 4 + fcc12;
-				Distance[10][6] = 2 + fcc10;
-				Distance[10][9] = 1 + fcc11;
-				Distance[10][15] = 3 + fcc12;
-				Distance[21][6] = 4 + fcc10;
-				Distance[21][9] = 3 + fcc11;
-				Distance[21][15] = 2 + fcc12;
-				Distance[6][25] = 2;
-				Distance[9][25] = 2;
-				Distance[15][25] = 2;
-			}
-
-			//F3->F1->F5
-			if (functionType == 8) {
-				Distance[0][4] = 3 + fcc7;
-				Distance[0][12] = 4 + fcc8;
-				Distance[0][17] = 4 + fcc9;
-				Distance[4][3] = 1 + fcc1;
-				Distance[4][10] = 3 + fcc2;
-				Distance[4][21] = 6 + fcc3;
-				Distance[12][3] = 4 + fcc1;
-				Distance[12][10] = 2 + fcc2;
-				Distance[12][21] = 2 + fcc3;
-				Distance[17][3] = 5 + fcc1;
-				Distance[17][10] = 2 + fcc2;
-				Distance[17][21] = 2 + fcc3;
-				Distance[3][2] = 1 + fcc13;
-				Distance[3][11] = 3 + fcc14;
-				Distance[3][20] = 5 + fcc15;
-				Distance[10][2] = 3 + fcc13;
-				Distance[10][11] = 2 + fcc14;
-				Distance[10][20] = 4 + fcc15;
-				Distance[21][2] = 5 + fcc13;
-				Distance[21][11] = 3 + fcc14;
-				Distance[21][20] = 1 + fcc15;
-				Distance[2][25] = 3;
-				Distance[11][25] = 1;
-				Distance[20][25] = 1;
-			}
-
-			//F2->F3->F4
-			if (functionType == 9) {
-				Distance[0][7] = 2 + fcc4;
-				Distance[0][13] = 3 + fcc5;
-				Distance[0][23] = 5 + fcc6;
-				Distance[7][4] = 1 + fcc7;
-				Distance[7][12] = 3 + fcc8;
-				Distance[7][17] = 4 + fcc9;
-				Distance[13][4] = 4 + fcc7;
-				Distance[13][12] = 1 + fcc8;
-				Distance[13][17] = 1 + fcc9;
-				Distance[23][4] = 6 + fcc7;
-				Distance[23][12] = 3 + fcc8;
-				Distance[23][17] = 1 + fcc9;
-				Distance[4][6] = 2 + fcc10;
-				Distance[4][9] = 3 + fcc11;
-				Distance[4][15] = 4 + fcc12;
-				Distance[12][6] = 2 + fcc10;
-				Distance[12][9] = 1 + fcc11;
-				Distance[12][15] = 2 + fcc12;
-				Distance[17][6] = 4 + fcc10;
-				Distance[17][9] = 3 + fcc11;
-				Distance[17][15] = 2 + fcc12;
-				Distance[6][25] = 2;
-				Distance[9][25] = 2;
-				Distance[15][25] = 2;
-			}
-
-			//F2->F3->F5
-			if (functionType == 10) {
-				Distance[0][7] = 2 + fcc4;
-				Distance[0][13] = 3 + fcc5;
-				Distance[0][23] = 5 + fcc6;
-				Distance[7][4] = 1 + fcc7;
-				Distance[7][12] = 3 + fcc8;
-				Distance[7][17] = 4 + fcc9;
-				Distance[13][4] = 4 + fcc7;
-				Distance[13][12] = 1 + fcc8;
-				Distance[13][17] = 1 + fcc9;
-				Distance[23][4] = 6 + fcc7;
-				Distance[23][12] = 3 + fcc8;
-				Distance[23][17] = 1 + fcc9;
-				Distance[4][2] = 2 + fcc13;
-				Distance[4][11] = 3 + fcc14;
-				Distance[4][20] = 5 + fcc15;
-				Distance[12][2] = 3 + fcc13;
-				Distance[12][11] = 1 + fcc14;
-				Distance[12][20] = 3 + fcc15;
-				Distance[17][2] = 5 + fcc13;
-				Distance[17][11] = 3 + fcc14;
-				Distance[17][20] = 3 + fcc15;
-				Distance[2][25] = 3;
-				Distance[11][25] = 1;
-				Distance[20][25] = 1;
-			}
-
-			//F3->F2->F4
-			if (functionType == 11) {
-				Distance[0][4] = 3 + fcc4;
-				Distance[0][12] = 4 + fcc5;
-				Distance[0][17] = 4 + fcc6;
-				Distance[4][7] = 2 + fcc7;
-				Distance[4][13] = 3 + fcc8;
-				Distance[4][23] = 4 + fcc9;
-				Distance[12][7] = 3 + fcc7;
-				Distance[12][13] = 1 + fcc8;
-				Distance[12][23] = 3 + fcc9;
-				Distance[17][7] = 4 + fcc7;
-				Distance[17][13] = 1 + fcc8;
-				Distance[17][23] = 1 + fcc9;
-				Distance[7][6] = 1 + fcc10;
-				Distance[7][9] = 2 + fcc11;
-				Distance[7][15] = 3 + fcc12;
-				Distance[13][6] = 3 + fcc10;
-				Distance[13][9] = 2 + fcc11;
-				Distance[13][15] = 3 + fcc12;
-				Distance[23][6] = 5 + fcc10;
-				Distance[23][9] = 4 + fcc11;
-				Distance[23][15] = 3 + fcc12;
-				Distance[6][25] = 2;
-				Distance[9][25] = 2;
-				Distance[15][25] = 2;
-			}
-
-			//F3->F2->F5
-			if (functionType == 12) {
-				Distance[0][4] = 3 + fcc4;
-				Distance[0][12] = 4 + fcc5;
-				Distance[0][17] = 4 + fcc6;
-				Distance[4][7] = 1 + fcc7;
-				Distance[4][13] = 4 + fcc8;
-				Distance[4][23] = 6 + fcc9;
-				Distance[12][7] = 3 + fcc7;
-				Distance[12][13] = 1 + fcc8;
-				Distance[12][23] = 3 + fcc9;
-				Distance[17][7] = 4 + fcc7;
-				Distance[17][13] = 1 + fcc8;
-				Distance[17][23] = 1 + fcc9;
-				Distance[7][2] = 2 + fcc13;
-				Distance[7][11] = 2 + fcc14;
-				Distance[7][20] = 4 + fcc15;
-				Distance[13][2] = 4 + fcc13;
-				Distance[13][11] = 2 + fcc14;
-				Distance[13][20] = 4 + fcc15;
-				Distance[23][2] = 6 + fcc13;
-				Distance[23][11] = 4 + fcc14;
-				Distance[23][20] = 3 + fcc15;
-				Distance[2][25] = 3;
-				Distance[11][25] = 1;
-				Distance[20][25] = 1;
-			}
-
-		}
-
-		if (consumerNode == 42){
-
-			//F1->F2->F4
-			if (functionType == 1) {
-				Distance[0][3] = 7 + fcc1;
-				Distance[0][10] = 4 + fcc2;
-				Distance[0][21] = 4 + fcc3;
-				Distance[3][7] = 1 + fcc4;
-				Distance[3][13] = 4 + fcc5;
-				Distance[3][23] = 6 + fcc6;
-				Distance[10][7] = 2 + fcc4;
-				Distance[10][13] = 1 + fcc5;
-				Distance[10][23] = 3 + fcc6;
-				Distance[21][7] = 5 + fcc4;
-				Distance[21][13] = 3 + fcc5;
-				Distance[21][23] = 2 + fcc6;
-				Distance[7][6] = 1 + fcc10;
-				Distance[7][9] = 2 + fcc11;
-				Distance[7][15] = 3 + fcc12;
-				Distance[13][6] = 3 + fcc10;
-				Distance[13][9] = 2 + fcc11;
-				Distance[13][15] = 3 + fcc12;
-				Distance[23][6] = 5 + fcc10;
-				Distance[23][9] = 4 + fcc11;
-				Distance[23][15] = 3 + fcc12;
-				Distance[6][25] = 1;
-				Distance[9][25] = 2;
-				Distance[15][25] = 3;
-			}
-
-			//F1->F2->F5
-			if (functionType == 2) {
-				Distance[0][3] = 7 + fcc1;
-				Distance[0][10] = 4 + fcc2;
-				Distance[0][21] = 4 + fcc3;
-				Distance[3][7] = 1 + fcc4;
-				Distance[3][13] = 4 + fcc5;
-				Distance[3][23] = 6 + fcc6;
-				Distance[10][7] = 2 + fcc4;
-				Distance[10][13] = 1 + fcc5;
-				Distance[10][23] = 3 + fcc6;
-				Distance[21][7] = 5 + fcc4;
-				Distance[21][13] = 3 + fcc5;
-				Distance[21][23] = 2 + fcc6;
-				Distance[7][2] = 2 + fcc13;
-				Distance[7][11] = 2 + fcc14;
-				Distance[7][20] = 4 + fcc15;
-				Distance[13][2] = 4 + fcc13;
-				Distance[13][11] = 2 + fcc14;
-				Distance[13][20] = 4 + fcc15;
-				Distance[23][2] = 6 + fcc13;
-				Distance[23][11] = 4 + fcc14;
-				Distance[23][20] = 3 + fcc15;
-				Distance[2][25] = 1;
-				Distance[11][25] = 2;
-				Distance[20][25] = 4;
-			}
-
-			//F2->F1->F4
-			if (functionType == 3) {
-				Distance[0][7] = 6 + fcc4;
-				Distance[0][13] = 4 + fcc5;
-				Distance[0][23] = 2 + fcc6;
-				Distance[7][3] = 1 + fcc1;
-				Distance[7][10] = 2 + fcc2;
-				Distance[7][21] = 5 + fcc3;
-				Distance[13][3] = 4 + fcc1;
-				Distance[13][10] = 1 + fcc2;
-				Distance[13][21] = 3 + fcc3;
-				Distance[23][3] = 6 + fcc1;
-				Distance[23][10] = 3 + fcc2;
-				Distance[23][21] = 2 + fcc3;
-				Distance[3][6] = 2 + fcc10;
-				Distance[3][9] = 3 + fcc11;
-				Distance[3][15] = 4 + fcc12;
-				Distance[10][6] = 2 + fcc10;
-				Distance[10][9] = 1 + fcc11;
-				Distance[10][15] = 3 + fcc12;
-				Distance[21][6] = 4 + fcc10;
-				Distance[21][9] = 3 + fcc11;
-				Distance[21][15] = 2 + fcc12;
-				Distance[6][25] = 1;
-				Distance[9][25] = 2;
-				Distance[15][25] = 3;
-			}
-
-			//F2->F1->F5
-			if (functionType == 4) {
-				Distance[0][7] = 6 + fcc4;
-				Distance[0][13] = 4 + fcc5;
-				Distance[0][23] = 2 + fcc6;
-				Distance[7][3] = 1 + fcc1;
-				Distance[7][10] = 2 + fcc2;
-				Distance[7][21] = 5 + fcc3;
-				Distance[13][3] = 4 + fcc1;
-				Distance[13][10] = 1 + fcc2;
-				Distance[13][21] = 3 + fcc3;
-				Distance[23][3] = 6 + fcc1;
-				Distance[23][10] = 3 + fcc2;
-				Distance[23][21] = 2 + fcc3;
-				Distance[3][2] = 1 + fcc13;
-				Distance[3][11] = 3 + fcc14;
-				Distance[3][20] = 5 + fcc15;
-				Distance[10][2] = 3 + fcc13;
-				Distance[10][11] = 2 + fcc14;
-				Distance[10][20] = 4 + fcc15;
-				Distance[21][2] = 5 + fcc13;
-				Distance[21][11] = 3 + fcc14;
-				Distance[21][20] = 1 + fcc15;
-				Distance[2][25] = 1;
-				Distance[11][25] = 2;
-				Distance[20][25] = 4;
-			}
-
-			//F1->F3->F4
-			if (functionType == 5) {
-				Distance[0][3] = 7 + fcc1;
-				Distance[0][10] = 4 + fcc2;
-				Distance[0][21] = 4 + fcc3;
-				Distance[3][4] = 1 + fcc7;
-				Distance[3][12] = 4 + fcc8;
-				Distance[3][17] = 5 + fcc9;
-				Distance[10][4] = 3 + fcc7;
-				Distance[10][12] = 2 + fcc8;
-				Distance[10][17] = 2 + fcc9;
-				Distance[21][4] = 6 + fcc7;
-				Distance[21][12] = 2 + fcc8;
-				Distance[21][17] = 2 + fcc9;
-				Distance[4][6] = 2 + fcc10;
-				Distance[4][9] = 3 + fcc11;
-				Distance[4][15] = 4 + fcc12;
-				Distance[12][6] = 2 + fcc10;
-				Distance[12][9] = 1 + fcc11;
-				Distance[12][15] = 2 + fcc12;
-				Distance[17][6] = 4 + fcc10;
-				Distance[17][9] = 3 + fcc11;
-				Distance[17][15] = 2 + fcc12;
-				Distance[6][25] = 1;
-				Distance[9][25] = 2;
-				Distance[15][25] = 3;
-			}
-
-			//F1->F3->F5
-			if (functionType == 6) {
-				Distance[0][3] = 7 + fcc1;
-				Distance[0][10] = 4 + fcc2;
-				Distance[0][21] = 4 + fcc3;
-				Distance[3][4] = 1 + fcc7;
-				Distance[3][12] = 4 + fcc8;
-				Distance[3][17] = 5 + fcc9;
-				Distance[10][4] = 3 + fcc7;
-				Distance[10][12] = 2 + fcc8;
-				Distance[10][17] = 2 + fcc9;
-				Distance[21][4] = 6 + fcc7;
-				Distance[21][12] = 2 + fcc8;
-				Distance[21][17] = 2 + fcc9;
-				Distance[4][2] = 2 + fcc13;
-				Distance[4][11] = 3 + fcc14;
-				Distance[4][20] = 5 + fcc15;
-				Distance[12][2] = 3 + fcc13;
-				Distance[12][11] = 1 + fcc14;
-				Distance[12][20] = 3 + fcc15;
-				Distance[17][2] = 5 + fcc13;
-				Distance[17][11] = 3 + fcc14;
-				Distance[17][20] = 3 + fcc15;
-				Distance[2][25] = 1;
-				Distance[11][25] = 2;
-				Distance[20][25] = 4;
-			}
-
-			//F3->F1->F4
-			if (functionType == 7) {
-				Distance[0][4] = 7 + fcc7;
-				Distance[0][12] = 5 + fcc8;
-				Distance[0][17] = 3 + fcc9;
-				Distance[4][3] = 1 + fcc1;
-				Distance[4][10] = 3 + fcc2;
-				Distance[4][21] = 6 + fcc3;
-				Distance[12][3] = 4 + fcc1;
-				Distance[12][10] = 2 + fcc2;
-				Distance[12][21] = 2 + fcc3;
-				Distance[17][3] = 5 + fcc1;
-				Distance[17][10] = 2 + fcc2;
-				Distance[17][21] = 2 + fcc3;
-				Distance[3][6] = 2 + fcc10;
-				Distance[3][9] = 3 + fcc11;
-				Distance[3][15] = 4 + fcc12;
-				Distance[10][6] = 2 + fcc10;
-				Distance[10][9] = 1 + fcc11;
-				Distance[10][15] = 3 + fcc12;
-				Distance[21][6] = 4 + fcc10;
-				Distance[21][9] = 3 + fcc11;
-				Distance[21][15] = 2 + fcc12;
-				Distance[6][25] = 1;
-				Distance[9][25] = 2;
-				Distance[15][25] = 3;
-			}
-
-			//F3->F1->F5
-			if (functionType == 8) {
-				Distance[0][4] = 7 + fcc7;
-				Distance[0][12] = 5 + fcc8;
-				Distance[0][17] = 3 + fcc9;
-				Distance[4][3] = 1 + fcc1;
-				Distance[4][10] = 3 + fcc2;
-				Distance[4][21] = 6 + fcc3;
-				Distance[12][3] = 4 + fcc1;
-				Distance[12][10] = 2 + fcc2;
-				Distance[12][21] = 2 + fcc3;
-				Distance[17][3] = 5 + fcc1;
-				Distance[17][10] = 2 + fcc2;
-				Distance[17][21] = 2 + fcc3;
-				Distance[3][2] = 1 + fcc13;
-				Distance[3][11] = 3 + fcc14;
-				Distance[3][20] = 5 + fcc15;
-				Distance[10][2] = 3 + fcc13;
-				Distance[10][11] = 2 + fcc14;
-				Distance[10][20] = 4 + fcc15;
-				Distance[21][2] = 5 + fcc13;
-				Distance[21][11] = 3 + fcc14;
-				Distance[21][20] = 1 + fcc15;
-				Distance[2][25] = 1;
-				Distance[11][25] = 2;
-				Distance[20][25] = 4;
-			}
-
-			//F2->F3->F4
-			if (functionType == 9) {
-				Distance[0][7] = 6 + fcc4;
-				Distance[0][13] = 4 + fcc5;
-				Distance[0][23] = 2 + fcc6;
-				Distance[7][4] = 1 + fcc7;
-				Distance[7][12] = 3 + fcc8;
-				Distance[7][17] = 4 + fcc9;
-				Distance[13][4] = 4 + fcc7;
-				Distance[13][12] = 1 + fcc8;
-				Distance[13][17] = 1 + fcc9;
-				Distance[23][4] = 6 + fcc7;
-				Distance[23][12] = 3 + fcc8;
-				Distance[23][17] = 1 + fcc9;
-				Distance[4][6] = 2 + fcc10;
-				Distance[4][9] = 3 + fcc11;
-				Distance[4][15] = 4 + fcc12;
-				Distance[12][6] = 2 + fcc10;
-				Distance[12][9] = 1 + fcc11;
-				Distance[12][15] = 2 + fcc12;
-				Distance[17][6] = 4 + fcc10;
-				Distance[17][9] = 3 + fcc11;
-				Distance[17][15] = 2 + fcc12;
-				Distance[6][25] = 1;
-				Distance[9][25] = 2;
-				Distance[15][25] = 3;
-			}
-
-			//F2->F3->F5
-			if (functionType == 10) {
-				Distance[0][7] = 6 + fcc4;
-				Distance[0][13] = 4 + fcc5;
-				Distance[0][23] = 2 + fcc6;
-				Distance[7][4] = 1 + fcc7;
-				Distance[7][12] = 3 + fcc8;
-				Distance[7][17] = 4 + fcc9;
-				Distance[13][4] = 4 + fcc7;
-				Distance[13][12] = 1 + fcc8;
-				Distance[13][17] = 1 + fcc9;
-				Distance[23][4] = 6 + fcc7;
-				Distance[23][12] = 3 + fcc8;
-				Distance[23][17] = 1 + fcc9;
-				Distance[4][2] = 2 + fcc13;
-				Distance[4][11] = 3 + fcc14;
-				Distance[4][20] = 5 + fcc15;
-				Distance[12][2] = 3 + fcc13;
-				Distance[12][11] = 1 + fcc14;
-				Distance[12][20] = 3 + fcc15;
-				Distance[17][2] = 5 + fcc13;
-				Distance[17][11] = 3 + fcc14;
-				Distance[17][20] = 3 + fcc15;
-				Distance[2][25] = 1;
-				Distance[11][25] = 2;
-				Distance[20][25] = 4;
-			}
-
-			//F3->F2->F4
-			if (functionType == 11) {
-				Distance[0][4] = 7 + fcc4;
-				Distance[0][12] = 5 + fcc5;
-				Distance[0][17] = 3 + fcc6;
-				Distance[4][7] = 2 + fcc7;
-				Distance[4][13] = 3 + fcc8;
-				Distance[4][23] = 4 + fcc9;
-				Distance[12][7] = 3 + fcc7;
-				Distance[12][13] = 1 + fcc8;
-				Distance[12][23] = 3 + fcc9;
-				Distance[17][7] = 4 + fcc7;
-				Distance[17][13] = 1 + fcc8;
-				Distance[17][23] = 1 + fcc9;
-				Distance[7][6] = 1 + fcc10;
-				Distance[7][9] = 2 + fcc11;
-				Distance[7][15] = 3 + fcc12;
-				Distance[13][6] = 3 + fcc10;
-				Distance[13][9] = 2 + fcc11;
-				Distance[13][15] = 3 + fcc12;
-				Distance[23][6] = 5 + fcc10;
-				Distance[23][9] = 4 + fcc11;
-				Distance[23][15] = 3 + fcc12;
-				Distance[6][25] = 1;
-				Distance[9][25] = 2;
-				Distance[15][25] = 3;
-			}
-
-			//F3->F2->F5
-			if (functionType == 12) {
-				Distance[0][4] = 7 + fcc4;
-				Distance[0][12] = 5 + fcc5;
-				Distance[0][17] = 3 + fcc6;
-				Distance[4][7] = 1 + fcc7;
-				Distance[4][13] = 4 + fcc8;
-				Distance[4][23] = 6 + fcc9;
-				Distance[12][7] = 3 + fcc7;
-				Distance[12][13] = 1 + fcc8;
-				Distance[12][23] = 3 + fcc9;
-				Distance[17][7] = 4 + fcc7;
-				Distance[17][13] = 1 + fcc8;
-				Distance[17][23] = 1 + fcc9;
-				Distance[7][2] = 2 + fcc13;
-				Distance[7][11] = 2 + fcc14;
-				Distance[7][20] = 4 + fcc15;
-				Distance[13][2] = 4 + fcc13;
-				Distance[13][11] = 2 + fcc14;
-				Distance[13][20] = 4 + fcc15;
-				Distance[23][2] = 6 + fcc13;
-				Distance[23][11] = 4 + fcc14;
-				Distance[23][20] = 3 + fcc15;
-				Distance[2][25] = 1;
-				Distance[11][25] = 2;
-				Distance[20][25] = 4;
-			}
-
-		}
-
-		if (consumerNode == 43){
-
-			//F1->F2->F4
-			if (functionType == 1) {
-				Distance[0][3] = 6 + fcc1;
-				Distance[0][10] = 3 + fcc2;
-				Distance[0][21] = 4 + fcc3;
-				Distance[3][7] = 1 + fcc4;
-				Distance[3][13] = 4 + fcc5;
-				Distance[3][23] = 6 + fcc6;
-				Distance[10][7] = 2 + fcc4;
-				Distance[10][13] = 1 + fcc5;
-				Distance[10][23] = 3 + fcc6;
-				Distance[21][7] = 5 + fcc4;
-				Distance[21][13] = 3 + fcc5;
-				Distance[21][23] = 2 + fcc6;
-				Distance[7][6] = 1 + fcc10;
-				Distance[7][9] = 2 + fcc11;
-				Distance[7][15] = 3 + fcc12;
-				Distance[13][6] = 3 + fcc10;
-				Distance[13][9] = 2 + fcc11;
-				Distance[13][15] = 3 + fcc12;
-				Distance[23][6] = 5 + fcc10;
-				Distance[23][9] = 4 + fcc11;
-				Distance[23][15] = 3 + fcc12;
-				Distance[6][25] = 1;
-				Distance[9][25] = 2;
-				Distance[15][25] = 3;
-			}
-
-			//F1->F2->F5
-			if (functionType == 2) {
-				Distance[0][3] = 6 + fcc1;
-				Distance[0][10] = 3 + fcc2;
-				Distance[0][21] = 4 + fcc3;
-				Distance[3][7] = 1 + fcc4;
-				Distance[3][13] = 4 + fcc5;
-				Distance[3][23] = 6 + fcc6;
-				Distance[10][7] = 2 + fcc4;
-				Distance[10][13] = 1 + fcc5;
-				Distance[10][23] = 3 + fcc6;
-				Distance[21][7] = 5 + fcc4;
-				Distance[21][13] = 3 + fcc5;
-				Distance[21][23] = 2 + fcc6;
-				Distance[7][2] = 2 + fcc13;
-				Distance[7][11] = 2 + fcc14;
-				Distance[7][20] = 4 + fcc15;
-				Distance[13][2] = 4 + fcc13;
-				Distance[13][11] = 2 + fcc14;
-				Distance[13][20] = 4 + fcc15;
-				Distance[23][2] = 6 + fcc13;
-				Distance[23][11] = 4 + fcc14;
-				Distance[23][20] = 3 + fcc15;
-				Distance[2][25] = 1;
-				Distance[11][25] = 2;
-				Distance[20][25] = 4;
-			}
-
-			//F2->F1->F4
-			if (functionType == 3) {
-				Distance[0][7] = 5 + fcc4;
-				Distance[0][13] = 3 + fcc5;
-				Distance[0][23] = 3 + fcc6;
-				Distance[7][3] = 1 + fcc1;
-				Distance[7][10] = 2 + fcc2;
-				Distance[7][21] = 5 + fcc3;
-				Distance[13][3] = 4 + fcc1;
-				Distance[13][10] = 1 + fcc2;
-				Distance[13][21] = 3 + fcc3;
-				Distance[23][3] = 6 + fcc1;
-				Distance[23][10] = 3 + fcc2;
-				Distance[23][21] = 2 + fcc3;
-				Distance[3][6] = 2 + fcc10;
-				Distance[3][9] = 3 + fcc11;
-				Distance[3][15] = 4 + fcc12;
-				Distance[10][6] = 2 + fcc10;
-				Distance[10][9] = 1 + fcc11;
-				Distance[10][15] = 3 + fcc12;
-				Distance[21][6] = 4 + fcc10;
-				Distance[21][9] = 3 + fcc11;
-				Distance[21][15] = 2 + fcc12;
-				Distance[6][25] = 1;
-				Distance[9][25] = 2;
-				Distance[15][25] = 3;
-			}
-
-			//F2->F1->F5
-			if (functionType == 4) {
-				Distance[0][7] = 5 + fcc4;
-				Distance[0][13] = 3 + fcc5;
-				Distance[0][23] = 3 + fcc6;
-				Distance[7][3] = 1 + fcc1;
-				Distance[7][10] = 2 + fcc2;
-				Distance[7][21] = 5 + fcc3;
-				Distance[13][3] = 4 + fcc1;
-				Distance[13][10] = 1 + fcc2;
-				Distance[13][21] = 3 + fcc3;
-				Distance[23][3] = 6 + fcc1;
-				Distance[23][10] = 3 + fcc2;
-				Distance[23][21] = 2 + fcc3;
-				Distance[3][2] = 1 + fcc13;
-				Distance[3][11] = 3 + fcc14;
-				Distance[3][20] = 5 + fcc15;
-				Distance[10][2] = 3 + fcc13;
-				Distance[10][11] = 2 + fcc14;
-				Distance[10][20] = 4 + fcc15;
-				Distance[21][2] = 5 + fcc13;
-				Distance[21][11] = 3 + fcc14;
-				Distance[21][20] = 1 + fcc15;
-				Distance[2][25] = 1;
-				Distance[11][25] = 2;
-				Distance[20][25] = 4;
-			}
-
-			//F1->F3->F4
-			if (functionType == 5) {
-				Distance[0][3] = 6 + fcc1;
-				Distance[0][10] = 3 + fcc2;
-				Distance[0][21] = 4 + fcc3;
-				Distance[3][4] = 1 + fcc7;
-				Distance[3][12] = 4 + fcc8;
-				Distance[3][17] = 5 + fcc9;
-				Distance[10][4] = 3 + fcc7;
-				Distance[10][12] = 2 + fcc8;
-				Distance[10][17] = 2 + fcc9;
-				Distance[21][4] = 6 + fcc7;
-				Distance[21][12] = 2 + fcc8;
-				Distance[21][17] = 2 + fcc9;
-				Distance[4][6] = 2 + fcc10;
-				Distance[4][9] = 3 + fcc11;
-				Distance[4][15] = 4 + fcc12;
-				Distance[12][6] = 2 + fcc10;
-				Distance[12][9] = 1 + fcc11;
-				Distance[12][15] = 2 + fcc12;
-				Distance[17][6] = 4 + fcc10;
-				Distance[17][9] = 3 + fcc11;
-				Distance[17][15] = 2 + fcc12;
-				Distance[6][25] = 1;
-				Distance[9][25] = 2;
-				Distance[15][25] = 3;
-			}
-
-			//F1->F3->F5
-			if (functionType == 6) {
-				Distance[0][3] = 6 + fcc1;
-				Distance[0][10] = 3 + fcc2;
-				Distance[0][21] = 4 + fcc3;
-				Distance[3][4] = 1 + fcc7;
-				Distance[3][12] = 4 + fcc8;
-				Distance[3][17] = 5 + fcc9;
-				Distance[10][4] = 3 + fcc7;
-				Distance[10][12] = 2 + fcc8;
-				Distance[10][17] = 2 + fcc9;
-				Distance[21][4] = 6 + fcc7;
-				Distance[21][12] = 2 + fcc8;
-				Distance[21][17] = 2 + fcc9;
-				Distance[4][2] = 2 + fcc13;
-				Distance[4][11] = 3 + fcc14;
-				Distance[4][20] = 5 + fcc15;
-				Distance[12][2] = 3 + fcc13;
-				Distance[12][11] = 1 + fcc14;
-				Distance[12][20] = 3 + fcc15;
-				Distance[17][2] = 5 + fcc13;
-				Distance[17][11] = 3 + fcc14;
-				Distance[17][20] = 3 + fcc15;
-				Distance[2][25] = 1;
-				Distance[11][25] = 2;
-				Distance[20][25] = 4;
-			}
-
-			//F3->F1->F4
-			if (functionType == 7) {
-				Distance[0][4] = 6 + fcc7;
-				Distance[0][12] = 4 + fcc8;
-				Distance[0][17] = 2 + fcc9;
-				Distance[4][3] = 1 + fcc1;
-				Distance[4][10] = 3 + fcc2;
-				Distance[4][21] = 6 + fcc3;
-				Distance[12][3] = 4 + fcc1;
-				Distance[12][10] = 2 + fcc2;
-				Distance[12][21] = 2 + fcc3;
-				Distance[17][3] = 5 + fcc1;
-				Distance[17][10] = 2 + fcc2;
-				Distance[17][21] = 2 + fcc3;
-				Distance[3][6] = 2 + fcc10;
-				Distance[3][9] = 3 + fcc11;
-				Distance[3][15] = 4 + fcc12;
-				Distance[10][6] = 2 + fcc10;
-				Distance[10][9] = 1 + fcc11;
-				Distance[10][15] = 3 + fcc12;
-				Distance[21][6] = 4 + fcc10;
-				Distance[21][9] = 3 + fcc11;
-				Distance[21][15] = 2 + fcc12;
-				Distance[6][25] = 1;
-				Distance[9][25] = 2;
-				Distance[15][25] = 3;
-			}
-
-			//F3->F1->F5
-			if (functionType == 8) {
-				Distance[0][4] = 6 + fcc7;
-				Distance[0][12] = 4 + fcc8;
-				Distance[0][17] = 2 + fcc9;
-				Distance[4][3] = 1 + fcc1;
-				Distance[4][10] = 3 + fcc2;
-				Distance[4][21] = 6 + fcc3;
-				Distance[12][3] = 4 + fcc1;
-				Distance[12][10] = 2 + fcc2;
-				Distance[12][21] = 2 + fcc3;
-				Distance[17][3] = 5 + fcc1;
-				Distance[17][10] = 2 + fcc2;
-				Distance[17][21] = 2 + fcc3;
-				Distance[3][2] = 1 + fcc13;
-				Distance[3][11] = 3 + fcc14;
-				Distance[3][20] = 5 + fcc15;
-				Distance[10][2] = 3 + fcc13;
-				Distance[10][11] = 2 + fcc14;
-				Distance[10][20] = 4 + fcc15;
-				Distance[21][2] = 5 + fcc13;
-				Distance[21][11] = 3 + fcc14;
-				Distance[21][20] = 1 + fcc15;
-				Distance[2][25] = 1;
-				Distance[11][25] = 2;
-				Distance[20][25] = 4;
-			}
-
-			//F2->F3->F4
-			if (functionType == 9) {
-				Distance[0][7] = 5 + fcc4;
-				Distance[0][13] = 3 + fcc5;
-				Distance[0][23] = 3 + fcc6;
-				Distance[7][4] = 1 + fcc7;
-				Distance[7][12] = 3 + fcc8;
-				Distance[7][17] = 4 + fcc9;
-				Distance[13][4] = 4 + fcc7;
-				Distance[13][12] = 1 + fcc8;
-				Distance[13][17] = 1 + fcc9;
-				Distance[23][4] = 6 + fcc7;
-				Distance[23][12] = 3 + fcc8;
-				Distance[23][17] = 1 + fcc9;
-				Distance[4][6] = 2 + fcc10;
-				Distance[4][9] = 3 + fcc11;
-				Distance[4][15] = 4 + fcc12;
-				Distance[12][6] = 2 + fcc10;
-				Distance[12][9] = 1 + fcc11;
-				Distance[12][15] = 2 + fcc12;
-				Distance[17][6] = 4 + fcc10;
-				Distance[17][9] = 3 + fcc11;
-				Distance[17][15] = 2 + fcc12;
-				Distance[6][25] = 1;
-				Distance[9][25] = 2;
-				Distance[15][25] = 3;
-			}
-
-			//F2->F3->F5
-			if (functionType == 10) {
-				Distance[0][7] = 5 + fcc4;
-				Distance[0][13] = 3 + fcc5;
-				Distance[0][23] = 3 + fcc6;
-				Distance[7][4] = 1 + fcc7;
-				Distance[7][12] = 3 + fcc8;
-				Distance[7][17] = 4 + fcc9;
-				Distance[13][4] = 4 + fcc7;
-				Distance[13][12] = 1 + fcc8;
-				Distance[13][17] = 1 + fcc9;
-				Distance[23][4] = 6 + fcc7;
-				Distance[23][12] = 3 + fcc8;
-				Distance[23][17] = 1 + fcc9;
-				Distance[4][2] = 2 + fcc13;
-				Distance[4][11] = 3 + fcc14;
-				Distance[4][20] = 5 + fcc15;
-				Distance[12][2] = 3 + fcc13;
-				Distance[12][11] = 1 + fcc14;
-				Distance[12][20] = 3 + fcc15;
-				Distance[17][2] = 5 + fcc13;
-				Distance[17][11] = 3 + fcc14;
-				Distance[17][20] = 3 + fcc15;
-				Distance[2][25] = 1;
-				Distance[11][25] = 2;
-				Distance[20][25] = 4;
-			}
-
-			//F3->F2->F4
-			if (functionType == 11) {
-				Distance[0][4] = 6 + fcc4;
-				Distance[0][12] = 4 + fcc5;
-				Distance[0][17] = 2 + fcc6;
-				Distance[4][7] = 2 + fcc7;
-				Distance[4][13] = 3 + fcc8;
-				Distance[4][23] = 4 + fcc9;
-				Distance[12][7] = 3 + fcc7;
-				Distance[12][13] = 1 + fcc8;
-				Distance[12][23] = 3 + fcc9;
-				Distance[17][7] = 4 + fcc7;
-				Distance[17][13] = 1 + fcc8;
-				Distance[17][23] = 1 + fcc9;
-				Distance[7][6] = 1 + fcc10;
-				Distance[7][9] = 2 + fcc11;
-				Distance[7][15] = 3 + fcc12;
-				Distance[13][6] = 3 + fcc10;
-				Distance[13][9] = 2 + fcc11;
-				Distance[13][15] = 3 + fcc12;
-				Distance[23][6] = 5 + fcc10;
-				Distance[23][9] = 4 + fcc11;
-				Distance[23][15] = 3 + fcc12;
-				Distance[6][25] = 1;
-				Distance[9][25] = 2;
-				Distance[15][25] = 3;
-			}
-
-			//F3->F2->F5
-			if (functionType == 12) {
-				Distance[0][4] = 6 + fcc4;
-				Distance[0][12] = 4 + fcc5;
-				Distance[0][17] = 2 + fcc6;
-				Distance[4][7] = 1 + fcc7;
-				Distance[4][13] = 4 + fcc8;
-				Distance[4][23] = 6 + fcc9;
-				Distance[12][7] = 3 + fcc7;
-				Distance[12][13] = 1 + fcc8;
-				Distance[12][23] = 3 + fcc9;
-				Distance[17][7] = 4 + fcc7;
-				Distance[17][13] = 1 + fcc8;
-				Distance[17][23] = 1 + fcc9;
-				Distance[7][2] = 2 + fcc13;
-				Distance[7][11] = 2 + fcc14;
-				Distance[7][20] = 4 + fcc15;
-				Distance[13][2] = 4 + fcc13;
-				Distance[13][11] = 2 + fcc14;
-				Distance[13][20] = 4 + fcc15;
-				Distance[23][2] = 6 + fcc13;
-				Distance[23][11] = 4 + fcc14;
-				Distance[23][20] = 3 + fcc15;
-				Distance[2][25] = 1;
-				Distance[11][25] = 2;
-				Distance[20][25] = 4;
-			}
-		}
-		*/ //us-1
-
-		//Sinet
-		/*
-		if (consumerNode == 0){
-			if(functionType==1){
-			Distance[0][35]=5+fcc1;
-			Distance[0][25]=5+fcc2;
-			Distance[0][16]=5+fcc3;
-			Distance[35][7]=4+fcc4;
-			Distance[35][21]=1+fcc5;
-			Distance[35][31]=2+fcc6;
-			Distance[25][7]=4+fcc4;
-			Distance[25][21]=2+fcc5;
-			Distance[25][31]=2+fcc6;
-			Distance[16][7]=4+fcc4;
-			Distance[16][21]=2+fcc5;
-			Distance[16][31]=2+fcc6;
-			Distance[7][24]=2+fcc10;
-			Distance[7][10]=4+fcc11;
-			Distance[7][20]=4+fcc12;
-			Distance[21][24]=3+fcc10;
-			Distance[21][10]=2+fcc11;
-			Distance[21][20]=3+fcc12;
-			Distance[31][24]=3+fcc10;
-			Distance[31][10]=2+fcc11;
-			Distance[31][20]=3+fcc12;
-			Distance[24][38]=1;
-			Distance[10][38]=3;
-			Distance[20][38]=3;
-			}
-			if(functionType==2){
-			Distance[0][35]=5+fcc1;
-			Distance[0][25]=5+fcc2;
-			Distance[0][16]=5+fcc3;
-			Distance[35][7]=4+fcc4;
-			Distance[35][21]=1+fcc5;
-			Distance[35][31]=2+fcc6;
-			Distance[25][7]=4+fcc4;
-			Distance[25][21]=2+fcc5;
-			Distance[25][31]=2+fcc6;
-			Distance[16][7]=4+fcc4;
-			Distance[16][21]=2+fcc5;
-			Distance[16][31]=2+fcc6;
-			Distance[7][4]=3+fcc13;
-			Distance[7][15]=4+fcc14;
-			Distance[7][36]=5+fcc15;
-			Distance[21][4]=4+fcc13;
-			Distance[21][15]=3+fcc14;
-			Distance[21][36]=2+fcc15;
-			Distance[31][4]=4+fcc13;
-			Distance[31][15]=3+fcc14;
-			Distance[31][36]=3+fcc15;
-			Distance[4][38]=2;
-			Distance[15][38]=3;
-			Distance[36][38]=4;
-			}
-			if(functionType==3){
-			Distance[0][7]=1+fcc4;
-			Distance[0][21]=5+fcc5;
-			Distance[0][31]=5+fcc6;
-			Distance[7][35]=4+fcc1;
-			Distance[7][25]=4+fcc2;
-			Distance[7][16]=4+fcc3;
-			Distance[21][35]=1+fcc1;
-			Distance[21][25]=2+fcc2;
-			Distance[21][16]=2+fcc3;
-			Distance[31][35]=2+fcc1;
-			Distance[31][25]=2+fcc2;
-			Distance[31][16]=2+fcc3;
-			Distance[35][24]=3+fcc10;
-			Distance[35][10]=2+fcc11;
-			Distance[35][20]=3+fcc12;
-			Distance[25][24]=3+fcc10;
-			Distance[25][10]=2+fcc11;
-			Distance[25][20]=3+fcc12;
-			Distance[16][24]=3+fcc10;
-			Distance[16][10]=2+fcc11;
-			Distance[16][20]=3+fcc12;
-			Distance[24][38]=1;
-			Distance[10][38]=3;
-			Distance[20][38]=3;
-			}
-			if(functionType==4){
-			Distance[0][7]=1+fcc4;
-			Distance[0][21]=5+fcc5;
-			Distance[0][31]=5+fcc6;
-			Distance[7][35]=4+fcc1;
-			Distance[7][25]=4+fcc2;
-			Distance[7][16]=4+fcc3;
-			Distance[21][35]=1+fcc1;
-			Distance[21][25]=2+fcc2;
-			Distance[21][16]=2+fcc3;
-			Distance[31][35]=2+fcc1;
-			Distance[31][25]=2+fcc2;
-			Distance[31][16]=2+fcc3;
-			Distance[35][4]=4+fcc13;
-			Distance[35][15]=3+fcc14;
-			Distance[35][36]=1+fcc15;
-			Distance[25][4]=4+fcc13;
-			Distance[25][15]=3+fcc14;
-			Distance[25][36]=3+fcc15;
-			Distance[16][4]=4+fcc13;
-			Distance[16][15]=3+fcc14;
-			Distance[16][36]=3+fcc15;
-			Distance[4][38]=2;
-			Distance[15][38]=3;
-			Distance[36][38]=4;
-			}
-			if(functionType==5){
-			Distance[0][35]=5+fcc1;
-			Distance[0][25]=5+fcc2;
-			Distance[0][16]=5+fcc3;
-			Distance[35][11]=2+fcc7;
-			Distance[35][13]=2+fcc8;
-			Distance[35][9]=2+fcc9;
-			Distance[25][11]=2+fcc7;
-			Distance[25][13]=2+fcc8;
-			Distance[25][9]=2+fcc9;
-			Distance[16][11]=2+fcc7;
-			Distance[16][13]=2+fcc8;
-			Distance[16][9]=2+fcc9;
-			Distance[11][24]=1+fcc10;
-			Distance[11][10]=2+fcc11;
-			Distance[11][20]=1+fcc12;
-			Distance[13][24]=2+fcc10;
-			Distance[13][10]=2+fcc11;
-			Distance[13][20]=3+fcc12;
-			Distance[9][24]=3+fcc10;
-			Distance[9][10]=2+fcc11;
-			Distance[9][20]=3+fcc12;
-			Distance[24][38]=1;
-			Distance[10][38]=3;
-			Distance[20][38]=3;
-			}
-			if(functionType==6){
-			Distance[0][35]=5+fcc1;
-			Distance[0][25]=5+fcc2;
-			Distance[0][16]=5+fcc3;
-			Distance[35][11]=2+fcc7;
-			Distance[35][13]=2+fcc8;
-			Distance[35][9]=2+fcc9;
-			Distance[25][11]=2+fcc7;
-			Distance[25][13]=2+fcc8;
-			Distance[25][9]=2+fcc9;
-			Distance[16][11]=2+fcc7;
-			Distance[16][13]=2+fcc8;
-			Distance[16][9]=2+fcc9;
-			Distance[11][4]=2+fcc13;
-			Distance[11][15]=1+fcc14;
-			Distance[11][36]=3+fcc15;
-			Distance[13][4]=3+fcc13;
-			Distance[13][15]=3+fcc14;
-			Distance[13][36]=3+fcc15;
-			Distance[9][4]=4+fcc13;
-			Distance[9][15]=3+fcc14;
-			Distance[9][36]=3+fcc15;
-			Distance[4][38]=2;
-			Distance[15][38]=3;
-			Distance[36][38]=4;
-			}
-			if(functionType==7){
-			Distance[0][11]=4+fcc7;
-			Distance[0][13]=3+fcc8;
-			Distance[0][9]=5+fcc9;
-			Distance[11][35]=2+fcc1;
-			Distance[11][25]=2+fcc2;
-			Distance[11][16]=2+fcc3;
-			Distance[13][35]=2+fcc1;
-			Distance[13][25]=2+fcc2;
-			Distance[13][16]=2+fcc3;
-			Distance[9][35]=2+fcc1;
-			Distance[9][25]=2+fcc2;
-			Distance[9][16]=2+fcc3;
-			Distance[35][24]=3+fcc10;
-			Distance[35][10]=2+fcc11;
-			Distance[35][20]=3+fcc12;
-			Distance[25][24]=3+fcc10;
-			Distance[25][10]=2+fcc11;
-			Distance[25][20]=3+fcc12;
-			Distance[16][24]=3+fcc10;
-			Distance[16][10]=2+fcc11;
-			Distance[16][20]=3+fcc12;
-			Distance[24][38]=1;
-			Distance[10][38]=3;
-			Distance[20][38]=3;
-			}
-			if(functionType==8){
-			Distance[0][11]=4+fcc7;
-			Distance[0][13]=3+fcc8;
-			Distance[0][9]=5+fcc9;
-			Distance[11][35]=2+fcc1;
-			Distance[11][25]=2+fcc2;
-			Distance[11][16]=2+fcc3;
-			Distance[13][35]=2+fcc1;
-			Distance[13][25]=2+fcc2;
-			Distance[13][16]=2+fcc3;
-			Distance[9][35]=2+fcc1;
-			Distance[9][25]=2+fcc2;
-			Distance[9][16]=2+fcc3;
-			Distance[35][4]=4+fcc13;
-			Distance[35][15]=3+fcc14;
-			Distance[35][36]=1+fcc15;
-			Distance[25][4]=4+fcc13;
-			Distance[25][15]=3+fcc14;
-			Distance[25][36]=3+fcc15;
-			Distance[16][4]=4+fcc13;
-			Distance[16][15]=3+fcc14;
-			Distance[16][36]=3+fcc15;
-			Distance[4][38]=2;
-			Distance[15][38]=3;
-			Distance[36][38]=4;
-			}
-			if(functionType==9){
-			Distance[0][7]=1+fcc4;
-			Distance[0][21]=5+fcc5;
-			Distance[0][31]=5+fcc6;
-			Distance[7][11]=3+fcc7;
-			Distance[7][13]=2+fcc8;
-			Distance[7][9]=4+fcc9;
-			Distance[21][11]=2+fcc7;
-			Distance[21][13]=2+fcc8;
-			Distance[21][9]=2+fcc9;
-			Distance[31][11]=2+fcc7;
-			Distance[31][13]=2+fcc8;
-			Distance[31][9]=2+fcc9;
-			Distance[11][24]=1+fcc10;
-			Distance[11][10]=2+fcc11;
-			Distance[11][20]=1+fcc12;
-			Distance[13][24]=2+fcc10;
-			Distance[13][10]=2+fcc11;
-			Distance[13][20]=3+fcc12;
-			Distance[9][24]=3+fcc10;
-			Distance[9][10]=2+fcc11;
-			Distance[9][20]=3+fcc12;
-			Distance[24][38]=1;
-			Distance[10][38]=3;
-			Distance[20][38]=3;
-			}
-			if(functionType==10){
-			Distance[0][7]=1+fcc4;
-			Distance[0][21]=5+fcc5;
-			Distance[0][31]=5+fcc6;
-			Distance[7][11]=3+fcc7;
-			Distance[7][13]=2+fcc8;
-			Distance[7][9]=4+fcc9;
-			Distance[21][11]=2+fcc7;
-			Distance[21][13]=2+fcc8;
-			Distance[21][9]=2+fcc9;
-			Distance[31][11]=2+fcc7;
-			Distance[31][13]=2+fcc8;
-			Distance[31][9]=2+fcc9;
-			Distance[11][4]=2+fcc13;
-			Distance[11][15]=1+fcc14;
-			Distance[11][36]=3+fcc15;
-			Distance[13][4]=3+fcc13;
-			Distance[13][15]=3+fcc14;
-			Distance[13][36]=3+fcc15;
-			Distance[9][4]=4+fcc13;
-			Distance[9][15]=3+fcc14;
-			Distance[9][36]=3+fcc15;
-			Distance[4][38]=2;
-			Distance[15][38]=3;
-			Distance[36][38]=4;
-			}
-			if(functionType==11){
-			Distance[0][11]=4+fcc7;
-			Distance[0][13]=3+fcc8;
-			Distance[0][9]=5+fcc9;
-			Distance[11][7]=3+fcc4;
-			Distance[11][21]=2+fcc5;
-			Distance[11][31]=2+fcc6;
-			Distance[13][7]=2+fcc4;
-			Distance[13][21]=2+fcc5;
-			Distance[13][31]=2+fcc6;
-			Distance[9][7]=4+fcc4;
-			Distance[9][21]=2+fcc5;
-			Distance[9][31]=2+fcc6;
-			Distance[7][24]=2+fcc10;
-			Distance[7][10]=4+fcc11;
-			Distance[7][20]=4+fcc12;
-			Distance[21][24]=3+fcc10;
-			Distance[21][10]=2+fcc11;
-			Distance[21][20]=3+fcc12;
-			Distance[31][24]=3+fcc10;
-			Distance[31][10]=2+fcc11;
-			Distance[31][20]=3+fcc12;
-			Distance[24][38]=1;
-			Distance[10][38]=3;
-			Distance[20][38]=3;
-			}
-			if(functionType==12){
-			Distance[0][11]=4+fcc7;
-			Distance[0][13]=3+fcc8;
-			Distance[0][9]=5+fcc9;
-			Distance[11][7]=3+fcc4;
-			Distance[11][21]=2+fcc5;
-			Distance[11][31]=2+fcc6;
-			Distance[13][7]=2+fcc4;
-			Distance[13][21]=2+fcc5;
-			Distance[13][31]=2+fcc6;
-			Distance[9][7]=4+fcc4;
-			Distance[9][21]=2+fcc5;
-			Distance[9][31]=2+fcc6;
-			Distance[7][4]=3+fcc13;
-			Distance[7][15]=4+fcc14;
-			Distance[7][36]=5+fcc15;
-			Distance[21][4]=4+fcc13;
-			Distance[21][15]=3+fcc14;
-			Distance[21][36]=2+fcc15;
-			Distance[31][4]=4+fcc13;
-			Distance[31][15]=3+fcc14;
-			Distance[31][36]=3+fcc15;
-			Distance[4][38]=2;
-			Distance[15][38]=3;
-			Distance[36][38]=4;
-			}
-			}
-			if (consumerNode == 54){
-			if(functionType==1){
-			Distance[0][35]=4+fcc1;
-			Distance[0][25]=4+fcc2;
-			Distance[0][16]=4+fcc3;
-			Distance[35][7]=4+fcc4;
-			Distance[35][21]=1+fcc5;
-			Distance[35][31]=2+fcc6;
-			Distance[25][7]=4+fcc4;
-			Distance[25][21]=2+fcc5;
-			Distance[25][31]=2+fcc6;
-			Distance[16][7]=4+fcc4;
-			Distance[16][21]=2+fcc5;
-			Distance[16][31]=2+fcc6;
-			Distance[7][24]=2+fcc10;
-			Distance[7][10]=4+fcc11;
-			Distance[7][20]=4+fcc12;
-			Distance[21][24]=3+fcc10;
-			Distance[21][10]=2+fcc11;
-			Distance[21][20]=3+fcc12;
-			Distance[31][24]=3+fcc10;
-			Distance[31][10]=2+fcc11;
-			Distance[31][20]=3+fcc12;
-			Distance[24][38]=1;
-			Distance[10][38]=3;
-			Distance[20][38]=3;
-			}
-			if(functionType==2){
-			Distance[0][35]=4+fcc1;
-			Distance[0][25]=4+fcc2;
-			Distance[0][16]=4+fcc3;
-			Distance[35][7]=4+fcc4;
-			Distance[35][21]=1+fcc5;
-			Distance[35][31]=2+fcc6;
-			Distance[25][7]=4+fcc4;
-			Distance[25][21]=2+fcc5;
-			Distance[25][31]=2+fcc6;
-			Distance[16][7]=4+fcc4;
-			Distance[16][21]=2+fcc5;
-			Distance[16][31]=2+fcc6;
-			Distance[7][4]=3+fcc13;
-			Distance[7][15]=4+fcc14;
-			Distance[7][36]=5+fcc15;
-			Distance[21][4]=4+fcc13;
-			Distance[21][15]=3+fcc14;
-			Distance[21][36]=2+fcc15;
-			Distance[31][4]=4+fcc13;
-			Distance[31][15]=3+fcc14;
-			Distance[31][36]=3+fcc15;
-			Distance[4][38]=2;
-			Distance[15][38]=3;
-			Distance[36][38]=4;
-			}
-			if(functionType==3){
-			Distance[0][7]=0+fcc4;
-			Distance[0][21]=4+fcc5;
-			Distance[0][31]=4+fcc6;
-			Distance[7][35]=4+fcc1;
-			Distance[7][25]=4+fcc2;
-			Distance[7][16]=4+fcc3;
-			Distance[21][35]=1+fcc1;
-			Distance[21][25]=2+fcc2;
-			Distance[21][16]=2+fcc3;
-			Distance[31][35]=2+fcc1;
-			Distance[31][25]=2+fcc2;
-			Distance[31][16]=2+fcc3;
-			Distance[35][24]=3+fcc10;
-			Distance[35][10]=2+fcc11;
-			Distance[35][20]=3+fcc12;
-			Distance[25][24]=3+fcc10;
-			Distance[25][10]=2+fcc11;
-			Distance[25][20]=3+fcc12;
-			Distance[16][24]=3+fcc10;
-			Distance[16][10]=2+fcc11;
-			Distance[16][20]=3+fcc12;
-			Distance[24][38]=1;
-			Distance[10][38]=3;
-			Distance[20][38]=3;
-			}
-			if(functionType==4){
-			Distance[0][7]=0+fcc4;
-			Distance[0][21]=4+fcc5;
-			Distance[0][31]=4+fcc6;
-			Distance[7][35]=4+fcc1;
-			Distance[7][25]=4+fcc2;
-			Distance[7][16]=4+fcc3;
-			Distance[21][35]=1+fcc1;
-			Distance[21][25]=2+fcc2;
-			Distance[21][16]=2+fcc3;
-			Distance[31][35]=2+fcc1;
-			Distance[31][25]=2+fcc2;
-			Distance[31][16]=2+fcc3;
-			Distance[35][4]=4+fcc13;
-			Distance[35][15]=3+fcc14;
-			Distance[35][36]=1+fcc15;
-			Distance[25][4]=4+fcc13;
-			Distance[25][15]=3+fcc14;
-			Distance[25][36]=3+fcc15;
-			Distance[16][4]=4+fcc13;
-			Distance[16][15]=3+fcc14;
-			Distance[16][36]=3+fcc15;
-			Distance[4][38]=2;
-			Distance[15][38]=3;
-			Distance[36][38]=4;
-			}
-			if(functionType==5){
-			Distance[0][35]=4+fcc1;
-			Distance[0][25]=4+fcc2;
-			Distance[0][16]=4+fcc3;
-			Distance[35][11]=2+fcc7;
-			Distance[35][13]=2+fcc8;
-			Distance[35][9]=2+fcc9;
-			Distance[25][11]=2+fcc7;
-			Distance[25][13]=2+fcc8;
-			Distance[25][9]=2+fcc9;
-			Distance[16][11]=2+fcc7;
-			Distance[16][13]=2+fcc8;
-			Distance[16][9]=2+fcc9;
-			Distance[11][24]=1+fcc10;
-			Distance[11][10]=2+fcc11;
-			Distance[11][20]=1+fcc12;
-			Distance[13][24]=2+fcc10;
-			Distance[13][10]=2+fcc11;
-			Distance[13][20]=3+fcc12;
-			Distance[9][24]=3+fcc10;
-			Distance[9][10]=2+fcc11;
-			Distance[9][20]=3+fcc12;
-			Distance[24][38]=1;
-			Distance[10][38]=3;
-			Distance[20][38]=3;
-			}
-			if(functionType==6){
-			Distance[0][35]=4+fcc1;
-			Distance[0][25]=4+fcc2;
-			Distance[0][16]=4+fcc3;
-			Distance[35][11]=2+fcc7;
-			Distance[35][13]=2+fcc8;
-			Distance[35][9]=2+fcc9;
-			Distance[25][11]=2+fcc7;
-			Distance[25][13]=2+fcc8;
-			Distance[25][9]=2+fcc9;
-			Distance[16][11]=2+fcc7;
-			Distance[16][13]=2+fcc8;
-			Distance[16][9]=2+fcc9;
-			Distance[11][4]=2+fcc13;
-			Distance[11][15]=1+fcc14;
-			Distance[11][36]=3+fcc15;
-			Distance[13][4]=3+fcc13;
-			Distance[13][15]=3+fcc14;
-			Distance[13][36]=3+fcc15;
-			Distance[9][4]=4+fcc13;
-			Distance[9][15]=3+fcc14;
-			Distance[9][36]=3+fcc15;
-			Distance[4][38]=2;
-			Distance[15][38]=3;
-			Distance[36][38]=4;
-			}
-			if(functionType==7){
-			Distance[0][11]=3+fcc7;
-			Distance[0][13]=2+fcc8;
-			Distance[0][9]=4+fcc9;
-			Distance[11][35]=2+fcc1;
-			Distance[11][25]=2+fcc2;
-			Distance[11][16]=2+fcc3;
-			Distance[13][35]=2+fcc1;
-			Distance[13][25]=2+fcc2;
-			Distance[13][16]=2+fcc3;
-			Distance[9][35]=2+fcc1;
-			Distance[9][25]=2+fcc2;
-			Distance[9][16]=2+fcc3;
-			Distance[35][24]=3+fcc10;
-			Distance[35][10]=2+fcc11;
-			Distance[35][20]=3+fcc12;
-			Distance[25][24]=3+fcc10;
-			Distance[25][10]=2+fcc11;
-			Distance[25][20]=3+fcc12;
-			Distance[16][24]=3+fcc10;
-			Distance[16][10]=2+fcc11;
-			Distance[16][20]=3+fcc12;
-			Distance[24][38]=1;
-			Distance[10][38]=3;
-			Distance[20][38]=3;
-			}
-			if(functionType==8){
-			Distance[0][11]=3+fcc7;
-			Distance[0][13]=2+fcc8;
-			Distance[0][9]=4+fcc9;
-			Distance[11][35]=2+fcc1;
-			Distance[11][25]=2+fcc2;
-			Distance[11][16]=2+fcc3;
-			Distance[13][35]=2+fcc1;
-			Distance[13][25]=2+fcc2;
-			Distance[13][16]=2+fcc3;
-			Distance[9][35]=2+fcc1;
-			Distance[9][25]=2+fcc2;
-			Distance[9][16]=2+fcc3;
-			Distance[35][4]=4+fcc13;
-			Distance[35][15]=3+fcc14;
-			Distance[35][36]=1+fcc15;
-			Distance[25][4]=4+fcc13;
-			Distance[25][15]=3+fcc14;
-			Distance[25][36]=3+fcc15;
-			Distance[16][4]=4+fcc13;
-			Distance[16][15]=3+fcc14;
-			Distance[16][36]=3+fcc15;
-			Distance[4][38]=2;
-			Distance[15][38]=3;
-			Distance[36][38]=4;
-			}
-			if(functionType==9){
-			Distance[0][7]=0+fcc4;
-			Distance[0][21]=4+fcc5;
-			Distance[0][31]=4+fcc6;
-			Distance[7][11]=3+fcc7;
-			Distance[7][13]=2+fcc8;
-			Distance[7][9]=4+fcc9;
-			Distance[21][11]=2+fcc7;
-			Distance[21][13]=2+fcc8;
-			Distance[21][9]=2+fcc9;
-			Distance[31][11]=2+fcc7;
-			Distance[31][13]=2+fcc8;
-			Distance[31][9]=2+fcc9;
-			Distance[11][24]=1+fcc10;
-			Distance[11][10]=2+fcc11;
-			Distance[11][20]=1+fcc12;
-			Distance[13][24]=2+fcc10;
-			Distance[13][10]=2+fcc11;
-			Distance[13][20]=3+fcc12;
-			Distance[9][24]=3+fcc10;
-			Distance[9][10]=2+fcc11;
-			Distance[9][20]=3+fcc12;
-			Distance[24][38]=1;
-			Distance[10][38]=3;
-			Distance[20][38]=3;
-			}
-			if(functionType==10){
-			Distance[0][7]=0+fcc4;
-			Distance[0][21]=4+fcc5;
-			Distance[0][31]=4+fcc6;
-			Distance[7][11]=3+fcc7;
-			Distance[7][13]=2+fcc8;
-			Distance[7][9]=4+fcc9;
-			Distance[21][11]=2+fcc7;
-			Distance[21][13]=2+fcc8;
-			Distance[21][9]=2+fcc9;
-			Distance[31][11]=2+fcc7;
-			Distance[31][13]=2+fcc8;
-			Distance[31][9]=2+fcc9;
-			Distance[11][4]=2+fcc13;
-			Distance[11][15]=1+fcc14;
-			Distance[11][36]=3+fcc15;
-			Distance[13][4]=3+fcc13;
-			Distance[13][15]=3+fcc14;
-			Distance[13][36]=3+fcc15;
-			Distance[9][4]=4+fcc13;
-			Distance[9][15]=3+fcc14;
-			Distance[9][36]=3+fcc15;
-			Distance[4][38]=2;
-			Distance[15][38]=3;
-			Distance[36][38]=4;
-			}
-			if(functionType==11){
-			Distance[0][11]=3+fcc7;
-			Distance[0][13]=2+fcc8;
-			Distance[0][9]=4+fcc9;
-			Distance[11][7]=3+fcc4;
-			Distance[11][21]=2+fcc5;
-			Distance[11][31]=2+fcc6;
-			Distance[13][7]=2+fcc4;
-			Distance[13][21]=2+fcc5;
-			Distance[13][31]=2+fcc6;
-			Distance[9][7]=4+fcc4;
-			Distance[9][21]=2+fcc5;
-			Distance[9][31]=2+fcc6;
-			Distance[7][24]=2+fcc10;
-			Distance[7][10]=4+fcc11;
-			Distance[7][20]=4+fcc12;
-			Distance[21][24]=3+fcc10;
-			Distance[21][10]=2+fcc11;
-			Distance[21][20]=3+fcc12;
-			Distance[31][24]=3+fcc10;
-			Distance[31][10]=2+fcc11;
-			Distance[31][20]=3+fcc12;
-			Distance[24][38]=1;
-			Distance[10][38]=3;
-			Distance[20][38]=3;
-			}
-			if(functionType==12){
-			Distance[0][11]=3+fcc7;
-			Distance[0][13]=2+fcc8;
-			Distance[0][9]=4+fcc9;
-			Distance[11][7]=3+fcc4;
-			Distance[11][21]=2+fcc5;
-			Distance[11][31]=2+fcc6;
-			Distance[13][7]=2+fcc4;
-			Distance[13][21]=2+fcc5;
-			Distance[13][31]=2+fcc6;
-			Distance[9][7]=4+fcc4;
-			Distance[9][21]=2+fcc5;
-			Distance[9][31]=2+fcc6;
-			Distance[7][4]=3+fcc13;
-			Distance[7][15]=4+fcc14;
-			Distance[7][36]=5+fcc15;
-			Distance[21][4]=4+fcc13;
-			Distance[21][15]=3+fcc14;
-			Distance[21][36]=2+fcc15;
-			Distance[31][4]=4+fcc13;
-			Distance[31][15]=3+fcc14;
-			Distance[31][36]=3+fcc15;
-			Distance[4][38]=2;
-			Distance[15][38]=3;
-			Distance[36][38]=4;
-			}
-			}
-			if (consumerNode == 55){
-			if(functionType==1){
-			Distance[0][35]=2+fcc1;
-			Distance[0][25]=2+fcc2;
-			Distance[0][16]=2+fcc3;
-			Distance[35][7]=4+fcc4;
-			Distance[35][21]=1+fcc5;
-			Distance[35][31]=2+fcc6;
-			Distance[25][7]=4+fcc4;
-			Distance[25][21]=2+fcc5;
-			Distance[25][31]=2+fcc6;
-			Distance[16][7]=4+fcc4;
-			Distance[16][21]=2+fcc5;
-			Distance[16][31]=2+fcc6;
-			Distance[7][24]=2+fcc10;
-			Distance[7][10]=4+fcc11;
-			Distance[7][20]=4+fcc12;
-			Distance[21][24]=3+fcc10;
-			Distance[21][10]=2+fcc11;
-			Distance[21][20]=3+fcc12;
-			Distance[31][24]=3+fcc10;
-			Distance[31][10]=2+fcc11;
-			Distance[31][20]=3+fcc12;
-			Distance[24][38]=2;
-			Distance[10][38]=1;
-			Distance[20][38]=2;
-			}
-			if(functionType==2){
-			Distance[0][35]=2+fcc1;
-			Distance[0][25]=2+fcc2;
-			Distance[0][16]=2+fcc3;
-			Distance[35][7]=4+fcc4;
-			Distance[35][21]=1+fcc5;
-			Distance[35][31]=2+fcc6;
-			Distance[25][7]=4+fcc4;
-			Distance[25][21]=2+fcc5;
-			Distance[25][31]=2+fcc6;
-			Distance[16][7]=4+fcc4;
-			Distance[16][21]=2+fcc5;
-			Distance[16][31]=2+fcc6;
-			Distance[7][4]=3+fcc13;
-			Distance[7][15]=4+fcc14;
-			Distance[7][36]=5+fcc15;
-			Distance[21][4]=4+fcc13;
-			Distance[21][15]=3+fcc14;
-			Distance[21][36]=2+fcc15;
-			Distance[31][4]=4+fcc13;
-			Distance[31][15]=3+fcc14;
-			Distance[31][36]=3+fcc15;
-			Distance[4][38]=3;
-			Distance[15][38]=2;
-			Distance[36][38]=2;
-			}
-			if(functionType==3){
-			Distance[0][7]=3+fcc4;
-			Distance[0][21]=2+fcc5;
-			Distance[0][31]=2+fcc6;
-			Distance[7][35]=4+fcc1;
-			Distance[7][25]=4+fcc2;
-			Distance[7][16]=4+fcc3;
-			Distance[21][35]=1+fcc1;
-			Distance[21][25]=2+fcc2;
-			Distance[21][16]=2+fcc3;
-			Distance[31][35]=2+fcc1;
-			Distance[31][25]=2+fcc2;
-			Distance[31][16]=2+fcc3;
-			Distance[35][24]=3+fcc10;
-			Distance[35][10]=2+fcc11;
-			Distance[35][20]=3+fcc12;
-			Distance[25][24]=3+fcc10;
-			Distance[25][10]=2+fcc11;
-			Distance[25][20]=3+fcc12;
-			Distance[16][24]=3+fcc10;
-			Distance[16][10]=2+fcc11;
-			Distance[16][20]=3+fcc12;
-			Distance[24][38]=2;
-			Distance[10][38]=1;
-			Distance[20][38]=2;
-			}
-			if(functionType==4){
-			Distance[0][7]=3+fcc4;
-			Distance[0][21]=2+fcc5;
-			Distance[0][31]=2+fcc6;
-			Distance[7][35]=4+fcc1;
-			Distance[7][25]=4+fcc2;
-			Distance[7][16]=4+fcc3;
-			Distance[21][35]=1+fcc1;
-			Distance[21][25]=2+fcc2;
-			Distance[21][16]=2+fcc3;
-			Distance[31][35]=2+fcc1;
-			Distance[31][25]=2+fcc2;
-			Distance[31][16]=2+fcc3;
-			Distance[35][4]=4+fcc13;
-			Distance[35][15]=3+fcc14;
-			Distance[35][36]=1+fcc15;
-			Distance[25][4]=4+fcc13;
-			Distance[25][15]=3+fcc14;
-			Distance[25][36]=3+fcc15;
-			Distance[16][4]=4+fcc13;
-			Distance[16][15]=3+fcc14;
-			Distance[16][36]=3+fcc15;
-			Distance[4][38]=3;
-			Distance[15][38]=2;
-			Distance[36][38]=2;
-			}
-			if(functionType==5){
-			Distance[0][35]=2+fcc1;
-			Distance[0][25]=2+fcc2;
-			Distance[0][16]=2+fcc3;
-			Distance[35][11]=2+fcc7;
-			Distance[35][13]=2+fcc8;
-			Distance[35][9]=2+fcc9;
-			Distance[25][11]=2+fcc7;
-			Distance[25][13]=2+fcc8;
-			Distance[25][9]=2+fcc9;
-			Distance[16][11]=2+fcc7;
-			Distance[16][13]=2+fcc8;
-			Distance[16][9]=2+fcc9;
-			Distance[11][24]=1+fcc10;
-			Distance[11][10]=2+fcc11;
-			Distance[11][20]=1+fcc12;
-			Distance[13][24]=2+fcc10;
-			Distance[13][10]=2+fcc11;
-			Distance[13][20]=3+fcc12;
-			Distance[9][24]=3+fcc10;
-			Distance[9][10]=2+fcc11;
-			Distance[9][20]=3+fcc12;
-			Distance[24][38]=2;
-			Distance[10][38]=1;
-			Distance[20][38]=2;
-			}
-			if(functionType==6){
-			Distance[0][35]=2+fcc1;
-			Distance[0][25]=2+fcc2;
-			Distance[0][16]=2+fcc3;
-			Distance[35][11]=2+fcc7;
-			Distance[35][13]=2+fcc8;
-			Distance[35][9]=2+fcc9;
-			Distance[25][11]=2+fcc7;
-			Distance[25][13]=2+fcc8;
-			Distance[25][9]=2+fcc9;
-			Distance[16][11]=2+fcc7;
-			Distance[16][13]=2+fcc8;
-			Distance[16][9]=2+fcc9;
-			Distance[11][4]=2+fcc13;
-			Distance[11][15]=1+fcc14;
-			Distance[11][36]=3+fcc15;
-			Distance[13][4]=3+fcc13;
-			Distance[13][15]=3+fcc14;
-			Distance[13][36]=3+fcc15;
-			Distance[9][4]=4+fcc13;
-			Distance[9][15]=3+fcc14;
-			Distance[9][36]=3+fcc15;
-			Distance[4][38]=3;
-			Distance[15][38]=2;
-			Distance[36][38]=2;
-			}
-			if(functionType==7){
-			Distance[0][11]=0+fcc7;
-			Distance[0][13]=2+fcc8;
-			Distance[0][9]=2+fcc9;
-			Distance[11][35]=2+fcc1;
-			Distance[11][25]=2+fcc2;
-			Distance[11][16]=2+fcc3;
-			Distance[13][35]=2+fcc1;
-			Distance[13][25]=2+fcc2;
-			Distance[13][16]=2+fcc3;
-			Distance[9][35]=2+fcc1;
-			Distance[9][25]=2+fcc2;
-			Distance[9][16]=2+fcc3;
-			Distance[35][24]=3+fcc10;
-			Distance[35][10]=2+fcc11;
-			Distance[35][20]=3+fcc12;
-			Distance[25][24]=3+fcc10;
-			Distance[25][10]=2+fcc11;
-			Distance[25][20]=3+fcc12;
-			Distance[16][24]=3+fcc10;
-			Distance[16][10]=2+fcc11;
-			Distance[16][20]=3+fcc12;
-			Distance[24][38]=2;
-			Distance[10][38]=1;
-			Distance[20][38]=2;
-			}
-			if(functionType==8){
-			Distance[0][11]=0+fcc7;
-			Distance[0][13]=2+fcc8;
-			Distance[0][9]=2+fcc9;
-			Distance[11][35]=2+fcc1;
-			Distance[11][25]=2+fcc2;
-			Distance[11][16]=2+fcc3;
-			Distance[13][35]=2+fcc1;
-			Distance[13][25]=2+fcc2;
-			Distance[13][16]=2+fcc3;
-			Distance[9][35]=2+fcc1;
-			Distance[9][25]=2+fcc2;
-			Distance[9][16]=2+fcc3;
-			Distance[35][4]=4+fcc13;
-			Distance[35][15]=3+fcc14;
-			Distance[35][36]=1+fcc15;
-			Distance[25][4]=4+fcc13;
-			Distance[25][15]=3+fcc14;
-			Distance[25][36]=3+fcc15;
-			Distance[16][4]=4+fcc13;
-			Distance[16][15]=3+fcc14;
-			Distance[16][36]=3+fcc15;
-			Distance[4][38]=3;
-			Distance[15][38]=2;
-			Distance[36][38]=2;
-			}
-			if(functionType==9){
-			Distance[0][7]=3+fcc4;
-			Distance[0][21]=2+fcc5;
-			Distance[0][31]=2+fcc6;
-			Distance[7][11]=3+fcc7;
-			Distance[7][13]=2+fcc8;
-			Distance[7][9]=4+fcc9;
-			Distance[21][11]=2+fcc7;
-			Distance[21][13]=2+fcc8;
-			Distance[21][9]=2+fcc9;
-			Distance[31][11]=2+fcc7;
-			Distance[31][13]=2+fcc8;
-			Distance[31][9]=2+fcc9;
-			Distance[11][24]=1+fcc10;
-			Distance[11][10]=2+fcc11;
-			Distance[11][20]=1+fcc12;
-			Distance[13][24]=2+fcc10;
-			Distance[13][10]=2+fcc11;
-			Distance[13][20]=3+fcc12;
-			Distance[9][24]=3+fcc10;
-			Distance[9][10]=2+fcc11;
-			Distance[9][20]=3+fcc12;
-			Distance[24][38]=2;
-			Distance[10][38]=1;
-			Distance[20][38]=2;
-			}
-			if(functionType==10){
-			Distance[0][7]=3+fcc4;
-			Distance[0][21]=2+fcc5;
-			Distance[0][31]=2+fcc6;
-			Distance[7][11]=3+fcc7;
-			Distance[7][13]=2+fcc8;
-			Distance[7][9]=4+fcc9;
-			Distance[21][11]=2+fcc7;
-			Distance[21][13]=2+fcc8;
-			Distance[21][9]=2+fcc9;
-			Distance[31][11]=2+fcc7;
-			Distance[31][13]=2+fcc8;
-			Distance[31][9]=2+fcc9;
-			Distance[11][4]=2+fcc13;
-			Distance[11][15]=1+fcc14;
-			Distance[11][36]=3+fcc15;
-			Distance[13][4]=3+fcc13;
-			Distance[13][15]=3+fcc14;
-			Distance[13][36]=3+fcc15;
-			Distance[9][4]=4+fcc13;
-			Distance[9][15]=3+fcc14;
-			Distance[9][36]=3+fcc15;
-			Distance[4][38]=3;
-			Distance[15][38]=2;
-			Distance[36][38]=2;
-			}
-			if(functionType==11){
-			Distance[0][11]=0+fcc7;
-			Distance[0][13]=2+fcc8;
-			Distance[0][9]=2+fcc9;
-			Distance[11][7]=3+fcc4;
-			Distance[11][21]=2+fcc5;
-			Distance[11][31]=2+fcc6;
-			Distance[13][7]=2+fcc4;
-			Distance[13][21]=2+fcc5;
-			Distance[13][31]=2+fcc6;
-			Distance[9][7]=4+fcc4;
-			Distance[9][21]=2+fcc5;
-			Distance[9][31]=2+fcc6;
-			Distance[7][24]=2+fcc10;
-			Distance[7][10]=4+fcc11;
-			Distance[7][20]=4+fcc12;
-			Distance[21][24]=3+fcc10;
-			Distance[21][10]=2+fcc11;
-			Distance[21][20]=3+fcc12;
-			Distance[31][24]=3+fcc10;
-			Distance[31][10]=2+fcc11;
-			Distance[31][20]=3+fcc12;
-			Distance[24][38]=2;
-			Distance[10][38]=1;
-			Distance[20][38]=2;
-			}
-			if(functionType==12){
-			Distance[0][11]=0+fcc7;
-			Distance[0][13]=2+fcc8;
-			Distance[0][9]=2+fcc9;
-			Distance[11][7]=3+fcc4;
-			Distance[11][21]=2+fcc5;
-			Distance[11][31]=2+fcc6;
-			Distance[13][7]=2+fcc4;
-			Distance[13][21]=2+fcc5;
-			Distance[13][31]=2+fcc6;
-			Distance[9][7]=4+fcc4;
-			Distance[9][21]=2+fcc5;
-			Distance[9][31]=2+fcc6;
-			Distance[7][4]=3+fcc13;
-			Distance[7][15]=4+fcc14;
-			Distance[7][36]=5+fcc15;
-			Distance[21][4]=4+fcc13;
-			Distance[21][15]=3+fcc14;
-			Distance[21][36]=2+fcc15;
-			Distance[31][4]=4+fcc13;
-			Distance[31][15]=3+fcc14;
-			Distance[31][36]=3+fcc15;
-			Distance[4][38]=3;
-			Distance[15][38]=2;
-			Distance[36][38]=2;
-			}
-			}
-			if (consumerNode == 56){
-			if(functionType==1){
-			Distance[0][35]=1+fcc1;
-			Distance[0][25]=3+fcc2;
-			Distance[0][16]=3+fcc3;
-			Distance[35][7]=4+fcc4;
-			Distance[35][21]=1+fcc5;
-			Distance[35][31]=2+fcc6;
-			Distance[25][7]=4+fcc4;
-			Distance[25][21]=2+fcc5;
-			Distance[25][31]=2+fcc6;
-			Distance[16][7]=4+fcc4;
-			Distance[16][21]=2+fcc5;
-			Distance[16][31]=2+fcc6;
-			Distance[7][24]=2+fcc10;
-			Distance[7][10]=4+fcc11;
-			Distance[7][20]=4+fcc12;
-			Distance[21][24]=3+fcc10;
-			Distance[21][10]=2+fcc11;
-			Distance[21][20]=3+fcc12;
-			Distance[31][24]=3+fcc10;
-			Distance[31][10]=2+fcc11;
-			Distance[31][20]=3+fcc12;
-			Distance[24][38]=2;
-			Distance[10][38]=1;
-			Distance[20][38]=2;
-			}
-			if(functionType==2){
-			Distance[0][35]=1+fcc1;
-			Distance[0][25]=3+fcc2;
-			Distance[0][16]=3+fcc3;
-			Distance[35][7]=4+fcc4;
-			Distance[35][21]=1+fcc5;
-			Distance[35][31]=2+fcc6;
-			Distance[25][7]=4+fcc4;
-			Distance[25][21]=2+fcc5;
-			Distance[25][31]=2+fcc6;
-			Distance[16][7]=4+fcc4;
-			Distance[16][21]=2+fcc5;
-			Distance[16][31]=2+fcc6;
-			Distance[7][4]=3+fcc13;
-			Distance[7][15]=4+fcc14;
-			Distance[7][36]=5+fcc15;
-			Distance[21][4]=4+fcc13;
-			Distance[21][15]=3+fcc14;
-			Distance[21][36]=2+fcc15;
-			Distance[31][4]=4+fcc13;
-			Distance[31][15]=3+fcc14;
-			Distance[31][36]=3+fcc15;
-			Distance[4][38]=3;
-			Distance[15][38]=2;
-			Distance[36][38]=2;
-			}
-			if(functionType==3){
-			Distance[0][7]=4+fcc4;
-			Distance[0][21]=2+fcc5;
-			Distance[0][31]=3+fcc6;
-			Distance[7][35]=4+fcc1;
-			Distance[7][25]=4+fcc2;
-			Distance[7][16]=4+fcc3;
-			Distance[21][35]=1+fcc1;
-			Distance[21][25]=2+fcc2;
-			Distance[21][16]=2+fcc3;
-			Distance[31][35]=2+fcc1;
-			Distance[31][25]=2+fcc2;
-			Distance[31][16]=2+fcc3;
-			Distance[35][24]=3+fcc10;
-			Distance[35][10]=2+fcc11;
-			Distance[35][20]=3+fcc12;
-			Distance[25][24]=3+fcc10;
-			Distance[25][10]=2+fcc11;
-			Distance[25][20]=3+fcc12;
-			Distance[16][24]=3+fcc10;
-			Distance[16][10]=2+fcc11;
-			Distance[16][20]=3+fcc12;
-			Distance[24][38]=2;
-			Distance[10][38]=1;
-			Distance[20][38]=2;
-			}
-			if(functionType==4){
-			Distance[0][7]=4+fcc4;
-			Distance[0][21]=2+fcc5;
-			Distance[0][31]=3+fcc6;
-			Distance[7][35]=4+fcc1;
-			Distance[7][25]=4+fcc2;
-			Distance[7][16]=4+fcc3;
-			Distance[21][35]=1+fcc1;
-			Distance[21][25]=2+fcc2;
-			Distance[21][16]=2+fcc3;
-			Distance[31][35]=2+fcc1;
-			Distance[31][25]=2+fcc2;
-			Distance[31][16]=2+fcc3;
-			Distance[35][4]=4+fcc13;
-			Distance[35][15]=3+fcc14;
-			Distance[35][36]=1+fcc15;
-			Distance[25][4]=4+fcc13;
-			Distance[25][15]=3+fcc14;
-			Distance[25][36]=3+fcc15;
-			Distance[16][4]=4+fcc13;
-			Distance[16][15]=3+fcc14;
-			Distance[16][36]=3+fcc15;
-			Distance[4][38]=3;
-			Distance[15][38]=2;
-			Distance[36][38]=2;
-			}
-			if(functionType==5){
-			Distance[0][35]=1+fcc1;
-			Distance[0][25]=3+fcc2;
-			Distance[0][16]=3+fcc3;
-			Distance[35][11]=2+fcc7;
-			Distance[35][13]=2+fcc8;
-			Distance[35][9]=2+fcc9;
-			Distance[25][11]=2+fcc7;
-			Distance[25][13]=2+fcc8;
-			Distance[25][9]=2+fcc9;
-			Distance[16][11]=2+fcc7;
-			Distance[16][13]=2+fcc8;
-			Distance[16][9]=2+fcc9;
-			Distance[11][24]=1+fcc10;
-			Distance[11][10]=2+fcc11;
-			Distance[11][20]=1+fcc12;
-			Distance[13][24]=2+fcc10;
-			Distance[13][10]=2+fcc11;
-			Distance[13][20]=3+fcc12;
-			Distance[9][24]=3+fcc10;
-			Distance[9][10]=2+fcc11;
-			Distance[9][20]=3+fcc12;
-			Distance[24][38]=2;
-			Distance[10][38]=1;
-			Distance[20][38]=2;
-			}
-			if(functionType==6){
-			Distance[0][35]=1+fcc1;
-			Distance[0][25]=3+fcc2;
-			Distance[0][16]=3+fcc3;
-			Distance[35][11]=2+fcc7;
-			Distance[35][13]=2+fcc8;
-			Distance[35][9]=2+fcc9;
-			Distance[25][11]=2+fcc7;
-			Distance[25][13]=2+fcc8;
-			Distance[25][9]=2+fcc9;
-			Distance[16][11]=2+fcc7;
-			Distance[16][13]=2+fcc8;
-			Distance[16][9]=2+fcc9;
-			Distance[11][4]=2+fcc13;
-			Distance[11][15]=1+fcc14;
-			Distance[11][36]=3+fcc15;
-			Distance[13][4]=3+fcc13;
-			Distance[13][15]=3+fcc14;
-			Distance[13][36]=3+fcc15;
-			Distance[9][4]=4+fcc13;
-			Distance[9][15]=3+fcc14;
-			Distance[9][36]=3+fcc15;
-			Distance[4][38]=3;
-			Distance[15][38]=2;
-			Distance[36][38]=2;
-			}
-			if(functionType==7){
-			Distance[0][11]=1+fcc7;
-			Distance[0][13]=3+fcc8;
-			Distance[0][9]=3+fcc9;
-			Distance[11][35]=2+fcc1;
-			Distance[11][25]=2+fcc2;
-			Distance[11][16]=2+fcc3;
-			Distance[13][35]=2+fcc1;
-			Distance[13][25]=2+fcc2;
-			Distance[13][16]=2+fcc3;
-			Distance[9][35]=2+fcc1;
-			Distance[9][25]=2+fcc2;
-			Distance[9][16]=2+fcc3;
-			Distance[35][24]=3+fcc10;
-			Distance[35][10]=2+fcc11;
-			Distance[35][20]=3+fcc12;
-			Distance[25][24]=3+fcc10;
-			Distance[25][10]=2+fcc11;
-			Distance[25][20]=3+fcc12;
-			Distance[16][24]=3+fcc10;
-			Distance[16][10]=2+fcc11;
-			Distance[16][20]=3+fcc12;
-			Distance[24][38]=2;
-			Distance[10][38]=1;
-			Distance[20][38]=2;
-			}
-			if(functionType==8){
-			Distance[0][11]=1+fcc7;
-			Distance[0][13]=3+fcc8;
-			Distance[0][9]=3+fcc9;
-			Distance[11][35]=2+fcc1;
-			Distance[11][25]=2+fcc2;
-			Distance[11][16]=2+fcc3;
-			Distance[13][35]=2+fcc1;
-			Distance[13][25]=2+fcc2;
-			Distance[13][16]=2+fcc3;
-			Distance[9][35]=2+fcc1;
-			Distance[9][25]=2+fcc2;
-			Distance[9][16]=2+fcc3;
-			Distance[35][4]=4+fcc13;
-			Distance[35][15]=3+fcc14;
-			Distance[35][36]=1+fcc15;
-			Distance[25][4]=4+fcc13;
-			Distance[25][15]=3+fcc14;
-			Distance[25][36]=3+fcc15;
-			Distance[16][4]=4+fcc13;
-			Distance[16][15]=3+fcc14;
-			Distance[16][36]=3+fcc15;
-			Distance[4][38]=3;
-			Distance[15][38]=2;
-			Distance[36][38]=2;
-			}
-			if(functionType==9){
-			Distance[0][7]=4+fcc4;
-			Distance[0][21]=2+fcc5;
-			Distance[0][31]=3+fcc6;
-			Distance[7][11]=3+fcc7;
-			Distance[7][13]=2+fcc8;
-			Distance[7][9]=4+fcc9;
-			Distance[21][11]=2+fcc7;
-			Distance[21][13]=2+fcc8;
-			Distance[21][9]=2+fcc9;
-			Distance[31][11]=2+fcc7;
-			Distance[31][13]=2+fcc8;
-			Distance[31][9]=2+fcc9;
-			Distance[11][24]=1+fcc10;
-			Distance[11][10]=2+fcc11;
-			Distance[11][20]=1+fcc12;
-			Distance[13][24]=2+fcc10;
-			Distance[13][10]=2+fcc11;
-			Distance[13][20]=3+fcc12;
-			Distance[9][24]=3+fcc10;
-			Distance[9][10]=2+fcc11;
-			Distance[9][20]=3+fcc12;
-			Distance[24][38]=2;
-			Distance[10][38]=1;
-			Distance[20][38]=2;
-			}
-			if(functionType==10){
-			Distance[0][7]=4+fcc4;
-			Distance[0][21]=2+fcc5;
-			Distance[0][31]=3+fcc6;
-			Distance[7][11]=3+fcc7;
-			Distance[7][13]=2+fcc8;
-			Distance[7][9]=4+fcc9;
-			Distance[21][11]=2+fcc7;
-			Distance[21][13]=2+fcc8;
-			Distance[21][9]=2+fcc9;
-			Distance[31][11]=2+fcc7;
-			Distance[31][13]=2+fcc8;
-			Distance[31][9]=2+fcc9;
-			Distance[11][4]=2+fcc13;
-			Distance[11][15]=1+fcc14;
-			Distance[11][36]=3+fcc15;
-			Distance[13][4]=3+fcc13;
-			Distance[13][15]=3+fcc14;
-			Distance[13][36]=3+fcc15;
-			Distance[9][4]=4+fcc13;
-			Distance[9][15]=3+fcc14;
-			Distance[9][36]=3+fcc15;
-			Distance[4][38]=3;
-			Distance[15][38]=2;
-			Distance[36][38]=2;
-			}
-			if(functionType==11){
-			Distance[0][11]=1+fcc7;
-			Distance[0][13]=3+fcc8;
-			Distance[0][9]=3+fcc9;
-			Distance[11][7]=3+fcc4;
-			Distance[11][21]=2+fcc5;
-			Distance[11][31]=2+fcc6;
-			Distance[13][7]=2+fcc4;
-			Distance[13][21]=2+fcc5;
-			Distance[13][31]=2+fcc6;
-			Distance[9][7]=4+fcc4;
-			Distance[9][21]=2+fcc5;
-			Distance[9][31]=2+fcc6;
-			Distance[7][24]=2+fcc10;
-			Distance[7][10]=4+fcc11;
-			Distance[7][20]=4+fcc12;
-			Distance[21][24]=3+fcc10;
-			Distance[21][10]=2+fcc11;
-			Distance[21][20]=3+fcc12;
-			Distance[31][24]=3+fcc10;
-			Distance[31][10]=2+fcc11;
-			Distance[31][20]=3+fcc12;
-			Distance[24][38]=2;
-			Distance[10][38]=1;
-			Distance[20][38]=2;
-			}
-			if(functionType==12){
-			Distance[0][11]=1+fcc7;
-			Distance[0][13]=3+fcc8;
-			Distance[0][9]=3+fcc9;
-			Distance[11][7]=3+fcc4;
-			Distance[11][21]=2+fcc5;
-			Distance[11][31]=2+fcc6;
-			Distance[13][7]=2+fcc4;
-			Distance[13][21]=2+fcc5;
-			Distance[13][31]=2+fcc6;
-			Distance[9][7]=4+fcc4;
-			Distance[9][21]=2+fcc5;
-			Distance[9][31]=2+fcc6;
-			Distance[7][4]=3+fcc13;
-			Distance[7][15]=4+fcc14;
-			Distance[7][36]=5+fcc15;
-			Distance[21][4]=4+fcc13;
-			Distance[21][15]=3+fcc14;
-			Distance[21][36]=2+fcc15;
-			Distance[31][4]=4+fcc13;
-			Distance[31][15]=3+fcc14;
-			Distance[31][36]=3+fcc15;
-			Distance[4][38]=3;
-			Distance[15][38]=2;
-			Distance[36][38]=2;
-			}
-		}	
-*/    //Sinet
-
-			//Geant
-			///*
-			if (consumerNode == 0){
-			if(functionType==1){
-			Distance[0][35]=3+fcc1;
-			Distance[0][25]=4+fcc2;
-			Distance[0][16]=2+fcc3;
-			Distance[35][7]=4+fcc4;
-			Distance[35][21]=5+fcc5;
-			Distance[35][31]=5+fcc6;
-			Distance[25][7]=4+fcc4;
-			Distance[25][21]=2+fcc5;
-			Distance[25][31]=5+fcc6;
-			Distance[16][7]=2+fcc4;
-			Distance[16][21]=3+fcc5;
-			Distance[16][31]=4+fcc6;
-			Distance[7][24]=2+fcc10;
-			Distance[7][10]=3+fcc11;
-			Distance[7][20]=3+fcc12;
-			Distance[21][24]=2+fcc10;
-			Distance[21][10]=2+fcc11;
-			Distance[21][20]=1+fcc12;
-			Distance[31][24]=3+fcc10;
-			Distance[31][10]=4+fcc11;
-			Distance[31][20]=4+fcc12;
-			Distance[24][38]=2;
-			Distance[10][38]=1;
-			Distance[20][38]=2;
-			}
-			if(functionType==2){
-			Distance[0][35]=3+fcc1;
-			Distance[0][25]=4+fcc2;
-			Distance[0][16]=2+fcc3;
-			Distance[35][7]=4+fcc4;
-			Distance[35][21]=5+fcc5;
-			Distance[35][31]=5+fcc6;
-			Distance[25][7]=4+fcc4;
-			Distance[25][21]=2+fcc5;
-			Distance[25][31]=5+fcc6;
-			Distance[16][7]=2+fcc4;
-			Distance[16][21]=3+fcc5;
-			Distance[16][31]=4+fcc6;
-			Distance[7][4]=2+fcc13;
-			Distance[7][15]=2+fcc14;
-			Distance[7][36]=3+fcc15;
-			Distance[21][4]=2+fcc13;
-			Distance[21][15]=3+fcc14;
-			Distance[21][36]=4+fcc15;
-			Distance[31][4]=4+fcc13;
-			Distance[31][15]=2+fcc14;
-			Distance[31][36]=4+fcc15;
-			Distance[4][38]=2;
-			Distance[15][38]=2;
-			Distance[36][38]=3;
-			}
-			if(functionType==3){
-			Distance[0][7]=2+fcc4;
-			Distance[0][21]=3+fcc5;
-			Distance[0][31]=2+fcc6;
-			Distance[7][35]=4+fcc1;
-			Distance[7][25]=4+fcc2;
-			Distance[7][16]=2+fcc3;
-			Distance[21][35]=5+fcc1;
-			Distance[21][25]=2+fcc2;
-			Distance[21][16]=3+fcc3;
-			Distance[31][35]=5+fcc1;
-			Distance[31][25]=5+fcc2;
-			Distance[31][16]=4+fcc3;
-			Distance[35][24]=5+fcc10;
-			Distance[35][10]=5+fcc11;
-			Distance[35][20]=6+fcc12;
-			Distance[25][24]=2+fcc10;
-			Distance[25][10]=3+fcc11;
-			Distance[25][20]=1+fcc12;
-			Distance[16][24]=3+fcc10;
-			Distance[16][10]=3+fcc11;
-			Distance[16][20]=4+fcc12;
-			Distance[24][38]=2;
-			Distance[10][38]=1;
-			Distance[20][38]=2;
-			}
-			if(functionType==4){
-			Distance[0][7]=2+fcc4;
-			Distance[0][21]=3+fcc5;
-			Distance[0][31]=2+fcc6;
-			Distance[7][35]=4+fcc1;
-			Distance[7][25]=4+fcc2;
-			Distance[7][16]=2+fcc3;
-			Distance[21][35]=5+fcc1;
-			Distance[21][25]=2+fcc2;
-			Distance[21][16]=3+fcc3;
-			Distance[31][35]=5+fcc1;
-			Distance[31][25]=5+fcc2;
-			Distance[31][16]=4+fcc3;
-			Distance[35][4]=4+fcc13;
-			Distance[35][15]=4+fcc14;
-			Distance[35][36]=3+fcc15;
-			Distance[25][4]=4+fcc13;
-			Distance[25][15]=4+fcc14;
-			Distance[25][36]=5+fcc15;
-			Distance[16][4]=2+fcc13;
-			Distance[16][15]=2+fcc14;
-			Distance[16][36]=3+fcc15;
-			Distance[4][38]=2;
-			Distance[15][38]=2;
-			Distance[36][38]=3;
-			}
-			if(functionType==5){
-			Distance[0][35]=3+fcc1;
-			Distance[0][25]=4+fcc2;
-			Distance[0][16]=2+fcc3;
-			Distance[35][11]=6+fcc7;
-			Distance[35][13]=7+fcc8;
-			Distance[35][9]=4+fcc9;
-			Distance[25][11]=2+fcc7;
-			Distance[25][13]=3+fcc8;
-			Distance[25][9]=3+fcc9;
-			Distance[16][11]=4+fcc7;
-			Distance[16][13]=5+fcc8;
-			Distance[16][9]=2+fcc9;
-			Distance[11][24]=2+fcc10;
-			Distance[11][10]=2+fcc11;
-			Distance[11][20]=1+fcc12;
-			Distance[13][24]=3+fcc10;
-			Distance[13][10]=3+fcc11;
-			Distance[13][20]=2+fcc12;
-			Distance[9][24]=1+fcc10;
-			Distance[9][10]=1+fcc11;
-			Distance[9][20]=2+fcc12;
-			Distance[24][38]=2;
-			Distance[10][38]=1;
-			Distance[20][38]=2;
-			}
-			if(functionType==6){
-			Distance[0][35]=3+fcc1;
-			Distance[0][25]=4+fcc2;
-			Distance[0][16]=2+fcc3;
-			Distance[35][11]=6+fcc7;
-			Distance[35][13]=7+fcc8;
-			Distance[35][9]=4+fcc9;
-			Distance[25][11]=2+fcc7;
-			Distance[25][13]=3+fcc8;
-			Distance[25][9]=3+fcc9;
-			Distance[16][11]=4+fcc7;
-			Distance[16][13]=5+fcc8;
-			Distance[16][9]=2+fcc9;
-			Distance[11][4]=4+fcc13;
-			Distance[11][15]=4+fcc14;
-			Distance[11][36]=5+fcc15;
-			Distance[13][4]=5+fcc13;
-			Distance[13][15]=5+fcc14;
-			Distance[13][36]=6+fcc15;
-			Distance[9][4]=2+fcc13;
-			Distance[9][15]=2+fcc14;
-			Distance[9][36]=3+fcc15;
-			Distance[4][38]=2;
-			Distance[15][38]=2;
-			Distance[36][38]=3;
-			}
-			if(functionType==7){
-			Distance[0][11]=4+fcc7;
-			Distance[0][13]=5+fcc8;
-			Distance[0][9]=2+fcc9;
-			Distance[11][35]=6+fcc1;
-			Distance[11][25]=2+fcc2;
-			Distance[11][16]=4+fcc3;
-			Distance[13][35]=7+fcc1;
-			Distance[13][25]=3+fcc2;
-			Distance[13][16]=5+fcc3;
-			Distance[9][35]=4+fcc1;
-			Distance[9][25]=3+fcc2;
-			Distance[9][16]=2+fcc3;
-			Distance[35][24]=5+fcc10;
-			Distance[35][10]=5+fcc11;
-			Distance[35][20]=6+fcc12;
-			Distance[25][24]=2+fcc10;
-			Distance[25][10]=3+fcc11;
-			Distance[25][20]=1+fcc12;
-			Distance[16][24]=3+fcc10;
-			Distance[16][10]=3+fcc11;
-			Distance[16][20]=4+fcc12;
-			Distance[24][38]=2;
-			Distance[10][38]=1;
-			Distance[20][38]=2;
-			}
-			if(functionType==8){
-			Distance[0][11]=4+fcc7;
-			Distance[0][13]=5+fcc8;
-			Distance[0][9]=2+fcc9;
-			Distance[11][35]=6+fcc1;
-			Distance[11][25]=2+fcc2;
-			Distance[11][16]=4+fcc3;
-			Distance[13][35]=7+fcc1;
-			Distance[13][25]=3+fcc2;
-			Distance[13][16]=5+fcc3;
-			Distance[9][35]=4+fcc1;
-			Distance[9][25]=3+fcc2;
-			Distance[9][16]=2+fcc3;
-			Distance[35][4]=4+fcc13;
-			Distance[35][15]=4+fcc14;
-			Distance[35][36]=3+fcc15;
-			Distance[25][4]=4+fcc13;
-			Distance[25][15]=4+fcc14;
-			Distance[25][36]=5+fcc15;
-			Distance[16][4]=2+fcc13;
-			Distance[16][15]=2+fcc14;
-			Distance[16][36]=3+fcc15;
-			Distance[4][38]=2;
-			Distance[15][38]=2;
-			Distance[36][38]=3;
-			}
-			if(functionType==9){
-			Distance[0][7]=2+fcc4;
-			Distance[0][21]=3+fcc5;
-			Distance[0][31]=2+fcc6;
-			Distance[7][11]=4+fcc7;
-			Distance[7][13]=5+fcc8;
-			Distance[7][9]=2+fcc9;
-			Distance[21][11]=2+fcc7;
-			Distance[21][13]=3+fcc8;
-			Distance[21][9]=3+fcc9;
-			Distance[31][11]=5+fcc7;
-			Distance[31][13]=6+fcc8;
-			Distance[31][9]=3+fcc9;
-			Distance[11][24]=2+fcc10;
-			Distance[11][10]=2+fcc11;
-			Distance[11][20]=1+fcc12;
-			Distance[13][24]=3+fcc10;
-			Distance[13][10]=3+fcc11;
-			Distance[13][20]=2+fcc12;
-			Distance[9][24]=1+fcc10;
-			Distance[9][10]=1+fcc11;
-			Distance[9][20]=2+fcc12;
-			Distance[24][38]=2;
-			Distance[10][38]=1;
-			Distance[20][38]=2;
-			}
-			if(functionType==10){
-			Distance[0][7]=2+fcc4;
-			Distance[0][21]=3+fcc5;
-			Distance[0][31]=2+fcc6;
-			Distance[7][11]=4+fcc7;
-			Distance[7][13]=5+fcc8;
-			Distance[7][9]=2+fcc9;
-			Distance[21][11]=2+fcc7;
-			Distance[21][13]=3+fcc8;
-			Distance[21][9]=3+fcc9;
-			Distance[31][11]=5+fcc7;
-			Distance[31][13]=6+fcc8;
-			Distance[31][9]=3+fcc9;
-			Distance[11][4]=4+fcc13;
-			Distance[11][15]=4+fcc14;
-			Distance[11][36]=5+fcc15;
-			Distance[13][4]=5+fcc13;
-			Distance[13][15]=5+fcc14;
-			Distance[13][36]=6+fcc15;
-			Distance[9][4]=2+fcc13;
-			Distance[9][15]=2+fcc14;
-			Distance[9][36]=3+fcc15;
-			Distance[4][38]=2;
-			Distance[15][38]=2;
-			Distance[36][38]=3;
-			}
-			if(functionType==11){
-			Distance[0][11]=4+fcc7;
-			Distance[0][13]=5+fcc8;
-			Distance[0][9]=2+fcc9;
-			Distance[11][7]=4+fcc4;
-			Distance[11][21]=2+fcc5;
-			Distance[11][31]=5+fcc6;
-			Distance[13][7]=5+fcc4;
-			Distance[13][21]=3+fcc5;
-			Distance[13][31]=6+fcc6;
-			Distance[9][7]=2+fcc4;
-			Distance[9][21]=3+fcc5;
-			Distance[9][31]=3+fcc6;
-			Distance[7][24]=2+fcc10;
-			Distance[7][10]=3+fcc11;
-			Distance[7][20]=3+fcc12;
-			Distance[21][24]=2+fcc10;
-			Distance[21][10]=2+fcc11;
-			Distance[21][20]=1+fcc12;
-			Distance[31][24]=3+fcc10;
-			Distance[31][10]=4+fcc11;
-			Distance[31][20]=4+fcc12;
-			Distance[24][38]=2;
-			Distance[10][38]=1;
-			Distance[20][38]=2;
-			}
-			if(functionType==12){
-			Distance[0][11]=4+fcc7;
-			Distance[0][13]=5+fcc8;
-			Distance[0][9]=2+fcc9;
-			Distance[11][7]=4+fcc4;
-			Distance[11][21]=2+fcc5;
-			Distance[11][31]=5+fcc6;
-			Distance[13][7]=5+fcc4;
-			Distance[13][21]=3+fcc5;
-			Distance[13][31]=6+fcc6;
-			Distance[9][7]=2+fcc4;
-			Distance[9][21]=3+fcc5;
-			Distance[9][31]=3+fcc6;
-			Distance[7][4]=2+fcc13;
-			Distance[7][15]=2+fcc14;
-			Distance[7][36]=3+fcc15;
-			Distance[21][4]=2+fcc13;
-			Distance[21][15]=3+fcc14;
-			Distance[21][36]=4+fcc15;
-			Distance[31][4]=4+fcc13;
-			Distance[31][15]=2+fcc14;
-			Distance[31][36]=4+fcc15;
-			Distance[4][38]=2;
-			Distance[15][38]=2;
-			Distance[36][38]=3;
-			}
-			}
-			if (consumerNode == 54){
-			if(functionType==1){
-			Distance[0][35]=4+fcc1;
-			Distance[0][25]=4+fcc2;
-			Distance[0][16]=2+fcc3;
-			Distance[35][7]=4+fcc4;
-			Distance[35][21]=5+fcc5;
-			Distance[35][31]=5+fcc6;
-			Distance[25][7]=4+fcc4;
-			Distance[25][21]=2+fcc5;
-			Distance[25][31]=5+fcc6;
-			Distance[16][7]=2+fcc4;
-			Distance[16][21]=3+fcc5;
-			Distance[16][31]=4+fcc6;
-			Distance[7][24]=2+fcc10;
-			Distance[7][10]=3+fcc11;
-			Distance[7][20]=3+fcc12;
-			Distance[21][24]=2+fcc10;
-			Distance[21][10]=2+fcc11;
-			Distance[21][20]=1+fcc12;
-			Distance[31][24]=3+fcc10;
-			Distance[31][10]=4+fcc11;
-			Distance[31][20]=4+fcc12;
-			Distance[24][38]=2;
-			Distance[10][38]=1;
-			Distance[20][38]=2;
-			}
-			if(functionType==2){
-			Distance[0][35]=4+fcc1;
-			Distance[0][25]=4+fcc2;
-			Distance[0][16]=2+fcc3;
-			Distance[35][7]=4+fcc4;
-			Distance[35][21]=5+fcc5;
-			Distance[35][31]=5+fcc6;
-			Distance[25][7]=4+fcc4;
-			Distance[25][21]=2+fcc5;
-			Distance[25][31]=5+fcc6;
-			Distance[16][7]=2+fcc4;
-			Distance[16][21]=3+fcc5;
-			Distance[16][31]=4+fcc6;
-			Distance[7][4]=2+fcc13;
-			Distance[7][15]=2+fcc14;
-			Distance[7][36]=3+fcc15;
-			Distance[21][4]=2+fcc13;
-			Distance[21][15]=3+fcc14;
-			Distance[21][36]=4+fcc15;
-			Distance[31][4]=4+fcc13;
-			Distance[31][15]=2+fcc14;
-			Distance[31][36]=4+fcc15;
-			Distance[4][38]=2;
-			Distance[15][38]=2;
-			Distance[36][38]=3;
-			}
-			if(functionType==3){
-			Distance[0][7]=0+fcc4;
-			Distance[0][21]=3+fcc5;
-			Distance[0][31]=3+fcc6;
-			Distance[7][35]=4+fcc1;
-			Distance[7][25]=4+fcc2;
-			Distance[7][16]=2+fcc3;
-			Distance[21][35]=5+fcc1;
-			Distance[21][25]=2+fcc2;
-			Distance[21][16]=3+fcc3;
-			Distance[31][35]=5+fcc1;
-			Distance[31][25]=5+fcc2;
-			Distance[31][16]=4+fcc3;
-			Distance[35][24]=5+fcc10;
-			Distance[35][10]=5+fcc11;
-			Distance[35][20]=6+fcc12;
-			Distance[25][24]=2+fcc10;
-			Distance[25][10]=3+fcc11;
-			Distance[25][20]=1+fcc12;
-			Distance[16][24]=3+fcc10;
-			Distance[16][10]=3+fcc11;
-			Distance[16][20]=4+fcc12;
-			Distance[24][38]=2;
-			Distance[10][38]=1;
-			Distance[20][38]=2;
-			}
-			if(functionType==4){
-			Distance[0][7]=0+fcc4;
-			Distance[0][21]=3+fcc5;
-			Distance[0][31]=3+fcc6;
-			Distance[7][35]=4+fcc1;
-			Distance[7][25]=4+fcc2;
-			Distance[7][16]=2+fcc3;
-			Distance[21][35]=5+fcc1;
-			Distance[21][25]=2+fcc2;
-			Distance[21][16]=3+fcc3;
-			Distance[31][35]=5+fcc1;
-			Distance[31][25]=5+fcc2;
-			Distance[31][16]=4+fcc3;
-			Distance[35][4]=4+fcc13;
-			Distance[35][15]=4+fcc14;
-			Distance[35][36]=3+fcc15;
-			Distance[25][4]=4+fcc13;
-			Distance[25][15]=4+fcc14;
-			Distance[25][36]=5+fcc15;
-			Distance[16][4]=2+fcc13;
-			Distance[16][15]=2+fcc14;
-			Distance[16][36]=3+fcc15;
-			Distance[4][38]=2;
-			Distance[15][38]=2;
-			Distance[36][38]=3;
-			}
-			if(functionType==5){
-			Distance[0][35]=4+fcc1;
-			Distance[0][25]=4+fcc2;
-			Distance[0][16]=2+fcc3;
-			Distance[35][11]=6+fcc7;
-			Distance[35][13]=7+fcc8;
-			Distance[35][9]=4+fcc9;
-			Distance[25][11]=2+fcc7;
-			Distance[25][13]=3+fcc8;
-			Distance[25][9]=3+fcc9;
-			Distance[16][11]=4+fcc7;
-			Distance[16][13]=5+fcc8;
-			Distance[16][9]=2+fcc9;
-			Distance[11][24]=2+fcc10;
-			Distance[11][10]=2+fcc11;
-			Distance[11][20]=1+fcc12;
-			Distance[13][24]=3+fcc10;
-			Distance[13][10]=3+fcc11;
-			Distance[13][20]=2+fcc12;
-			Distance[9][24]=1+fcc10;
-			Distance[9][10]=1+fcc11;
-			Distance[9][20]=2+fcc12;
-			Distance[24][38]=2;
-			Distance[10][38]=1;
-			Distance[20][38]=2;
-			}
-			if(functionType==6){
-			Distance[0][35]=4+fcc1;
-			Distance[0][25]=4+fcc2;
-			Distance[0][16]=2+fcc3;
-			Distance[35][11]=6+fcc7;
-			Distance[35][13]=7+fcc8;
-			Distance[35][9]=4+fcc9;
-			Distance[25][11]=2+fcc7;
-			Distance[25][13]=3+fcc8;
-			Distance[25][9]=3+fcc9;
-			Distance[16][11]=4+fcc7;
-			Distance[16][13]=5+fcc8;
-			Distance[16][9]=2+fcc9;
-			Distance[11][4]=4+fcc13;
-			Distance[11][15]=4+fcc14;
-			Distance[11][36]=5+fcc15;
-			Distance[13][4]=5+fcc13;
-			Distance[13][15]=5+fcc14;
-			Distance[13][36]=6+fcc15;
-			Distance[9][4]=2+fcc13;
-			Distance[9][15]=2+fcc14;
-			Distance[9][36]=3+fcc15;
-			Distance[4][38]=2;
-			Distance[15][38]=2;
-			Distance[36][38]=3;
-			}
-			if(functionType==7){
-			Distance[0][11]=4+fcc7;
-			Distance[0][13]=5+fcc8;
-			Distance[0][9]=2+fcc9;
-			Distance[11][35]=6+fcc1;
-			Distance[11][25]=2+fcc2;
-			Distance[11][16]=4+fcc3;
-			Distance[13][35]=7+fcc1;
-			Distance[13][25]=3+fcc2;
-			Distance[13][16]=5+fcc3;
-			Distance[9][35]=4+fcc1;
-			Distance[9][25]=3+fcc2;
-			Distance[9][16]=2+fcc3;
-			Distance[35][24]=5+fcc10;
-			Distance[35][10]=5+fcc11;
-			Distance[35][20]=6+fcc12;
-			Distance[25][24]=2+fcc10;
-			Distance[25][10]=3+fcc11;
-			Distance[25][20]=1+fcc12;
-			Distance[16][24]=3+fcc10;
-			Distance[16][10]=3+fcc11;
-			Distance[16][20]=4+fcc12;
-			Distance[24][38]=2;
-			Distance[10][38]=1;
-			Distance[20][38]=2;
-			}
-			if(functionType==8){
-			Distance[0][11]=4+fcc7;
-			Distance[0][13]=5+fcc8;
-			Distance[0][9]=2+fcc9;
-			Distance[11][35]=6+fcc1;
-			Distance[11][25]=2+fcc2;
-			Distance[11][16]=4+fcc3;
-			Distance[13][35]=7+fcc1;
-			Distance[13][25]=3+fcc2;
-			Distance[13][16]=5+fcc3;
-			Distance[9][35]=4+fcc1;
-			Distance[9][25]=3+fcc2;
-			Distance[9][16]=2+fcc3;
-			Distance[35][4]=4+fcc13;
-			Distance[35][15]=4+fcc14;
-			Distance[35][36]=3+fcc15;
-			Distance[25][4]=4+fcc13;
-			Distance[25][15]=4+fcc14;
-			Distance[25][36]=5+fcc15;
-			Distance[16][4]=2+fcc13;
-			Distance[16][15]=2+fcc14;
-			Distance[16][36]=3+fcc15;
-			Distance[4][38]=2;
-			Distance[15][38]=2;
-			Distance[36][38]=3;
-			}
-			if(functionType==9){
-			Distance[0][7]=0+fcc4;
-			Distance[0][21]=3+fcc5;
-			Distance[0][31]=3+fcc6;
-			Distance[7][11]=4+fcc7;
-			Distance[7][13]=5+fcc8;
-			Distance[7][9]=2+fcc9;
-			Distance[21][11]=2+fcc7;
-			Distance[21][13]=3+fcc8;
-			Distance[21][9]=3+fcc9;
-			Distance[31][11]=5+fcc7;
-			Distance[31][13]=6+fcc8;
-			Distance[31][9]=3+fcc9;
-			Distance[11][24]=2+fcc10;
-			Distance[11][10]=2+fcc11;
-			Distance[11][20]=1+fcc12;
-			Distance[13][24]=3+fcc10;
-			Distance[13][10]=3+fcc11;
-			Distance[13][20]=2+fcc12;
-			Distance[9][24]=1+fcc10;
-			Distance[9][10]=1+fcc11;
-			Distance[9][20]=2+fcc12;
-			Distance[24][38]=2;
-			Distance[10][38]=1;
-			Distance[20][38]=2;
-			}
-			if(functionType==10){
-			Distance[0][7]=0+fcc4;
-			Distance[0][21]=3+fcc5;
-			Distance[0][31]=3+fcc6;
-			Distance[7][11]=4+fcc7;
-			Distance[7][13]=5+fcc8;
-			Distance[7][9]=2+fcc9;
-			Distance[21][11]=2+fcc7;
-			Distance[21][13]=3+fcc8;
-			Distance[21][9]=3+fcc9;
-			Distance[31][11]=5+fcc7;
-			Distance[31][13]=6+fcc8;
-			Distance[31][9]=3+fcc9;
-			Distance[11][4]=4+fcc13;
-			Distance[11][15]=4+fcc14;
-			Distance[11][36]=5+fcc15;
-			Distance[13][4]=5+fcc13;
-			Distance[13][15]=5+fcc14;
-			Distance[13][36]=6+fcc15;
-			Distance[9][4]=2+fcc13;
-			Distance[9][15]=2+fcc14;
-			Distance[9][36]=3+fcc15;
-			Distance[4][38]=2;
-			Distance[15][38]=2;
-			Distance[36][38]=3;
-			}
-			if(functionType==11){
-			Distance[0][11]=4+fcc7;
-			Distance[0][13]=5+fcc8;
-			Distance[0][9]=2+fcc9;
-			Distance[11][7]=4+fcc4;
-			Distance[11][21]=2+fcc5;
-			Distance[11][31]=5+fcc6;
-			Distance[13][7]=5+fcc4;
-			Distance[13][21]=3+fcc5;
-			Distance[13][31]=6+fcc6;
-			Distance[9][7]=2+fcc4;
-			Distance[9][21]=3+fcc5;
-			Distance[9][31]=3+fcc6;
-			Distance[7][24]=2+fcc10;
-			Distance[7][10]=3+fcc11;
-			Distance[7][20]=3+fcc12;
-			Distance[21][24]=2+fcc10;
-			Distance[21][10]=2+fcc11;
-			Distance[21][20]=1+fcc12;
-			Distance[31][24]=3+fcc10;
-			Distance[31][10]=4+fcc11;
-			Distance[31][20]=4+fcc12;
-			Distance[24][38]=2;
-			Distance[10][38]=1;
-			Distance[20][38]=2;
-			}
-			if(functionType==12){
-			Distance[0][11]=4+fcc7;
-			Distance[0][13]=5+fcc8;
-			Distance[0][9]=2+fcc9;
-			Distance[11][7]=4+fcc4;
-			Distance[11][21]=2+fcc5;
-			Distance[11][31]=5+fcc6;
-			Distance[13][7]=5+fcc4;
-			Distance[13][21]=3+fcc5;
-			Distance[13][31]=6+fcc6;
-			Distance[9][7]=2+fcc4;
-			Distance[9][21]=3+fcc5;
-			Distance[9][31]=3+fcc6;
-			Distance[7][4]=2+fcc13;
-			Distance[7][15]=2+fcc14;
-			Distance[7][36]=3+fcc15;
-			Distance[21][4]=2+fcc13;
-			Distance[21][15]=3+fcc14;
-			Distance[21][36]=4+fcc15;
-			Distance[31][4]=4+fcc13;
-			Distance[31][15]=2+fcc14;
-			Distance[31][36]=4+fcc15;
-			Distance[4][38]=2;
-			Distance[15][38]=2;
-			Distance[36][38]=3;
-			}
-			}
-			if (consumerNode == 55){
-			if(functionType==1){
-			Distance[0][35]=6+fcc1;
-			Distance[0][25]=2+fcc2;
-			Distance[0][16]=4+fcc3;
-			Distance[35][7]=4+fcc4;
-			Distance[35][21]=5+fcc5;
-			Distance[35][31]=5+fcc6;
-			Distance[25][7]=4+fcc4;
-			Distance[25][21]=2+fcc5;
-			Distance[25][31]=5+fcc6;
-			Distance[16][7]=2+fcc4;
-			Distance[16][21]=3+fcc5;
-			Distance[16][31]=4+fcc6;
-			Distance[7][24]=2+fcc10;
-			Distance[7][10]=3+fcc11;
-			Distance[7][20]=3+fcc12;
-			Distance[21][24]=2+fcc10;
-			Distance[21][10]=2+fcc11;
-			Distance[21][20]=1+fcc12;
-			Distance[31][24]=3+fcc10;
-			Distance[31][10]=4+fcc11;
-			Distance[31][20]=4+fcc12;
-			Distance[24][38]=4;
-			Distance[10][38]=5;
-			Distance[20][38]=5;
-			}
-			if(functionType==2){
-			Distance[0][35]=6+fcc1;
-			Distance[0][25]=2+fcc2;
-			Distance[0][16]=4+fcc3;
-			Distance[35][7]=4+fcc4;
-			Distance[35][21]=5+fcc5;
-			Distance[35][31]=5+fcc6;
-			Distance[25][7]=4+fcc4;
-			Distance[25][21]=2+fcc5;
-			Distance[25][31]=5+fcc6;
-			Distance[16][7]=2+fcc4;
-			Distance[16][21]=3+fcc5;
-			Distance[16][31]=4+fcc6;
-			Distance[7][4]=2+fcc13;
-			Distance[7][15]=2+fcc14;
-			Distance[7][36]=3+fcc15;
-			Distance[21][4]=2+fcc13;
-			Distance[21][15]=3+fcc14;
-			Distance[21][36]=4+fcc15;
-			Distance[31][4]=4+fcc13;
-			Distance[31][15]=2+fcc14;
-			Distance[31][36]=4+fcc15;
-			Distance[4][38]=5;
-			Distance[15][38]=3;
-			Distance[36][38]=5;
-			}
-			if(functionType==3){
-			Distance[0][7]=4+fcc4;
-			Distance[0][21]=2+fcc5;
-			Distance[0][31]=5+fcc6;
-			Distance[7][35]=4+fcc1;
-			Distance[7][25]=4+fcc2;
-			Distance[7][16]=2+fcc3;
-			Distance[21][35]=5+fcc1;
-			Distance[21][25]=2+fcc2;
-			Distance[21][16]=3+fcc3;
-			Distance[31][35]=5+fcc1;
-			Distance[31][25]=5+fcc2;
-			Distance[31][16]=4+fcc3;
-			Distance[35][24]=5+fcc10;
-			Distance[35][10]=5+fcc11;
-			Distance[35][20]=6+fcc12;
-			Distance[25][24]=2+fcc10;
-			Distance[25][10]=3+fcc11;
-			Distance[25][20]=1+fcc12;
-			Distance[16][24]=3+fcc10;
-			Distance[16][10]=3+fcc11;
-			Distance[16][20]=4+fcc12;
-			Distance[24][38]=4;
-			Distance[10][38]=5;
-			Distance[20][38]=5;
-			}
-			if(functionType==4){
-			Distance[0][7]=4+fcc4;
-			Distance[0][21]=2+fcc5;
-			Distance[0][31]=5+fcc6;
-			Distance[7][35]=4+fcc1;
-			Distance[7][25]=4+fcc2;
-			Distance[7][16]=2+fcc3;
-			Distance[21][35]=5+fcc1;
-			Distance[21][25]=2+fcc2;
-			Distance[21][16]=3+fcc3;
-			Distance[31][35]=5+fcc1;
-			Distance[31][25]=5+fcc2;
-			Distance[31][16]=4+fcc3;
-			Distance[35][4]=4+fcc13;
-			Distance[35][15]=4+fcc14;
-			Distance[35][36]=3+fcc15;
-			Distance[25][4]=4+fcc13;
-			Distance[25][15]=4+fcc14;
-			Distance[25][36]=5+fcc15;
-			Distance[16][4]=2+fcc13;
-			Distance[16][15]=2+fcc14;
-			Distance[16][36]=3+fcc15;
-			Distance[4][38]=5;
-			Distance[15][38]=3;
-			Distance[36][38]=5;
-			}
-			if(functionType==5){
-			Distance[0][35]=6+fcc1;
-			Distance[0][25]=2+fcc2;
-			Distance[0][16]=4+fcc3;
-			Distance[35][11]=6+fcc7;
-			Distance[35][13]=7+fcc8;
-			Distance[35][9]=4+fcc9;
-			Distance[25][11]=2+fcc7;
-			Distance[25][13]=3+fcc8;
-			Distance[25][9]=3+fcc9;
-			Distance[16][11]=4+fcc7;
-			Distance[16][13]=5+fcc8;
-			Distance[16][9]=2+fcc9;
-			Distance[11][24]=2+fcc10;
-			Distance[11][10]=2+fcc11;
-			Distance[11][20]=1+fcc12;
-			Distance[13][24]=3+fcc10;
-			Distance[13][10]=3+fcc11;
-			Distance[13][20]=2+fcc12;
-			Distance[9][24]=1+fcc10;
-			Distance[9][10]=1+fcc11;
-			Distance[9][20]=2+fcc12;
-			Distance[24][38]=4;
-			Distance[10][38]=5;
-			Distance[20][38]=5;
-			}
-			if(functionType==6){
-			Distance[0][35]=6+fcc1;
-			Distance[0][25]=2+fcc2;
-			Distance[0][16]=4+fcc3;
-			Distance[35][11]=6+fcc7;
-			Distance[35][13]=7+fcc8;
-			Distance[35][9]=4+fcc9;
-			Distance[25][11]=2+fcc7;
-			Distance[25][13]=3+fcc8;
-			Distance[25][9]=3+fcc9;
-			Distance[16][11]=4+fcc7;
-			Distance[16][13]=5+fcc8;
-			Distance[16][9]=2+fcc9;
-			Distance[11][4]=4+fcc13;
-			Distance[11][15]=4+fcc14;
-			Distance[11][36]=5+fcc15;
-			Distance[13][4]=5+fcc13;
-			Distance[13][15]=5+fcc14;
-			Distance[13][36]=6+fcc15;
-			Distance[9][4]=2+fcc13;
-			Distance[9][15]=2+fcc14;
-			Distance[9][36]=3+fcc15;
-			Distance[4][38]=5;
-			Distance[15][38]=3;
-			Distance[36][38]=5;
-			}
-			if(functionType==7){
-			Distance[0][11]=0+fcc7;
-			Distance[0][13]=1+fcc8;
-			Distance[0][9]=3+fcc9;
-			Distance[11][35]=6+fcc1;
-			Distance[11][25]=2+fcc2;
-			Distance[11][16]=4+fcc3;
-			Distance[13][35]=7+fcc1;
-			Distance[13][25]=3+fcc2;
-			Distance[13][16]=5+fcc3;
-			Distance[9][35]=4+fcc1;
-			Distance[9][25]=3+fcc2;
-			Distance[9][16]=2+fcc3;
-			Distance[35][24]=5+fcc10;
-			Distance[35][10]=5+fcc11;
-			Distance[35][20]=6+fcc12;
-			Distance[25][24]=2+fcc10;
-			Distance[25][10]=3+fcc11;
-			Distance[25][20]=1+fcc12;
-			Distance[16][24]=3+fcc10;
-			Distance[16][10]=3+fcc11;
-			Distance[16][20]=4+fcc12;
-			Distance[24][38]=4;
-			Distance[10][38]=5;
-			Distance[20][38]=5;
-			}
-			if(functionType==8){
-			Distance[0][11]=0+fcc7;
-			Distance[0][13]=1+fcc8;
-			Distance[0][9]=3+fcc9;
-			Distance[11][35]=6+fcc1;
-			Distance[11][25]=2+fcc2;
-			Distance[11][16]=4+fcc3;
-			Distance[13][35]=7+fcc1;
-			Distance[13][25]=3+fcc2;
-			Distance[13][16]=5+fcc3;
-			Distance[9][35]=4+fcc1;
-			Distance[9][25]=3+fcc2;
-			Distance[9][16]=2+fcc3;
-			Distance[35][4]=4+fcc13;
-			Distance[35][15]=4+fcc14;
-			Distance[35][36]=3+fcc15;
-			Distance[25][4]=4+fcc13;
-			Distance[25][15]=4+fcc14;
-			Distance[25][36]=5+fcc15;
-			Distance[16][4]=2+fcc13;
-			Distance[16][15]=2+fcc14;
-			Distance[16][36]=3+fcc15;
-			Distance[4][38]=5;
-			Distance[15][38]=3;
-			Distance[36][38]=5;
-			}
-			if(functionType==9){
-			Distance[0][7]=4+fcc4;
-			Distance[0][21]=2+fcc5;
-			Distance[0][31]=5+fcc6;
-			Distance[7][11]=4+fcc7;
-			Distance[7][13]=5+fcc8;
-			Distance[7][9]=2+fcc9;
-			Distance[21][11]=2+fcc7;
-			Distance[21][13]=3+fcc8;
-			Distance[21][9]=3+fcc9;
-			Distance[31][11]=5+fcc7;
-			Distance[31][13]=6+fcc8;
-			Distance[31][9]=3+fcc9;
-			Distance[11][24]=2+fcc10;
-			Distance[11][10]=2+fcc11;
-			Distance[11][20]=1+fcc12;
-			Distance[13][24]=3+fcc10;
-			Distance[13][10]=3+fcc11;
-			Distance[13][20]=2+fcc12;
-			Distance[9][24]=1+fcc10;
-			Distance[9][10]=1+fcc11;
-			Distance[9][20]=2+fcc12;
-			Distance[24][38]=4;
-			Distance[10][38]=5;
-			Distance[20][38]=5;
-			}
-			if(functionType==10){
-			Distance[0][7]=4+fcc4;
-			Distance[0][21]=2+fcc5;
-			Distance[0][31]=5+fcc6;
-			Distance[7][11]=4+fcc7;
-			Distance[7][13]=5+fcc8;
-			Distance[7][9]=2+fcc9;
-			Distance[21][11]=2+fcc7;
-			Distance[21][13]=3+fcc8;
-			Distance[21][9]=3+fcc9;
-			Distance[31][11]=5+fcc7;
-			Distance[31][13]=6+fcc8;
-			Distance[31][9]=3+fcc9;
-			Distance[11][4]=4+fcc13;
-			Distance[11][15]=4+fcc14;
-			Distance[11][36]=5+fcc15;
-			Distance[13][4]=5+fcc13;
-			Distance[13][15]=5+fcc14;
-			Distance[13][36]=6+fcc15;
-			Distance[9][4]=2+fcc13;
-			Distance[9][15]=2+fcc14;
-			Distance[9][36]=3+fcc15;
-			Distance[4][38]=5;
-			Distance[15][38]=3;
-			Distance[36][38]=5;
-			}
-			if(functionType==11){
-			Distance[0][11]=0+fcc7;
-			Distance[0][13]=1+fcc8;
-			Distance[0][9]=3+fcc9;
-			Distance[11][7]=4+fcc4;
-			Distance[11][21]=2+fcc5;
-			Distance[11][31]=5+fcc6;
-			Distance[13][7]=5+fcc4;
-			Distance[13][21]=3+fcc5;
-			Distance[13][31]=6+fcc6;
-			Distance[9][7]=2+fcc4;
-			Distance[9][21]=3+fcc5;
-			Distance[9][31]=3+fcc6;
-			Distance[7][24]=2+fcc10;
-			Distance[7][10]=3+fcc11;
-			Distance[7][20]=3+fcc12;
-			Distance[21][24]=2+fcc10;
-			Distance[21][10]=2+fcc11;
-			Distance[21][20]=1+fcc12;
-			Distance[31][24]=3+fcc10;
-			Distance[31][10]=4+fcc11;
-			Distance[31][20]=4+fcc12;
-			Distance[24][38]=4;
-			Distance[10][38]=5;
-			Distance[20][38]=5;
-			}
-			if(functionType==12){
-			Distance[0][11]=0+fcc7;
-			Distance[0][13]=1+fcc8;
-			Distance[0][9]=3+fcc9;
-			Distance[11][7]=4+fcc4;
-			Distance[11][21]=2+fcc5;
-			Distance[11][31]=5+fcc6;
-			Distance[13][7]=5+fcc4;
-			Distance[13][21]=3+fcc5;
-			Distance[13][31]=6+fcc6;
-			Distance[9][7]=2+fcc4;
-			Distance[9][21]=3+fcc5;
-			Distance[9][31]=3+fcc6;
-			Distance[7][4]=2+fcc13;
-			Distance[7][15]=2+fcc14;
-			Distance[7][36]=3+fcc15;
-			Distance[21][4]=2+fcc13;
-			Distance[21][15]=3+fcc14;
-			Distance[21][36]=4+fcc15;
-			Distance[31][4]=4+fcc13;
-			Distance[31][15]=2+fcc14;
-			Distance[31][36]=4+fcc15;
-			Distance[4][38]=5;
-			Distance[15][38]=3;
-			Distance[36][38]=5;
-			}
-			}
-			if (consumerNode == 56){
-			if(functionType==1){
-			Distance[0][35]=2+fcc1;
-			Distance[0][25]=5+fcc2;
-			Distance[0][16]=3+fcc3;
-			Distance[35][7]=4+fcc4;
-			Distance[35][21]=5+fcc5;
-			Distance[35][31]=5+fcc6;
-			Distance[25][7]=4+fcc4;
-			Distance[25][21]=2+fcc5;
-			Distance[25][31]=5+fcc6;
-			Distance[16][7]=2+fcc4;
-			Distance[16][21]=3+fcc5;
-			Distance[16][31]=4+fcc6;
-			Distance[7][24]=2+fcc10;
-			Distance[7][10]=3+fcc11;
-			Distance[7][20]=3+fcc12;
-			Distance[21][24]=2+fcc10;
-			Distance[21][10]=2+fcc11;
-			Distance[21][20]=1+fcc12;
-			Distance[31][24]=3+fcc10;
-			Distance[31][10]=4+fcc11;
-			Distance[31][20]=4+fcc12;
-			Distance[24][38]=4;
-			Distance[10][38]=5;
-			Distance[20][38]=5;
-			}
-			if(functionType==2){
-			Distance[0][35]=2+fcc1;
-			Distance[0][25]=5+fcc2;
-			Distance[0][16]=3+fcc3;
-			Distance[35][7]=4+fcc4;
-			Distance[35][21]=5+fcc5;
-			Distance[35][31]=5+fcc6;
-			Distance[25][7]=4+fcc4;
-			Distance[25][21]=2+fcc5;
-			Distance[25][31]=5+fcc6;
-			Distance[16][7]=2+fcc4;
-			Distance[16][21]=3+fcc5;
-			Distance[16][31]=4+fcc6;
-			Distance[7][4]=2+fcc13;
-			Distance[7][15]=2+fcc14;
-			Distance[7][36]=3+fcc15;
-			Distance[21][4]=2+fcc13;
-			Distance[21][15]=3+fcc14;
-			Distance[21][36]=4+fcc15;
-			Distance[31][4]=4+fcc13;
-			Distance[31][15]=2+fcc14;
-			Distance[31][36]=4+fcc15;
-			Distance[4][38]=5;
-			Distance[15][38]=3;
-			Distance[36][38]=5;
-			}
-			if(functionType==3){
-			Distance[0][7]=3+fcc4;
-			Distance[0][21]=4+fcc5;
-			Distance[0][31]=4+fcc6;
-			Distance[7][35]=4+fcc1;
-			Distance[7][25]=4+fcc2;
-			Distance[7][16]=2+fcc3;
-			Distance[21][35]=5+fcc1;
-			Distance[21][25]=2+fcc2;
-			Distance[21][16]=3+fcc3;
-			Distance[31][35]=5+fcc1;
-			Distance[31][25]=5+fcc2;
-			Distance[31][16]=4+fcc3;
-			Distance[35][24]=5+fcc10;
-			Distance[35][10]=5+fcc11;
-			Distance[35][20]=6+fcc12;
-			Distance[25][24]=2+fcc10;
-			Distance[25][10]=3+fcc11;
-			Distance[25][20]=1+fcc12;
-			Distance[16][24]=3+fcc10;
-			Distance[16][10]=3+fcc11;
-			Distance[16][20]=4+fcc12;
-			Distance[24][38]=4;
-			Distance[10][38]=5;
-			Distance[20][38]=5;
-			}
-			if(functionType==4){
-			Distance[0][7]=3+fcc4;
-			Distance[0][21]=4+fcc5;
-			Distance[0][31]=4+fcc6;
-			Distance[7][35]=4+fcc1;
-			Distance[7][25]=4+fcc2;
-			Distance[7][16]=2+fcc3;
-			Distance[21][35]=5+fcc1;
-			Distance[21][25]=2+fcc2;
-			Distance[21][16]=3+fcc3;
-			Distance[31][35]=5+fcc1;
-			Distance[31][25]=5+fcc2;
-			Distance[31][16]=4+fcc3;
-			Distance[35][4]=4+fcc13;
-			Distance[35][15]=4+fcc14;
-			Distance[35][36]=3+fcc15;
-			Distance[25][4]=4+fcc13;
-			Distance[25][15]=4+fcc14;
-			Distance[25][36]=5+fcc15;
-			Distance[16][4]=2+fcc13;
-			Distance[16][15]=2+fcc14;
-			Distance[16][36]=3+fcc15;
-			Distance[4][38]=5;
-			Distance[15][38]=3;
-			Distance[36][38]=5;
-			}
-			if(functionType==5){
-			Distance[0][35]=2+fcc1;
-			Distance[0][25]=5+fcc2;
-			Distance[0][16]=3+fcc3;
-			Distance[35][11]=6+fcc7;
-			Distance[35][13]=7+fcc8;
-			Distance[35][9]=4+fcc9;
-			Distance[25][11]=2+fcc7;
-			Distance[25][13]=3+fcc8;
-			Distance[25][9]=3+fcc9;
-			Distance[16][11]=4+fcc7;
-			Distance[16][13]=5+fcc8;
-			Distance[16][9]=2+fcc9;
-			Distance[11][24]=2+fcc10;
-			Distance[11][10]=2+fcc11;
-			Distance[11][20]=1+fcc12;
-			Distance[13][24]=3+fcc10;
-			Distance[13][10]=3+fcc11;
-			Distance[13][20]=2+fcc12;
-			Distance[9][24]=1+fcc10;
-			Distance[9][10]=1+fcc11;
-			Distance[9][20]=2+fcc12;
-			Distance[24][38]=4;
-			Distance[10][38]=5;
-			Distance[20][38]=5;
-			}
-			if(functionType==6){
-			Distance[0][35]=2+fcc1;
-			Distance[0][25]=5+fcc2;
-			Distance[0][16]=3+fcc3;
-			Distance[35][11]=6+fcc7;
-			Distance[35][13]=7+fcc8;
-			Distance[35][9]=4+fcc9;
-			Distance[25][11]=2+fcc7;
-			Distance[25][13]=3+fcc8;
-			Distance[25][9]=3+fcc9;
-			Distance[16][11]=4+fcc7;
-			Distance[16][13]=5+fcc8;
-			Distance[16][9]=2+fcc9;
-			Distance[11][4]=4+fcc13;
-			Distance[11][15]=4+fcc14;
-			Distance[11][36]=5+fcc15;
-			Distance[13][4]=5+fcc13;
-			Distance[13][15]=5+fcc14;
-			Distance[13][36]=6+fcc15;
-			Distance[9][4]=2+fcc13;
-			Distance[9][15]=2+fcc14;
-			Distance[9][36]=3+fcc15;
-			Distance[4][38]=5;
-			Distance[15][38]=3;
-			Distance[36][38]=5;
-			}
-			if(functionType==7){
-			Distance[0][11]=5+fcc7;
-			Distance[0][13]=6+fcc8;
-			Distance[0][9]=3+fcc9;
-			Distance[11][35]=6+fcc1;
-			Distance[11][25]=2+fcc2;
-			Distance[11][16]=4+fcc3;
-			Distance[13][35]=7+fcc1;
-			Distance[13][25]=3+fcc2;
-			Distance[13][16]=5+fcc3;
-			Distance[9][35]=4+fcc1;
-			Distance[9][25]=3+fcc2;
-			Distance[9][16]=2+fcc3;
-			Distance[35][24]=5+fcc10;
-			Distance[35][10]=5+fcc11;
-			Distance[35][20]=6+fcc12;
-			Distance[25][24]=2+fcc10;
-			Distance[25][10]=3+fcc11;
-			Distance[25][20]=1+fcc12;
-			Distance[16][24]=3+fcc10;
-			Distance[16][10]=3+fcc11;
-			Distance[16][20]=4+fcc12;
-			Distance[24][38]=4;
-			Distance[10][38]=5;
-			Distance[20][38]=5;
-			}
-			if(functionType==8){
-			Distance[0][11]=5+fcc7;
-			Distance[0][13]=6+fcc8;
-			Distance[0][9]=3+fcc9;
-			Distance[11][35]=6+fcc1;
-			Distance[11][25]=2+fcc2;
-			Distance[11][16]=4+fcc3;
-			Distance[13][35]=7+fcc1;
-			Distance[13][25]=3+fcc2;
-			Distance[13][16]=5+fcc3;
-			Distance[9][35]=4+fcc1;
-			Distance[9][25]=3+fcc2;
-			Distance[9][16]=2+fcc3;
-			Distance[35][4]=4+fcc13;
-			Distance[35][15]=4+fcc14;
-			Distance[35][36]=3+fcc15;
-			Distance[25][4]=4+fcc13;
-			Distance[25][15]=4+fcc14;
-			Distance[25][36]=5+fcc15;
-			Distance[16][4]=2+fcc13;
-			Distance[16][15]=2+fcc14;
-			Distance[16][36]=3+fcc15;
-			Distance[4][38]=5;
-			Distance[15][38]=3;
-			Distance[36][38]=5;
-			}
-			if(functionType==9){
-			Distance[0][7]=3+fcc4;
-			Distance[0][21]=4+fcc5;
-			Distance[0][31]=4+fcc6;
-			Distance[7][11]=4+fcc7;
-			Distance[7][13]=5+fcc8;
-			Distance[7][9]=2+fcc9;
-			Distance[21][11]=2+fcc7;
-			Distance[21][13]=3+fcc8;
-			Distance[21][9]=3+fcc9;
-			Distance[31][11]=5+fcc7;
-			Distance[31][13]=6+fcc8;
-			Distance[31][9]=3+fcc9;
-			Distance[11][24]=2+fcc10;
-			Distance[11][10]=2+fcc11;
-			Distance[11][20]=1+fcc12;
-			Distance[13][24]=3+fcc10;
-			Distance[13][10]=3+fcc11;
-			Distance[13][20]=2+fcc12;
-			Distance[9][24]=1+fcc10;
-			Distance[9][10]=1+fcc11;
-			Distance[9][20]=2+fcc12;
-			Distance[24][38]=4;
-			Distance[10][38]=5;
-			Distance[20][38]=5;
-			}
-			if(functionType==10){
-			Distance[0][7]=3+fcc4;
-			Distance[0][21]=4+fcc5;
-			Distance[0][31]=4+fcc6;
-			Distance[7][11]=4+fcc7;
-			Distance[7][13]=5+fcc8;
-			Distance[7][9]=2+fcc9;
-			Distance[21][11]=2+fcc7;
-			Distance[21][13]=3+fcc8;
-			Distance[21][9]=3+fcc9;
-			Distance[31][11]=5+fcc7;
-			Distance[31][13]=6+fcc8;
-			Distance[31][9]=3+fcc9;
-			Distance[11][4]=4+fcc13;
-			Distance[11][15]=4+fcc14;
-			Distance[11][36]=5+fcc15;
-			Distance[13][4]=5+fcc13;
-			Distance[13][15]=5+fcc14;
-			Distance[13][36]=6+fcc15;
-			Distance[9][4]=2+fcc13;
-			Distance[9][15]=2+fcc14;
-			Distance[9][36]=3+fcc15;
-			Distance[4][38]=5;
-			Distance[15][38]=3;
-			Distance[36][38]=5;
-			}
-			if(functionType==11){
-			Distance[0][11]=5+fcc7;
-			Distance[0][13]=6+fcc8;
-			Distance[0][9]=3+fcc9;
-			Distance[11][7]=4+fcc4;
-			Distance[11][21]=2+fcc5;
-			Distance[11][31]=5+fcc6;
-			Distance[13][7]=5+fcc4;
-			Distance[13][21]=3+fcc5;
-			Distance[13][31]=6+fcc6;
-			Distance[9][7]=2+fcc4;
-			Distance[9][21]=3+fcc5;
-			Distance[9][31]=3+fcc6;
-			Distance[7][24]=2+fcc10;
-			Distance[7][10]=3+fcc11;
-			Distance[7][20]=3+fcc12;
-			Distance[21][24]=2+fcc10;
-			Distance[21][10]=2+fcc11;
-			Distance[21][20]=1+fcc12;
-			Distance[31][24]=3+fcc10;
-			Distance[31][10]=4+fcc11;
-			Distance[31][20]=4+fcc12;
-			Distance[24][38]=4;
-			Distance[10][38]=5;
-			Distance[20][38]=5;
-			}
-			if(functionType==12){
-			Distance[0][11]=5+fcc7;
-			Distance[0][13]=6+fcc8;
-			Distance[0][9]=3+fcc9;
-			Distance[11][7]=4+fcc4;
-			Distance[11][21]=2+fcc5;
-			Distance[11][31]=5+fcc6;
-			Distance[13][7]=5+fcc4;
-			Distance[13][21]=3+fcc5;
-			Distance[13][31]=6+fcc6;
-			Distance[9][7]=2+fcc4;
-			Distance[9][21]=3+fcc5;
-			Distance[9][31]=3+fcc6;
-			Distance[7][4]=2+fcc13;
-			Distance[7][15]=2+fcc14;
-			Distance[7][36]=3+fcc15;
-			Distance[21][4]=2+fcc13;
-			Distance[21][15]=3+fcc14;
-			Distance[21][36]=4+fcc15;
-			Distance[31][4]=4+fcc13;
-			Distance[31][15]=2+fcc14;
-			Distance[31][36]=4+fcc15;
-			Distance[4][38]=5;
-			Distance[15][38]=3;
-			Distance[36][38]=5;
-			}
-		}
-//*/   //Geant
-	}
-
-
-	
-	if(flag == 1){
-		//for us1
-		/*
-		//F1->F2->F4
-		if (functionType == 1) {
-			Distance[0][3] = 1 + fcc1t;
-			Distance[0][10] = 1 + fcc2t;
-			Distance[0][21] = 1 + fcc3t;
-			Distance[3][7] = 1 + fcc4t;
-			Distance[3][13] = 1 + fcc5t;
-			Distance[3][23] = 1 + fcc6t;
-			Distance[10][7] = 1 + fcc4t;
-			Distance[10][13] = 1 + fcc5t;
-			Distance[10][23] = 1 + fcc6t;
-			Distance[21][7] = 1 + fcc4t;
-			Distance[21][13] = 1 + fcc5t;
-			Distance[21][23] = 1 + fcc6t;
-			Distance[7][6] = 1 + fcc10t;
-			Distance[7][9] = 1 + fcc11t;
-			Distance[7][15] = 1 + fcc12t;
-			Distance[13][6] = 1 + fcc10t;
-			Distance[13][9] = 1 + fcc11t;
-			Distance[13][15] = 1 + fcc12t;
-			Distance[23][6] = 1 + fcc10t;
-			Distance[23][9] = 1 + fcc11t;
-			Distance[23][15] = 1 + fcc12t;
-			Distance[6][25] = 1;
-			Distance[9][25] = 1;
-			Distance[15][25] = 1;
-		}
-
-		//F1->F2->F5
-		if (functionType == 2) {
-			Distance[0][3] = 1 + fcc1t;
-			Distance[0][10] = 1 + fcc2t;
-			Distance[0][21] = 1 + fcc3t;
-			Distance[3][7] = 1 + fcc4t;
-			Distance[3][13] = 1 + fcc5t;
-			Distance[3][23] = 1 + fcc6t;
-			Distance[10][7] = 1 + fcc4t;
-			Distance[10][13] = 1 + fcc5t;
-			Distance[10][23] = 1 + fcc6t;
-			Distance[21][7] = 1 + fcc4t;
-			Distance[21][13] = 1 + fcc5t;
-			Distance[21][23] = 1 + fcc6t;
-			Distance[7][2] = 1 + fcc13t;
-			Distance[7][11] = 1 + fcc14t;
-			Distance[7][20] = 1 + fcc15t;
-			Distance[13][2] = 1 + fcc13t;
-			Distance[13][11] = 1 + fcc14t;
-			Distance[13][20] = 1 + fcc15t;
-			Distance[23][2] = 1 + fcc13t;
-			Distance[23][11] = 1 + fcc14t;
-			Distance[23][20] = 1 + fcc15t;
-			Distance[2][25] = 1;
-			Distance[11][25] = 1;
-			Distance[20][25] = 1;
-		}
-
-		//F2->F1->F4
-		if (functionType == 3) {
-			Distance[0][7] = 1 + fcc4t;
-			Distance[0][13] = 1 + fcc5t;
-			Distance[0][23] = 1 + fcc6t;
-			Distance[7][3] = 1 + fcc1t;
-			Distance[7][10] = 1 + fcc2t;
-			Distance[7][21] = 1 + fcc3t;
-			Distance[13][3] = 1 + fcc1t;
-			Distance[13][10] = 1 + fcc2t;
-			Distance[13][21] = 1 + fcc3t;
-			Distance[23][3] = 1 + fcc1t;
-			Distance[23][10] = 1 + fcc2t;
-			Distance[23][21] = 1 + fcc3t;
-			Distance[3][6] = 1 + fcc10t;
-			Distance[3][9] = 1 + fcc11t;
-			Distance[3][15] = 1 + fcc12t;
-			Distance[10][6] = 1 + fcc10t;
-			Distance[10][9] = 1 + fcc11t;
-			Distance[10][15] = 1 + fcc12t;
-			Distance[21][6] = 1 + fcc10t;
-			Distance[21][9] = 1 + fcc11t;
-			Distance[21][15] = 1 + fcc12t;
-			Distance[6][25] = 1;
-			Distance[9][25] = 1;
-			Distance[15][25] = 1;
-		}
-
-		//F2->F1->F5
-		if (functionType == 4) {
-			Distance[0][7] = 1 + fcc4t;
-			Distance[0][13] = 1 + fcc5t;
-			Distance[0][23] = 1 + fcc6t;
-			Distance[7][3] = 1 + fcc1t;
-			Distance[7][10] = 1 + fcc2t;
-			Distance[7][21] = 1 + fcc3t;
-			Distance[13][3] = 1 + fcc1t;
-			Distance[13][10] = 1 + fcc2t;
-			Distance[13][21] = 1 + fcc3t;
-			Distance[23][3] = 1 + fcc1t;
-			Distance[23][10] = 1 + fcc2t;
-			Distance[23][21] = 1 + fcc3t;
-			Distance[3][2] = 1 + fcc13t;
-			Distance[3][11] = 1 + fcc14t;
-			Distance[3][20] = 1 + fcc15t;
-			Distance[10][2] = 1 + fcc13t;
-			Distance[10][11] = 1 + fcc14t;
-			Distance[10][20] = 1 + fcc15t;
-			Distance[21][2] = 1 + fcc13t;
-			Distance[21][11] = 1 + fcc14t;
-			Distance[21][20] = 1 + fcc15t;
-			Distance[2][25] = 1;
-			Distance[11][25] = 1;
-			Distance[20][25] = 1;
-		}
-
-		//F1->F3->F4
-		if (functionType == 5) {
-			Distance[0][3] = 1 + fcc1t;
-			Distance[0][10] = 1 + fcc2t;
-			Distance[0][21] = 1 + fcc3t;
-			Distance[3][4] = 1 + fcc7t;
-			Distance[3][12] = 1 + fcc8t;
-			Distance[3][17] = 1 + fcc9t;
-			Distance[10][4] = 1 + fcc7t;
-			Distance[10][12] = 1 + fcc8t;
-			Distance[10][17] = 1 + fcc9t;
-			Distance[21][4] = 1 + fcc7t;
-			Distance[21][12] = 1 + fcc8t;
-			Distance[21][17] = 1 + fcc9t;
-			Distance[4][6] = 1 + fcc10t;
-			Distance[4][9] = 1 + fcc11t;
-			Distance[4][15] = 1 + fcc12t;
-			Distance[12][6] = 1 + fcc10t;
-			Distance[12][9] = 1 + fcc11t;
-			Distance[12][15] = 1 + fcc12t;
-			Distance[17][6] = 1 + fcc10t;
-			Distance[17][9] = 1 + fcc11t;
-			Distance[17][15] = 1 + fcc12t;
-			Distance[6][25] = 1;
-			Distance[9][25] = 1;
-			Distance[15][25] = 1;
-		}
-
-		//F1->F3->F5
-		if (functionType == 6) {
-			Distance[0][3] = 1 + fcc1t;
-			Distance[0][10] = 1 + fcc2t;
-			Distance[0][21] = 1 + fcc3t;
-			Distance[3][4] = 1 + fcc7t;
-			Distance[3][12] = 1 + fcc8t;
-			Distance[3][17] = 1 + fcc9t;
-			Distance[10][4] = 1 + fcc7t;
-			Distance[10][12] = 1 + fcc8t;
-			Distance[10][17] = 1 + fcc9t;
-			Distance[21][4] = 1 + fcc7t;
-			Distance[21][12] = 1 + fcc8t;
-			Distance[21][17] = 1 + fcc9t;
-			Distance[4][2] = 1 + fcc13t;
-			Distance[4][11] = 1 + fcc14t;
-			Distance[4][20] = 1 + fcc15t;
-			Distance[12][2] = 1 + fcc13t;
-			Distance[12][11] = 1 + fcc14t;
-			Distance[12][20] = 1 + fcc15t;
-			Distance[17][2] = 1 + fcc13t;
-			Distance[17][11] = 1 + fcc14t;
-			Distance[17][20] = 1 + fcc15t;
-			Distance[2][25] = 1;
-			Distance[11][25] = 1;
-			Distance[20][25] = 1;
-		}
-
-		//F3->F1->F4
-		if (functionType == 7) {
-			Distance[0][4] = 1 + fcc7t;
-			Distance[0][12] = 1 + fcc8t;
-			Distance[0][17] = 1 + fcc9t;
-			Distance[4][3] = 1 + fcc1t;
-			Distance[4][10] = 1 + fcc2t;
-			Distance[4][21] = 1 + fcc3t;
-			Distance[12][3] = 1 + fcc1t;
-			Distance[12][10] = 1 + fcc2t;
-			Distance[12][21] = 1 + fcc3t;
-			Distance[17][3] = 1 + fcc1t;
-			Distance[17][10] = 1 + fcc2t;
-			Distance[17][21] = 1 + fcc3t;
-			Distance[3][6] = 1 + fcc10t;
-			Distance[3][9] = 1 + fcc11t;
-			Distance[3][15] = 1 + fcc12t;
-			Distance[10][6] = 1 + fcc10t;
-			Distance[10][9] = 1 + fcc11t;
-			Distance[10][15] = 1 + fcc12t;
-			Distance[21][6] = 1 + fcc10t;
-			Distance[21][9] = 1 + fcc11t;
-			Distance[21][15] = 1 + fcc12t;
-			Distance[6][25] = 1;
-			Distance[9][25] = 1;
-			Distance[15][25] = 1;
-		}
-
-		//F3->F1->F5
-		if (functionType == 8) {
-			Distance[0][4] = 1 + fcc7t;
-			Distance[0][12] = 1 + fcc8t;
-			Distance[0][17] = 1 + fcc9t;
-			Distance[4][3] = 1 + fcc1t;
-			Distance[4][10] = 1 + fcc2t;
-			Distance[4][21] = 1 + fcc3t;
-			Distance[12][3] = 1 + fcc1t;
-			Distance[12][10] = 1 + fcc2t;
-			Distance[12][21] = 1 + fcc3t;
-			Distance[17][3] = 1 + fcc1t;
-			Distance[17][10] = 1 + fcc2t;
-			Distance[17][21] = 1 + fcc3t;
-			Distance[3][2] = 1 + fcc13t;
-			Distance[3][11] = 1 + fcc14t;
-			Distance[3][20] = 1 + fcc15t;
-			Distance[10][2] = 1 + fcc13t;
-			Distance[10][11] = 1 + fcc14t;
-			Distance[10][20] = 1 + fcc15t;
-			Distance[21][2] = 1 + fcc13t;
-			Distance[21][11] = 1 + fcc14t;
-			Distance[21][20] = 1 + fcc15t;
-			Distance[2][25] = 1;
-			Distance[11][25] = 1;
-			Distance[20][25] = 1;
-		}
-
-		//F2->F3->F4
-		if (functionType == 9) {
-			Distance[0][7] = 1 + fcc4t;
-			Distance[0][13] = 1 + fcc5t;
-			Distance[0][23] = 1 + fcc6t;
-			Distance[7][4] = 1 + fcc7t;
-			Distance[7][12] = 1 + fcc8t;
-			Distance[7][17] = 1 + fcc9t;
-			Distance[13][4] = 1 + fcc7t;
-			Distance[13][12] = 1 + fcc8t;
-			Distance[13][17] = 1 + fcc9t;
-			Distance[23][4] = 1 + fcc7t;
-			Distance[23][12] = 1 + fcc8t;
-			Distance[23][17] = 1 + fcc9t;
-			Distance[4][6] = 1 + fcc10t;
-			Distance[4][9] = 1 + fcc11t;
-			Distance[4][15] = 1 + fcc12t;
-			Distance[12][6] = 1 + fcc10t;
-			Distance[12][9] = 1 + fcc11t;
-			Distance[12][15] = 1 + fcc12t;
-			Distance[17][6] = 1 + fcc10t;
-			Distance[17][9] = 1 + fcc11t;
-			Distance[17][15] = 1 + fcc12t;
-			Distance[6][25] = 1;
-			Distance[9][25] = 1;
-			Distance[15][25] = 1;
-		}
-
-		//F2->F3->F5
-		if (functionType == 10) {
-			Distance[0][7] = 1 + fcc4t;
-			Distance[0][13] = 1 + fcc5t;
-			Distance[0][23] = 1 + fcc6t;
-			Distance[7][4] = 1 + fcc7t;
-			Distance[7][12] = 1 + fcc8t;
-			Distance[7][17] = 1 + fcc9t;
-			Distance[13][4] = 1 + fcc7t;
-			Distance[13][12] = 1 + fcc8t;
-			Distance[13][17] = 1 + fcc9t;
-			Distance[23][4] = 1 + fcc7t;
-			Distance[23][12] = 1 + fcc8t;
-			Distance[23][17] = 1 + fcc9t;
-			Distance[4][2] = 1 + fcc13t;
-			Distance[4][11] = 1 + fcc14t;
-			Distance[4][20] = 1 + fcc15t;
-			Distance[12][2] = 1 + fcc13t;
-			Distance[12][11] = 1 + fcc14t;
-			Distance[12][20] = 1 + fcc15t;
-			Distance[17][2] = 1 + fcc13t;
-			Distance[17][11] = 1 + fcc14t;
-			Distance[17][20] = 1 + fcc15t;
-			Distance[2][25] = 1;
-			Distance[11][25] = 1;
-			Distance[20][25] = 1;
-		}
-
-		//F3->F2->F4
-		if (functionType == 11) {
-			Distance[0][4] = 1 + fcc4t;
-			Distance[0][12] = 1 + fcc5t;
-			Distance[0][17] = 1 + fcc6t;
-			Distance[4][7] = 1 + fcc7t;
-			Distance[4][13] = 1 + fcc8t;
-			Distance[4][23] = 1 + fcc9t;
-			Distance[12][7] = 1 + fcc7t;
-			Distance[12][13] = 1 + fcc8t;
-			Distance[12][23] = 1 + fcc9t;
-			Distance[17][7] = 1 + fcc7t;
-			Distance[17][13] = 1 + fcc8t;
-			Distance[17][23] = 1 + fcc9t;
-			Distance[7][6] = 1 + fcc10t;
-			Distance[7][9] = 1 + fcc11t;
-			Distance[7][15] = 1 + fcc12t;
-			Distance[13][6] = 1 + fcc10t;
-			Distance[13][9] = 1 + fcc11t;
-			Distance[13][15] = 1 + fcc12t;
-			Distance[23][6] = 1 + fcc10t;
-			Distance[23][9] = 1 + fcc11t;
-			Distance[23][15] = 1 + fcc12t;
-			Distance[6][25] = 1;
-			Distance[9][25] = 1;
-			Distance[15][25] = 1;
-		}
-
-		//F3->F2->F5
-		if (functionType == 12) {
-			Distance[0][4] = 1 + fcc4t;
-			Distance[0][12] = 1 + fcc5t;
-			Distance[0][17] = 1 + fcc6t;
-			Distance[4][7] = 1 + fcc7t;
-			Distance[4][13] = 1 + fcc8t;
-			Distance[4][23] = 1 + fcc9t;
-			Distance[12][7] = 1 + fcc7t;
-			Distance[12][13] = 1 + fcc8t;
-			Distance[12][23] = 1 + fcc9t;
-			Distance[17][7] = 1 + fcc7t;
-			Distance[17][13] = 1 + fcc8t;
-			Distance[17][23] = 1 + fcc9t;
-			Distance[7][2] = 1 + fcc13t;
-			Distance[7][11] = 1 + fcc14t;
-			Distance[7][20] = 1 + fcc15t;
-			Distance[13][2] = 1 + fcc13t;
-			Distance[13][11] = 1 + fcc14t;
-			Distance[13][20] = 1 + fcc15t;
-			Distance[23][2] = 1 + fcc13t;
-			Distance[23][11] = 1 + fcc14t;
-			Distance[23][20] = 1 + fcc15t;
-			Distance[2][25] = 1;
-			Distance[11][25] = 1;
-			Distance[20][25] = 1;
-		}
-		*/  //us-1
-
-		//Sinet
-		/*
-		if(functionType==1){
-			Distance[0][35]=1+fcc1t;
-			Distance[0][25]=1+fcc2t;
-			Distance[0][16]=1+fcc3t;
-			Distance[35][7]=1+fcc4t;
-			Distance[35][21]=1+fcc5t;
-			Distance[35][31]=1+fcc6t;
-			Distance[25][7]=1+fcc4t;
-			Distance[25][21]=1+fcc5t;
-			Distance[25][31]=1+fcc6t;
-			Distance[16][7]=1+fcc4t;
-			Distance[16][21]=1+fcc5t;
-			Distance[16][31]=1+fcc6t;
-			Distance[7][24]=1+fcc10t;
-			Distance[7][10]=1+fcc11t;
-			Distance[7][20]=1+fcc12t;
-			Distance[21][24]=1+fcc10t;
-			Distance[21][10]=1+fcc11t;
-			Distance[21][20]=1+fcc12t;
-			Distance[31][24]=1+fcc10t;
-			Distance[31][10]=1+fcc11t;
-			Distance[31][20]=1+fcc12t;
-			Distance[24][38]=1;
-			Distance[10][38]=1;
-			Distance[20][38]=1;
-			}
-			if(functionType==2){
-			Distance[0][35]=1+fcc1t;
-			Distance[0][25]=1+fcc2t;
-			Distance[0][16]=1+fcc3t;
-			Distance[35][7]=1+fcc4t;
-			Distance[35][21]=1+fcc5t;
-			Distance[35][31]=1+fcc6t;
-			Distance[25][7]=1+fcc4t;
-			Distance[25][21]=1+fcc5t;
-			Distance[25][31]=1+fcc6t;
-			Distance[16][7]=1+fcc4t;
-			Distance[16][21]=1+fcc5t;
-			Distance[16][31]=1+fcc6t;
-			Distance[7][4]=1+fcc13t;
-			Distance[7][15]=1+fcc14t;
-			Distance[7][36]=1+fcc15t;
-			Distance[21][4]=1+fcc13t;
-			Distance[21][15]=1+fcc14t;
-			Distance[21][36]=1+fcc15t;
-			Distance[31][4]=1+fcc13t;
-			Distance[31][15]=1+fcc14t;
-			Distance[31][36]=1+fcc15t;
-			Distance[4][38]=1;
-			Distance[15][38]=1;
-			Distance[36][38]=1;
-			}
-			if(functionType==3){
-			Distance[0][7]=1+fcc4t;
-			Distance[0][21]=1+fcc5t;
-			Distance[0][31]=1+fcc6t;
-			Distance[7][35]=1+fcc1t;
-			Distance[7][25]=1+fcc2t;
-			Distance[7][16]=1+fcc3t;
-			Distance[21][35]=1+fcc1t;
-			Distance[21][25]=1+fcc2t;
-			Distance[21][16]=1+fcc3t;
-			Distance[31][35]=1+fcc1t;
-			Distance[31][25]=1+fcc2t;
-			Distance[31][16]=1+fcc3t;
-			Distance[35][24]=1+fcc10t;
-			Distance[35][10]=1+fcc11t;
-			Distance[35][20]=1+fcc12t;
-			Distance[25][24]=1+fcc10t;
-			Distance[25][10]=1+fcc11t;
-			Distance[25][20]=1+fcc12t;
-			Distance[16][24]=1+fcc10t;
-			Distance[16][10]=1+fcc11t;
-			Distance[16][20]=1+fcc12t;
-			Distance[24][38]=1;
-			Distance[10][38]=1;
-			Distance[20][38]=1;
-			}
-			if(functionType==4){
-			Distance[0][7]=1+fcc4t;
-			Distance[0][21]=1+fcc5t;
-			Distance[0][31]=1+fcc6t;
-			Distance[7][35]=1+fcc1t;
-			Distance[7][25]=1+fcc2t;
-			Distance[7][16]=1+fcc3t;
-			Distance[21][35]=1+fcc1t;
-			Distance[21][25]=1+fcc2t;
-			Distance[21][16]=1+fcc3t;
-			Distance[31][35]=1+fcc1t;
-			Distance[31][25]=1+fcc2t;
-			Distance[31][16]=1+fcc3t;
-			Distance[35][4]=1+fcc13t;
-			Distance[35][15]=1+fcc14t;
-			Distance[35][36]=1+fcc15t;
-			Distance[25][4]=1+fcc13t;
-			Distance[25][15]=1+fcc14t;
-			Distance[25][36]=1+fcc15t;
-			Distance[16][4]=1+fcc13t;
-			Distance[16][15]=1+fcc14t;
-			Distance[16][36]=1+fcc15t;
-			Distance[4][38]=1;
-			Distance[15][38]=1;
-			Distance[36][38]=1;
-			}
-			if(functionType==5){
-			Distance[0][35]=1+fcc1t;
-			Distance[0][25]=1+fcc2t;
-			Distance[0][16]=1+fcc3t;
-			Distance[35][11]=1+fcc7t;
-			Distance[35][13]=1+fcc8t;
-			Distance[35][9]=1+fcc9t;
-			Distance[25][11]=1+fcc7t;
-			Distance[25][13]=1+fcc8t;
-			Distance[25][9]=1+fcc9t;
-			Distance[16][11]=1+fcc7t;
-			Distance[16][13]=1+fcc8t;
-			Distance[16][9]=1+fcc9t;
-			Distance[11][24]=1+fcc10t;
-			Distance[11][10]=1+fcc11t;
-			Distance[11][20]=1+fcc12t;
-			Distance[13][24]=1+fcc10t;
-			Distance[13][10]=1+fcc11t;
-			Distance[13][20]=1+fcc12t;
-			Distance[9][24]=1+fcc10t;
-			Distance[9][10]=1+fcc11t;
-			Distance[9][20]=1+fcc12t;
-			Distance[24][38]=1;
-			Distance[10][38]=1;
-			Distance[20][38]=1;
-			}
-			if(functionType==6){
-			Distance[0][35]=1+fcc1t;
-			Distance[0][25]=1+fcc2t;
-			Distance[0][16]=1+fcc3t;
-			Distance[35][11]=1+fcc7t;
-			Distance[35][13]=1+fcc8t;
-			Distance[35][9]=1+fcc9t;
-			Distance[25][11]=1+fcc7t;
-			Distance[25][13]=1+fcc8t;
-			Distance[25][9]=1+fcc9t;
-			Distance[16][11]=1+fcc7t;
-			Distance[16][13]=1+fcc8t;
-			Distance[16][9]=1+fcc9t;
-			Distance[11][4]=1+fcc13t;
-			Distance[11][15]=1+fcc14t;
-			Distance[11][36]=1+fcc15t;
-			Distance[13][4]=1+fcc13t;
-			Distance[13][15]=1+fcc14t;
-			Distance[13][36]=1+fcc15t;
-			Distance[9][4]=1+fcc13t;
-			Distance[9][15]=1+fcc14t;
-			Distance[9][36]=1+fcc15t;
-			Distance[4][38]=1;
-			Distance[15][38]=1;
-			Distance[36][38]=1;
-			}
-			if(functionType==7){
-			Distance[0][11]=1+fcc7t;
-			Distance[0][13]=1+fcc8t;
-			Distance[0][9]=1+fcc9t;
-			Distance[11][35]=1+fcc1t;
-			Distance[11][25]=1+fcc2t;
-			Distance[11][16]=1+fcc3t;
-			Distance[13][35]=1+fcc1t;
-			Distance[13][25]=1+fcc2t;
-			Distance[13][16]=1+fcc3t;
-			Distance[9][35]=1+fcc1t;
-			Distance[9][25]=1+fcc2t;
-			Distance[9][16]=1+fcc3t;
-			Distance[35][24]=1+fcc10t;
-			Distance[35][10]=1+fcc11t;
-			Distance[35][20]=1+fcc12t;
-			Distance[25][24]=1+fcc10t;
-			Distance[25][10]=1+fcc11t;
-			Distance[25][20]=1+fcc12t;
-			Distance[16][24]=1+fcc10t;
-			Distance[16][10]=1+fcc11t;
-			Distance[16][20]=1+fcc12t;
-			Distance[24][38]=1;
-			Distance[10][38]=1;
-			Distance[20][38]=1;
-			}
-			if(functionType==8){
-			Distance[0][11]=1+fcc7t;
-			Distance[0][13]=1+fcc8t;
-			Distance[0][9]=1+fcc9t;
-			Distance[11][35]=1+fcc1t;
-			Distance[11][25]=1+fcc2t;
-			Distance[11][16]=1+fcc3t;
-			Distance[13][35]=1+fcc1t;
-			Distance[13][25]=1+fcc2t;
-			Distance[13][16]=1+fcc3t;
-			Distance[9][35]=1+fcc1t;
-			Distance[9][25]=1+fcc2t;
-			Distance[9][16]=1+fcc3t;
-			Distance[35][4]=1+fcc13t;
-			Distance[35][15]=1+fcc14t;
-			Distance[35][36]=1+fcc15t;
-			Distance[25][4]=1+fcc13t;
-			Distance[25][15]=1+fcc14t;
-			Distance[25][36]=1+fcc15t;
-			Distance[16][4]=1+fcc13t;
-			Distance[16][15]=1+fcc14t;
-			Distance[16][36]=1+fcc15t;
-			Distance[4][38]=1;
-			Distance[15][38]=1;
-			Distance[36][38]=1;
-			}
-			if(functionType==9){
-			Distance[0][7]=1+fcc4t;
-			Distance[0][21]=1+fcc5t;
-			Distance[0][31]=1+fcc6t;
-			Distance[7][11]=1+fcc7t;
-			Distance[7][13]=1+fcc8t;
-			Distance[7][9]=1+fcc9t;
-			Distance[21][11]=1+fcc7t;
-			Distance[21][13]=1+fcc8t;
-			Distance[21][9]=1+fcc9t;
-			Distance[31][11]=1+fcc7t;
-			Distance[31][13]=1+fcc8t;
-			Distance[31][9]=1+fcc9t;
-			Distance[11][24]=1+fcc10t;
-			Distance[11][10]=1+fcc11t;
-			Distance[11][20]=1+fcc12t;
-			Distance[13][24]=1+fcc10t;
-			Distance[13][10]=1+fcc11t;
-			Distance[13][20]=1+fcc12t;
-			Distance[9][24]=1+fcc10t;
-			Distance[9][10]=1+fcc11t;
-			Distance[9][20]=1+fcc12t;
-			Distance[24][38]=1;
-			Distance[10][38]=1;
-			Distance[20][38]=1;
-			}
-			if(functionType==10){
-			Distance[0][7]=1+fcc4t;
-			Distance[0][21]=1+fcc5t;
-			Distance[0][31]=1+fcc6t;
-			Distance[7][11]=1+fcc7t;
-			Distance[7][13]=1+fcc8t;
-			Distance[7][9]=1+fcc9t;
-			Distance[21][11]=1+fcc7t;
-			Distance[21][13]=1+fcc8t;
-			Distance[21][9]=1+fcc9t;
-			Distance[31][11]=1+fcc7t;
-			Distance[31][13]=1+fcc8t;
-			Distance[31][9]=1+fcc9t;
-			Distance[11][4]=1+fcc13t;
-			Distance[11][15]=1+fcc14t;
-			Distance[11][36]=1+fcc15t;
-			Distance[13][4]=1+fcc13t;
-			Distance[13][15]=1+fcc14t;
-			Distance[13][36]=1+fcc15t;
-			Distance[9][4]=1+fcc13t;
-			Distance[9][15]=1+fcc14t;
-			Distance[9][36]=1+fcc15t;
-			Distance[4][38]=1;
-			Distance[15][38]=1;
-			Distance[36][38]=1;
-			}
-			if(functionType==11){
-			Distance[0][11]=1+fcc7t;
-			Distance[0][13]=1+fcc8t;
-			Distance[0][9]=1+fcc9t;
-			Distance[11][7]=1+fcc4t;
-			Distance[11][21]=1+fcc5t;
-			Distance[11][31]=1+fcc6t;
-			Distance[13][7]=1+fcc4t;
-			Distance[13][21]=1+fcc5t;
-			Distance[13][31]=1+fcc6t;
-			Distance[9][7]=1+fcc4t;
-			Distance[9][21]=1+fcc5t;
-			Distance[9][31]=1+fcc6t;
-			Distance[7][24]=1+fcc10t;
-			Distance[7][10]=1+fcc11t;
-			Distance[7][20]=1+fcc12t;
-			Distance[21][24]=1+fcc10t;
-			Distance[21][10]=1+fcc11t;
-			Distance[21][20]=1+fcc12t;
-			Distance[31][24]=1+fcc10t;
-			Distance[31][10]=1+fcc11t;
-			Distance[31][20]=1+fcc12t;
-			Distance[24][38]=1;
-			Distance[10][38]=1;
-			Distance[20][38]=1;
-			}
-			if(functionType==12){
-			Distance[0][11]=1+fcc7t;
-			Distance[0][13]=1+fcc8t;
-			Distance[0][9]=1+fcc9t;
-			Distance[11][7]=1+fcc4t;
-			Distance[11][21]=1+fcc5t;
-			Distance[11][31]=1+fcc6t;
-			Distance[13][7]=1+fcc4t;
-			Distance[13][21]=1+fcc5t;
-			Distance[13][31]=1+fcc6t;
-			Distance[9][7]=1+fcc4t;
-			Distance[9][21]=1+fcc5t;
-			Distance[9][31]=1+fcc6t;
-			Distance[7][4]=1+fcc13t;
-			Distance[7][15]=1+fcc14t;
-			Distance[7][36]=1+fcc15t;
-			Distance[21][4]=1+fcc13t;
-			Distance[21][15]=1+fcc14t;
-			Distance[21][36]=1+fcc15t;
-			Distance[31][4]=1+fcc13t;
-			Distance[31][15]=1+fcc14t;
-			Distance[31][36]=1+fcc15t;
-			Distance[4][38]=1;
-			Distance[15][38]=1;
-			Distance[36][38]=1;
-			}
-			//*/  //Sinet
-
-			//Geant
-			///*
-			if(functionType==1){
-			Distance[0][35]=1+fcc1t;
-			Distance[0][25]=1+fcc2t;
-			Distance[0][16]=1+fcc3t;
-			Distance[35][7]=1+fcc4t;
-			Distance[35][21]=1+fcc5t;
-			Distance[35][31]=1+fcc6t;
-			Distance[25][7]=1+fcc4t;
-			Distance[25][21]=1+fcc5t;
-			Distance[25][31]=1+fcc6t;
-			Distance[16][7]=1+fcc4t;
-			Distance[16][21]=1+fcc5t;
-			Distance[16][31]=1+fcc6t;
-			Distance[7][24]=1+fcc10t;
-			Distance[7][10]=1+fcc11t;
-			Distance[7][20]=1+fcc12t;
-			Distance[21][24]=1+fcc10t;
-			Distance[21][10]=1+fcc11t;
-			Distance[21][20]=1+fcc12t;
-			Distance[31][24]=1+fcc10t;
-			Distance[31][10]=1+fcc11t;
-			Distance[31][20]=1+fcc12t;
-			Distance[24][38]=1;
-			Distance[10][38]=1;
-			Distance[20][38]=1;
-			}
-			if(functionType==2){
-			Distance[0][35]=1+fcc1t;
-			Distance[0][25]=1+fcc2t;
-			Distance[0][16]=1+fcc3t;
-			Distance[35][7]=1+fcc4t;
-			Distance[35][21]=1+fcc5t;
-			Distance[35][31]=1+fcc6t;
-			Distance[25][7]=1+fcc4t;
-			Distance[25][21]=1+fcc5t;
-			Distance[25][31]=1+fcc6t;
-			Distance[16][7]=1+fcc4t;
-			Distance[16][21]=1+fcc5t;
-			Distance[16][31]=1+fcc6t;
-			Distance[7][4]=1+fcc13t;
-			Distance[7][15]=1+fcc14t;
-			Distance[7][36]=1+fcc15t;
-			Distance[21][4]=1+fcc13t;
-			Distance[21][15]=1+fcc14t;
-			Distance[21][36]=1+fcc15t;
-			Distance[31][4]=1+fcc13t;
-			Distance[31][15]=1+fcc14t;
-			Distance[31][36]=1+fcc15t;
-			Distance[4][38]=1;
-			Distance[15][38]=1;
-			Distance[36][38]=1;
-			}
-			if(functionType==3){
-			Distance[0][7]=1+fcc4t;
-			Distance[0][21]=1+fcc5t;
-			Distance[0][31]=1+fcc6t;
-			Distance[7][35]=1+fcc1t;
-			Distance[7][25]=1+fcc2t;
-			Distance[7][16]=1+fcc3t;
-			Distance[21][35]=1+fcc1t;
-			Distance[21][25]=1+fcc2t;
-			Distance[21][16]=1+fcc3t;
-			Distance[31][35]=1+fcc1t;
-			Distance[31][25]=1+fcc2t;
-			Distance[31][16]=1+fcc3t;
-			Distance[35][24]=1+fcc10t;
-			Distance[35][10]=1+fcc11t;
-			Distance[35][20]=1+fcc12t;
-			Distance[25][24]=1+fcc10t;
-			Distance[25][10]=1+fcc11t;
-			Distance[25][20]=1+fcc12t;
-			Distance[16][24]=1+fcc10t;
-			Distance[16][10]=1+fcc11t;
-			Distance[16][20]=1+fcc12t;
-			Distance[24][38]=1;
-			Distance[10][38]=1;
-			Distance[20][38]=1;
-			}
-			if(functionType==4){
-			Distance[0][7]=1+fcc4t;
-			Distance[0][21]=1+fcc5t;
-			Distance[0][31]=1+fcc6t;
-			Distance[7][35]=1+fcc1t;
-			Distance[7][25]=1+fcc2t;
-			Distance[7][16]=1+fcc3t;
-			Distance[21][35]=1+fcc1t;
-			Distance[21][25]=1+fcc2t;
-			Distance[21][16]=1+fcc3t;
-			Distance[31][35]=1+fcc1t;
-			Distance[31][25]=1+fcc2t;
-			Distance[31][16]=1+fcc3t;
-			Distance[35][4]=1+fcc13t;
-			Distance[35][15]=1+fcc14t;
-			Distance[35][36]=1+fcc15t;
-			Distance[25][4]=1+fcc13t;
-			Distance[25][15]=1+fcc14t;
-			Distance[25][36]=1+fcc15t;
-			Distance[16][4]=1+fcc13t;
-			Distance[16][15]=1+fcc14t;
-			Distance[16][36]=1+fcc15t;
-			Distance[4][38]=1;
-			Distance[15][38]=1;
-			Distance[36][38]=1;
-			}
-			if(functionType==5){
-			Distance[0][35]=1+fcc1t;
-			Distance[0][25]=1+fcc2t;
-			Distance[0][16]=1+fcc3t;
-			Distance[35][11]=1+fcc7t;
-			Distance[35][13]=1+fcc8t;
-			Distance[35][9]=1+fcc9t;
-			Distance[25][11]=1+fcc7t;
-			Distance[25][13]=1+fcc8t;
-			Distance[25][9]=1+fcc9t;
-			Distance[16][11]=1+fcc7t;
-			Distance[16][13]=1+fcc8t;
-			Distance[16][9]=1+fcc9t;
-			Distance[11][24]=1+fcc10t;
-			Distance[11][10]=1+fcc11t;
-			Distance[11][20]=1+fcc12t;
-			Distance[13][24]=1+fcc10t;
-			Distance[13][10]=1+fcc11t;
-			Distance[13][20]=1+fcc12t;
-			Distance[9][24]=1+fcc10t;
-			Distance[9][10]=1+fcc11t;
-			Distance[9][20]=1+fcc12t;
-			Distance[24][38]=1;
-			Distance[10][38]=1;
-			Distance[20][38]=1;
-			}
-			if(functionType==6){
-			Distance[0][35]=1+fcc1t;
-			Distance[0][25]=1+fcc2t;
-			Distance[0][16]=1+fcc3t;
-			Distance[35][11]=1+fcc7t;
-			Distance[35][13]=1+fcc8t;
-			Distance[35][9]=1+fcc9t;
-			Distance[25][11]=1+fcc7t;
-			Distance[25][13]=1+fcc8t;
-			Distance[25][9]=1+fcc9t;
-			Distance[16][11]=1+fcc7t;
-			Distance[16][13]=1+fcc8t;
-			Distance[16][9]=1+fcc9t;
-			Distance[11][4]=1+fcc13t;
-			Distance[11][15]=1+fcc14t;
-			Distance[11][36]=1+fcc15t;
-			Distance[13][4]=1+fcc13t;
-			Distance[13][15]=1+fcc14t;
-			Distance[13][36]=1+fcc15t;
-			Distance[9][4]=1+fcc13t;
-			Distance[9][15]=1+fcc14t;
-			Distance[9][36]=1+fcc15t;
-			Distance[4][38]=1;
-			Distance[15][38]=1;
-			Distance[36][38]=1;
-			}
-			if(functionType==7){
-			Distance[0][11]=1+fcc7t;
-			Distance[0][13]=1+fcc8t;
-			Distance[0][9]=1+fcc9t;
-			Distance[11][35]=1+fcc1t;
-			Distance[11][25]=1+fcc2t;
-			Distance[11][16]=1+fcc3t;
-			Distance[13][35]=1+fcc1t;
-			Distance[13][25]=1+fcc2t;
-			Distance[13][16]=1+fcc3t;
-			Distance[9][35]=1+fcc1t;
-			Distance[9][25]=1+fcc2t;
-			Distance[9][16]=1+fcc3t;
-			Distance[35][24]=1+fcc10t;
-			Distance[35][10]=1+fcc11t;
-			Distance[35][20]=1+fcc12t;
-			Distance[25][24]=1+fcc10t;
-			Distance[25][10]=1+fcc11t;
-			Distance[25][20]=1+fcc12t;
-			Distance[16][24]=1+fcc10t;
-			Distance[16][10]=1+fcc11t;
-			Distance[16][20]=1+fcc12t;
-			Distance[24][38]=1;
-			Distance[10][38]=1;
-			Distance[20][38]=1;
-			}
-			if(functionType==8){
-			Distance[0][11]=1+fcc7t;
-			Distance[0][13]=1+fcc8t;
-			Distance[0][9]=1+fcc9t;
-			Distance[11][35]=1+fcc1t;
-			Distance[11][25]=1+fcc2t;
-			Distance[11][16]=1+fcc3t;
-			Distance[13][35]=1+fcc1t;
-			Distance[13][25]=1+fcc2t;
-			Distance[13][16]=1+fcc3t;
-			Distance[9][35]=1+fcc1t;
-			Distance[9][25]=1+fcc2t;
-			Distance[9][16]=1+fcc3t;
-			Distance[35][4]=1+fcc13t;
-			Distance[35][15]=1+fcc14t;
-			Distance[35][36]=1+fcc15t;
-			Distance[25][4]=1+fcc13t;
-			Distance[25][15]=1+fcc14t;
-			Distance[25][36]=1+fcc15t;
-			Distance[16][4]=1+fcc13t;
-			Distance[16][15]=1+fcc14t;
-			Distance[16][36]=1+fcc15t;
-			Distance[4][38]=1;
-			Distance[15][38]=1;
-			Distance[36][38]=1;
-			}
-			if(functionType==9){
-			Distance[0][7]=1+fcc4t;
-			Distance[0][21]=1+fcc5t;
-			Distance[0][31]=1+fcc6t;
-			Distance[7][11]=1+fcc7t;
-			Distance[7][13]=1+fcc8t;
-			Distance[7][9]=1+fcc9t;
-			Distance[21][11]=1+fcc7t;
-			Distance[21][13]=1+fcc8t;
-			Distance[21][9]=1+fcc9t;
-			Distance[31][11]=1+fcc7t;
-			Distance[31][13]=1+fcc8t;
-			Distance[31][9]=1+fcc9t;
-			Distance[11][24]=1+fcc10t;
-			Distance[11][10]=1+fcc11t;
-			Distance[11][20]=1+fcc12t;
-			Distance[13][24]=1+fcc10t;
-			Distance[13][10]=1+fcc11t;
-			Distance[13][20]=1+fcc12t;
-			Distance[9][24]=1+fcc10t;
-			Distance[9][10]=1+fcc11t;
-			Distance[9][20]=1+fcc12t;
-			Distance[24][38]=1;
-			Distance[10][38]=1;
-			Distance[20][38]=1;
-			}
-			if(functionType==10){
-			Distance[0][7]=1+fcc4t;
-			Distance[0][21]=1+fcc5t;
-			Distance[0][31]=1+fcc6t;
-			Distance[7][11]=1+fcc7t;
-			Distance[7][13]=1+fcc8t;
-			Distance[7][9]=1+fcc9t;
-			Distance[21][11]=1+fcc7t;
-			Distance[21][13]=1+fcc8t;
-			Distance[21][9]=1+fcc9t;
-			Distance[31][11]=1+fcc7t;
-			Distance[31][13]=1+fcc8t;
-			Distance[31][9]=1+fcc9t;
-			Distance[11][4]=1+fcc13t;
-			Distance[11][15]=1+fcc14t;
-			Distance[11][36]=1+fcc15t;
-			Distance[13][4]=1+fcc13t;
-			Distance[13][15]=1+fcc14t;
-			Distance[13][36]=1+fcc15t;
-			Distance[9][4]=1+fcc13t;
-			Distance[9][15]=1+fcc14t;
-			Distance[9][36]=1+fcc15t;
-			Distance[4][38]=1;
-			Distance[15][38]=1;
-			Distance[36][38]=1;
-			}
-			if(functionType==11){
-			Distance[0][11]=1+fcc7t;
-			Distance[0][13]=1+fcc8t;
-			Distance[0][9]=1+fcc9t;
-			Distance[11][7]=1+fcc4t;
-			Distance[11][21]=1+fcc5t;
-			Distance[11][31]=1+fcc6t;
-			Distance[13][7]=1+fcc4t;
-			Distance[13][21]=1+fcc5t;
-			Distance[13][31]=1+fcc6t;
-			Distance[9][7]=1+fcc4t;
-			Distance[9][21]=1+fcc5t;
-			Distance[9][31]=1+fcc6t;
-			Distance[7][24]=1+fcc10t;
-			Distance[7][10]=1+fcc11t;
-			Distance[7][20]=1+fcc12t;
-			Distance[21][24]=1+fcc10t;
-			Distance[21][10]=1+fcc11t;
-			Distance[21][20]=1+fcc12t;
-			Distance[31][24]=1+fcc10t;
-			Distance[31][10]=1+fcc11t;
-			Distance[31][20]=1+fcc12t;
-			Distance[24][38]=1;
-			Distance[10][38]=1;
-			Distance[20][38]=1;
-			}
-			if(functionType==12){
-			Distance[0][11]=1+fcc7t;
-			Distance[0][13]=1+fcc8t;
-			Distance[0][9]=1+fcc9t;
-			Distance[11][7]=1+fcc4t;
-			Distance[11][21]=1+fcc5t;
-			Distance[11][31]=1+fcc6t;
-			Distance[13][7]=1+fcc4t;
-			Distance[13][21]=1+fcc5t;
-			Distance[13][31]=1+fcc6t;
-			Distance[9][7]=1+fcc4t;
-			Distance[9][21]=1+fcc5t;
-			Distance[9][31]=1+fcc6t;
-			Distance[7][4]=1+fcc13t;
-			Distance[7][15]=1+fcc14t;
-			Distance[7][36]=1+fcc15t;
-			Distance[21][4]=1+fcc13t;
-			Distance[21][15]=1+fcc14t;
-			Distance[21][36]=1+fcc15t;
-			Distance[31][4]=1+fcc13t;
-			Distance[31][15]=1+fcc14t;
-			Distance[31][36]=1+fcc15t;
-			Distance[4][38]=1;
-			Distance[15][38]=1;
-			Distance[36][38]=1;
-			}
-
-	}
-
-
-
-	int nPoint = N;
-
-	//int sRoute[nPoint];
-	double sDist;
-
-	double pDist[nPoint];
-	int pRoute[nPoint];
-	bool pFixed[nPoint];
-	int sPoint, i, j, newDist;
-
-	sDist = 99999;
-
-	for(i = 0; i < nPoint; i++){
-		sRoute[i] = -1;
-		pDist[i] = 99999;
-		pFixed[i] = false;
-	}
-
-	pDist[sp] = 0;
-
-	while(true){
-		i = 0;
-		while(i < nPoint){
-			if(pFixed[i] == 0){
-				break;
-			}
-			i = i + 1;
-		}
-
-		if(i == nPoint){
-			break;
-		}
-
-		for(j = i + 1; j < nPoint; j++){
-			if((pFixed[j] == 0) && (pDist[j] < pDist[i])){
-				i = j;
-			}
-		}
-
-		sPoint = i;
-		pFixed[sPoint] = true;
-
-		for(j = 0; j < nPoint; j++){
-			if((Distance[sPoint][j] > 0) && (pFixed[j] == 0)){
-				newDist = pDist[sPoint] + Distance[sPoint][j];
-				if(newDist < pDist[j]){
-					pDist[j] = newDist;
-					pRoute[j] = sPoint;
-				}
-			}
-		}
-	}
-
-	sDist=pDist[dp];
-	j = 0;
-	i = dp;
-	while(i != sp){
-		sRoute[j] = i;
-		i = pRoute[i];
-		j = j + 1;
-	}
-	sRoute[j] = sp;
-
-
-	//for us1
-	/*
-	switch (sRoute[3]) {
-	case 3:
-		sDist -= fcc1;
-		break;
-	case 10:
-		sDist -= fcc2;
-		break;
-	case 21:
-		sDist -= fcc3;
-		break;
-	case 7:
-		sDist -= fcc4;
-		break;
-	case 13:
-		sDist -= fcc5;
-		break;
-	case 23:
-		sDist -= fcc6;
-		break;
-	case 4:
-		sDist -= fcc7;
-		break;
-	case 12:
-		sDist -= fcc8;
-		break;
-	case 17:
-		sDist -= fcc9;
-		break;
-	case 6:
-		sDist -= fcc10;
-		break;
-	case 9:
-		sDist -= fcc11;
-		break;
-	case 15:
-		sDist -= fcc12;
-		break;
-	case 2:
-		sDist -= fcc13;
-		break;
-	case 11:
-		sDist -= fcc14;
-		break;
-	case 20:
-		sDist -= fcc15;
-		break;
-	default:
-		break;
-	}
-
-	switch (sRoute[2]) {
-	case 3:
-		sDist -= fcc1;
-		break;
-	case 10:
-		sDist -= fcc2;
-		break;
-	case 21:
-		sDist -= fcc3;
-		break;
-	case 7:
-		sDist -= fcc4;
-		break;
-	case 13:
-		sDist -= fcc5;
-		break;
-	case 23:
-		sDist -= fcc6;
-		break;
-	case 4:
-		sDist -= fcc7;
-		break;
-	case 12:
-		sDist -= fcc8;
-		break;
-	case 17:
-		sDist -= fcc9;
-		break;
-	case 6:
-		sDist -= fcc10;
-		break;
-	case 9:
-		sDist -= fcc11;
-		break;
-	case 15:
-		sDist -= fcc12;
-		break;
-	case 2:
-		sDist -= fcc13;
-		break;
-	case 11:
-		sDist -= fcc14;
-		break;
-	case 20:
-		sDist -= fcc15;
-		break;
-	default:
-		break;
-	}
-
-	switch (sRoute[1]) {
-	case 3:
-		sDist -= fcc1;
-		break;
-	case 10:
-		sDist -= fcc2;
-		break;
-	case 21:
-		sDist -= fcc3;
-		break;
-	case 7:
-		sDist -= fcc4;
-		break;
-	case 13:
-		sDist -= fcc5;
-		break;
-	case 23:
-		sDist -= fcc6;
-		break;
-	case 4:
-		sDist -= fcc7;
-		break;
-	case 12:
-		sDist -= fcc8;
-		break;
-	case 17:
-		sDist -= fcc9;
-		break;
-	case 6:
-		sDist -= fcc10;
-		break;
-	case 9:
-		sDist -= fcc11;
-		break;
-	case 15:
-		sDist -= fcc12;
-		break;
-	case 2:
-		sDist -= fcc13;
-		break;
-	case 11:
-		sDist -= fcc14;
-		break;
-	case 20:
-		sDist -= fcc15;
-		break;
-	default:
-		break;
-	}
-*/
-	//Sinet
-	/*
-		switch (sRoute[3]) {
-				case 35:
-				sDist -= fcc1;
-				break;
-				case 25:
-				sDist -= fcc2;
-				break;
-				case 16:
-				sDist -= fcc3;
-				break;
-				case 7:
-				sDist -= fcc4;
-				break;
-				case 21:
-				sDist -= fcc5;
-				break;
-				case 31:
-				sDist -= fcc6;
-				break;
-				case 11:
-				sDist -= fcc7;
-				break;
-				case 13:
-				sDist -= fcc8;
-				break;
-				case 9:
-				sDist -= fcc9;
-				break;
-				case 24:
-				sDist -= fcc10;
-				break;
-				case 10:
-				sDist -= fcc11;
-				break;
-				case 20:
-				sDist -= fcc12;
-				break;
-				case 4:
-				sDist -= fcc13;
-				break;
-				case 15:
-				sDist -= fcc14;
-				break;
-				case 36:
-				sDist -= fcc15;
-				break;
-				default:
-				break;
-				}
-				switch (sRoute[2]) {
-				case 35:
-				sDist -= fcc1;
-				break;
-				case 25:
-				sDist -= fcc2;
-				break;
-				case 16:
-				sDist -= fcc3;
-				break;
-				case 7:
-				sDist -= fcc4;
-				break;
-				case 21:
-				sDist -= fcc5;
-				break;
-				case 31:
-				sDist -= fcc6;
-				break;
-				case 11:
-				sDist -= fcc7;
-				break;
-				case 13:
-				sDist -= fcc8;
-				break;
-				case 9:
-				sDist -= fcc9;
-				break;
-				case 24:
-				sDist -= fcc10;
-				break;
-				case 10:
-				sDist -= fcc11;
-				break;
-				case 20:
-				sDist -= fcc12;
-				break;
-				case 4:
-				sDist -= fcc13;
-				break;
-				case 15:
-				sDist -= fcc14;
-				break;
-				case 36:
-				sDist -= fcc15;
-				break;
-				default:
-				break;
-				}
-				switch (sRoute[1]) {
-				case 35:
-				sDist -= fcc1;
-				break;
-				case 25:
-				sDist -= fcc2;
-				break;
-				case 16:
-				sDist -= fcc3;
-				break;
-				case 7:
-				sDist -= fcc4;
-				break;
-				case 21:
-				sDist -= fcc5;
-				break;
-				case 31:
-				sDist -= fcc6;
-				break;
-				case 11:
-				sDist -= fcc7;
-				break;
-				case 13:
-				sDist -= fcc8;
-				break;
-				case 9:
-				sDist -= fcc9;
-				break;
-				case 24:
-				sDist -= fcc10;
-				break;
-				case 10:
-				sDist -= fcc11;
-				break;
-				case 20:
-				sDist -= fcc12;
-				break;
-				case 4:
-				sDist -= fcc13;
-				break;
-				case 15:
-				sDist -= fcc14;
-				break;
-				case 36:
-				sDist -= fcc15;
-				break;
-				default:
-				break;
-				}
-*/ //Sinet
-
-				//Geant
-				///*
-				switch (sRoute[3]) {
-				case 35:
-				sDist -= fcc1;
-				break;
-				case 25:
-				sDist -= fcc2;
-				break;
-				case 16:
-				sDist -= fcc3;
-				break;
-				case 7:
-				sDist -= fcc4;
-				break;
-				case 21:
-				sDist -= fcc5;
-				break;
-				case 31:
-				sDist -= fcc6;
-				break;
-				case 11:
-				sDist -= fcc7;
-				break;
-				case 13:
-				sDist -= fcc8;
-				break;
-				case 9:
-				sDist -= fcc9;
-				break;
-				case 24:
-				sDist -= fcc10;
-				break;
-				case 10:
-				sDist -= fcc11;
-				break;
-				case 20:
-				sDist -= fcc12;
-				break;
-				case 4:
-				sDist -= fcc13;
-				break;
-				case 15:
-				sDist -= fcc14;
-				break;
-				case 36:
-				sDist -= fcc15;
-				break;
-				default:
-				break;
-				}
-				switch (sRoute[2]) {
-				case 35:
-				sDist -= fcc1;
-				break;
-				case 25:
-				sDist -= fcc2;
-				break;
-				case 16:
-				sDist -= fcc3;
-				break;
-				case 7:
-				sDist -= fcc4;
-				break;
-				case 21:
-				sDist -= fcc5;
-				break;
-				case 31:
-				sDist -= fcc6;
-				break;
-				case 11:
-				sDist -= fcc7;
-				break;
-				case 13:
-				sDist -= fcc8;
-				break;
-				case 9:
-				sDist -= fcc9;
-				break;
-				case 24:
-				sDist -= fcc10;
-				break;
-				case 10:
-				sDist -= fcc11;
-				break;
-				case 20:
-				sDist -= fcc12;
-				break;
-				case 4:
-				sDist -= fcc13;
-				break;
-				case 15:
-				sDist -= fcc14;
-				break;
-				case 36:
-				sDist -= fcc15;
-				break;
-				default:
-				break;
-				}
-				switch (sRoute[1]) {
-				case 35:
-				sDist -= fcc1;
-				break;
-				case 25:
-				sDist -= fcc2;
-				break;
-				case 16:
-				sDist -= fcc3;
-				break;
-				case 7:
-				sDist -= fcc4;
-				break;
-				case 21:
-				sDist -= fcc5;
-				break;
-				case 31:
-				sDist -= fcc6;
-				break;
-				case 11:
-				sDist -= fcc7;
-				break;
-				case 13:
-				sDist -= fcc8;
-				break;
-				case 9:
-				sDist -= fcc9;
-				break;
-				case 24:
-				sDist -= fcc10;
-				break;
-				case 10:
-				sDist -= fcc11;
-				break;
-				case 20:
-				sDist -= fcc12;
-				break;
-				case 4:
-				sDist -= fcc13;
-				break;
-				case 15:
-				sDist -= fcc14;
-				break;
-				case 36:
-				sDist -= fcc15;
-				break;
-				default:
-				break;
-				}
-			//*/  //Geant
-
-	return sDist;
-
-}
-
-int rr[6] = {0,1,1,1,1,1};
+// round-robin position of every function, shared by all consumers
+static std::vector<uint32_t> rr;
 
 std::string
-Consumer::roundRobin(int func){
-	if(func == 1){
-		if(rr[func] == 1){
-			rr[func] = 2;
-			return "/F1a";
-		}else if(rr[func] == 2){
-			rr[func] = 3;
-			return "/F1b";
-		}else if(rr[func] == 3){
-			rr[func] = 1;
-			return "/F1c";
-		}
-	}
-	if(func == 2){
-		if(rr[func] == 1){
-			rr[func] = 2;
-			return "/F2a";
-		}else if(rr[func] == 2){
-			rr[func] = 3;
-			return "/F2b";
-		}else if(rr[func] == 3){
-			rr[func] = 1;
-			return "/F2c";
-		}
-	}
-	if(func == 3){
-		if(rr[func] == 1){
-			rr[func] = 2;
-			return "/F3a";
-		}else if(rr[func] == 2){
-			rr[func] = 3;
-			return "/F3b";
-		}else if(rr[func] == 3){
-			rr[func] = 1;
-			return "/F3c";
-		}
-	}
-	if(func == 4){
-		if(rr[func] == 1){
-			rr[func] = 2;
-			return "/F4a";
-		}else if(rr[func] == 2){
-			rr[func] = 3;
-			return "/F4b";
-		}else if(rr[func] == 3){
-			rr[func] = 1;
-			return "/F4c";
-		}
-	}
-	if(func == 5){
-		if(rr[func] == 1){
-			rr[func] = 2;
-			return "/F5a";
-		}else if(rr[func] == 2){
-			rr[func] = 3;
-			return "/F5b";
-		}else if(rr[func] == 3){
-			rr[func] = 1;
-			return "/F5c";
-		}
-	}
-
-	return "";
+Consumer::roundRobin(uint32_t func){
+	const SfcCatalog::Function& function = m_catalog->GetFunction(func);
+	if(rr.size() <= func){
+		rr.resize(func + 1, 0);
+	}
+	uint32_t instance = rr[func] % function.instances.size();
+	rr[func] = instance + 1;
+	return "/" + function.instances[instance];
 }
 
 //defined by yamaguchi
 int
-Consumer::funcJudge(int fn){
-	int function = 4;
-	/*if(table[0][fn][0]+table[1][fn][0] <= table[0][fn][1]+table[1][fn][1]){
-		if(table[0][fn][0]+table[1][fn][0] <= table[0][fn][2]+table[1][fn][2]){
-			function = 0;
+Consumer::funcJudge(uint32_t fn){
+	const SfcCatalog::Function& function = m_catalog->GetFunction(fn);
+
+	// the first instance with the smallest hop count plus call count
+	int selected = 0;
+	int bestCost = std::numeric_limits<int>::max();
+	for(uint32_t i = 0; i < function.instances.size(); i++){
+		uint32_t counterIndex = function.firstCounterIndex + i;
+		int cost = getTableEntry(0, counterIndex) + getTableEntry(1, counterIndex);
+		if(cost < bestCost){
+			bestCost = cost;
+			selected = i;
 		}
-	}else if(table[0][fn][1]+table[1][fn][1] <= table[0][fn][2]+table[1][fn][2]){
-		function = 1;
-	}else{
-		function = 2;
-	}*/
-	if(table[0][fn][0]+table[1][fn][0] <= table[0][fn][1]+table[1][fn][1] && table[0][fn][0]+table[1][fn][0] <= table[0][fn][2]+table[1][fn][2]){
-		function = 0;
-	}else if(table[0][fn][1]+table[1][fn][1] <= table[0][fn][0]+table[1][fn][0] && table[0][fn][1]+table[1][fn][1] <= table[0][fn][2]+table[1][fn][2]){
-		function = 1;
-	}else if(table[0][fn][2]+table[1][fn][2] <= table[0][fn][0]+table[1][fn][0] && table[0][fn][2]+table[1][fn][2] <= table[0][fn][0]+table[1][fn][0]){
-		function = 2;
-	}else{
-		std::cout <<  "error" << std::endl;
 	}
 
-	if(function != 4){
-		table[1][fn][function]++;
-	}else{
-		std::cout << "Error: cousumer.cpp @FuncJudge" << std::endl;
-	}
-	return function;
+	getTableEntry(1, function.firstCounterIndex + selected)++;
+	return selected;
 }
 
 //defined by yamaguchi
 shared_ptr<std::string>
-Consumer::duration(int f1, int f2, int f3){
-	shared_ptr<std::string> ptr;
-
-	int charactor = funcJudge(f1);
-	if(f1 == 1){
-		if(charactor == 0){
-			table[1][1][0] += ns3::getWeight();
-			ptr = make_shared<std::string>("/F1a");
-
-		}else if(charactor == 1){
-			table[1][1][1] += ns3::getWeight();
-			ptr = make_shared<std::string>("/F1b");
-
-		}else if(charactor == 2){
-			table[1][1][2] += ns3::getWeight();
-			ptr = make_shared<std::string>("/F1c");
-
-		}
-	}else if(f1 == 2){
-		if(charactor == 0){
-			table[1][2][0] += ns3::getWeight();
-			ptr = make_shared<std::string>("/F2a");
-
-		}else if(charactor == 1){
-			table[1][2][1] += ns3::getWeight();
-			ptr = make_shared<std::string>("/F2b");
-
-		}else if(charactor == 2){
-			table[1][2][2] += ns3::getWeight();
-			ptr = make_shared<std::string>("/F2c");
-
-		}
-	}else if(f1 == 3){
-		if(charactor == 0){
-			table[1][3][0] += ns3::getWeight();
-			ptr = make_shared<std::string>("/F3a");
-
-		}else if(charactor == 1){
-			table[1][3][1] += ns3::getWeight();
-			ptr = make_shared<std::string>("/F3b");
-
-		}else if(charactor == 2){
-			table[1][3][2] += ns3::getWeight();
-			ptr = make_shared<std::string>("/F3c");
-
-		}
-	}
+Consumer::duration(const SfcCatalog::Chain& chain){
+	const SfcCatalog::Function& first = m_catalog->GetFunction(chain.functions.front());
 
-	if(f2 == 1){
-		*ptr += "/F1";
-	}else if(f2 == 2){
-		*ptr += "/F2";
-	}else if(f2 == 3){
-		*ptr += "/F3";
-	}
+	int charactor = funcJudge(chain.functions.front());
+	getTableEntry(1, first.firstCounterIndex + charactor) += ns3::getWeight();
+	shared_ptr<std::string> ptr = make_shared<std::string>("/" + first.instances[charactor]);
 
-	if(f3 == 4){
-		*ptr += "/F4";
-	}else if(f3 == 5){
-		*ptr += "/F5";
+	for(size_t k = 1; k < chain.functions.size(); k++){
+		*ptr += "/" + m_catalog->GetFunction(chain.functions[k]).name;
 	}
 
 	return ptr;
 }
 
 std::string
-Consumer::randChoice(int func){
-	uint32_t randNum = ::ndn::random::generateWord32() % 3 + 1;
-	if(func == 1){
-		if(randNum == 1){
-			return "/F1a";
-		}else if(randNum == 2){
-			return "/F1b";
-		}else if(randNum == 3){
-			return "/F1c";
-		}
-	}
-	if(func == 2){
-		if(randNum == 1){
-			return "/F2a";
-		}else if(randNum == 2){
-			return "/F2b";
-		}else if(randNum == 3){
-			return "/F2c";
-		}
-	}
-	if(func == 3){
-		if(randNum == 1){
-			return "/F3a";
-		}else if(randNum == 2){
-			return "/F3b";
-		}else if(randNum == 3){
-			return "/F3c";
-		}
-	}
-	if(func == 4){
-		if(randNum == 1){
-			return "/F4a";
-		}else if(randNum == 2){
-			return "/F4b";
-		}else if(randNum == 3){
-			return "/F4c";
-		}
-	}
-	if(func == 5){
-		if(randNum == 1){
-			return "/F5a";
-		}else if(randNum == 2){
-			return "/F5b";
-		}else if(randNum == 3){
-			return "/F5c";
-		}
-	}
-
-	return "";
+Consumer::randChoice(uint32_t func){
+	const SfcCatalog::Function& function = m_catalog->GetFunction(func);
+	uint32_t randNum = m_rand->GetInteger(0, function.instances.size() - 1);
+	return "/" + function.instances[randNum];
 }
 
 shared_ptr<std::string>
-Consumer::fibControl(int f1, int f2, int f3){
-	shared_ptr<std::string> ptr;
-
-	if(f1 == 1){
-		ptr = make_shared<std::string>("/F1+");
-	}else if(f1 == 2){
-		ptr = make_shared<std::string>("/F2+");	
-	}else if(f1 == 3){
-		ptr = make_shared<std::string>("/F3+");
-	}
-
-	if(f2 == 1){
-		*ptr += "/F1";
-	}else if(f2 == 2){
-		*ptr += "/F2";
-	}else if(f2 == 3){
-		*ptr += "/F3";
-	}
+Consumer::fibControl(const SfcCatalog::Chain& chain){
+	shared_ptr<std::string> ptr =
+			make_shared<std::string>("/" + m_catalog->GetFunction(chain.functions.front()).name + "+");
 
-	if(f3 == 4){
-		*ptr += "/F4";
-	}else if(f3 == 5){
-		*ptr += "/F5";
+	for(size_t k = 1; k < chain.functions.size(); k++){
+		*ptr += "/" + m_catalog->GetFunction(chain.functions[k]).name;
 	}
 
 	return ptr;
 }
 
-// 	shared_ptr<std::string> ptr;
-
-// 	if(f1 == 1){
-// 		ptr = make_shared<std::string>("/F1");
-// 	}else if(f1 == 2){
-// 		ptr = make_shared<std::string>("/F2");
-// 	}else if(f1 == 3){
-// 		ptr = make_shared<std::string>("/F3");
-// 	}
-
-// 	if(f2 == 1){
-// 		*ptr += "/F1";
-// 	}else if(f2 == 2){
-// 		*ptr += "/F2";
-// 	}else if(f2 == 3){
-// 		*ptr += "/F3";
-// 	}
+uint32_t
+Consumer::drawWord(){
+	return static_cast<uint32_t>(m_rand->GetValue(0, std::numeric_limits<uint32_t>::max()));
+}
 
-// 	if(f3 == 4){
-// 		*ptr += "/F4";
-// 	}else if(f3 == 5){
-// 		*ptr += "/F5";
-// 	}
+int&
+Consumer::getTableEntry(int kind, uint32_t counterIndex){
+	NS_ASSERT(counterIndex > 0);
+	std::vector<int>& entries = table[kind];
+	if(entries.size() < counterIndex){
+		entries.resize(counterIndex, 0);
+	}
+	return entries[counterIndex - 1];
+}
 
-// 	return ptr;
-// }
+/** \brief draw \p count distinct functions of the catalog, uniformly
+ */
+static std::vector<uint32_t>
+drawDistinctFunctions(const SfcCatalog& catalog, UniformRandomVariable& rand, size_t count){
+	uint32_t nFunctions = catalog.GetNFunctions();
+	NS_ASSERT_MSG(count <= nFunctions, "A chain of " << count << " functions needs "
+			<< count << " distinct functions, the catalog has " << nFunctions);
 
+	std::vector<uint32_t> functions;
+	for(size_t k = 0; k < count; k++){
+		functions.push_back(rand.GetInteger(0, nFunctions - 1));
+	}
+	for(size_t k = 1; k < count; k++){
+		while(std::find(functions.begin(), functions.begin() + k, functions[k]) !=
+				functions.begin() + k){
+			functions[k] = rand.GetInteger(0, nFunctions - 1);
+		}
+	}
+	return functions;
+}
 
 //defined by yamaguchi
 shared_ptr<Name>
-Consumer::sourceRouting(uint32_t functionType, int currentNode, int* sRoute, double weight){
+Consumer::sourceRouting(uint32_t functionType, double weight){
 	shared_ptr<Name> functionName;
 	shared_ptr<std::string> funcName = make_shared<std::string>("");
-	int distance;
+	const SfcCatalog::Chain& chain = m_catalog->GetChain(functionType);
 	switch(getChoiceType()){
 	case 0: //siraiwaNDN
-
-		//distance = dijkstra(0, 25, sRoute, functionType, currentNode, weight, 0);//us-24
-		distance = dijkstra(0, 38, sRoute, functionType, currentNode, weight, 0);//Sinet,Geant
-		//std::cout << "distance: " << distance << std::endl;
-
-		/*
-			  for(int i = 4; i >= 0; i--)
-			    printf("%d,",sRoute[i]);
-			  std::cout << "" << std::endl;
-		 */
-
-		//for us1
-		/*
-		switch (sRoute[3]) {
-		case 3:
-			*funcName = "/F1a";
-			break;
-		case 10:
-			*funcName = "/F1b";
-			break;
-		case 21:
-			*funcName = "/F1c";
-			break;
-		case 7:
-			*funcName = "/F2a";
-			break;
-		case 13:
-			*funcName = "/F2b";
-			break;
-		case 23:
-			*funcName = "/F2c";
-			break;
-		case 4:
-			*funcName = "/F3a";
-			break;
-		case 12:
-			*funcName = "/F3b";
-			break;
-		case 17:
-			*funcName = "/F3c";
-			break;
-		case 6:
-			*funcName = "/F4a";
-			break;
-		case 9:
-			*funcName = "/F4b";
-			break;
-		case 15:
-			*funcName = "/F4c";
-			break;
-		case 2:
-			*funcName = "/F5a";
-			break;
-		case 11:
-			*funcName = "/F5b";
-			break;
-		case 20:
-			*funcName = "/F5c";
-			break;
-		default:
-			break;
-		}
-
-		switch (sRoute[2]) {
-		case 3:
-			*funcName += "/F1a";
-			break;
-		case 10:
-			*funcName += "/F1b";
-			break;
-		case 21:
-			*funcName += "/F1c";
-			break;
-		case 7:
-			*funcName += "/F2a";
-			break;
-		case 13:
-			*funcName += "/F2b";
-			break;
-		case 23:
-			*funcName += "/F2c";
-			break;
-		case 4:
-			*funcName += "/F3a";
-			break;
-		case 12:
-			*funcName += "/F3b";
-			break;
-		case 17:
-			*funcName += "/F3c";
-			break;
-		case 6:
-			*funcName += "/F4a";
-			break;
-		case 9:
-			*funcName += "/F4b";
-			break;
-		case 15:
-			*funcName += "/F4c";
-			break;
-		case 2:
-			*funcName += "/F5a";
-			break;
-		case 11:
-			*funcName += "/F5b";
-			break;
-		case 20:
-			*funcName += "/F5c";
-			break;
-		default:
-			break;
-		}
-
-		switch (sRoute[1]) {
-		case 3:
-			*funcName += "/F1a";
-			break;
-		case 10:
-			*funcName += "/F1b";
-			break;
-		case 21:
-			*funcName += "/F1c";
-			break;
-		case 7:
-			*funcName += "/F2a";
-			break;
-		case 13:
-			*funcName += "/F2b";
-			break;
-		case 23:
-			*funcName += "/F2c";
-			break;
-		case 4:
-			*funcName += "/F3a";
-			break;
-		case 12:
-			*funcName += "/F3b";
-			break;
-		case 17:
-			*funcName += "/F3c";
-			break;
-		case 6:
-			*funcName += "/F4a";
-			break;
-		case 9:
-			*funcName += "/F4b";
-			break;
-		case 15:
-			*funcName += "/F4c";
-			break;
-		case 2:
-			*funcName += "/F5a";
-			break;
-		case 11:
-			*funcName += "/F5b";
-			break;
-		case 20:
-			*funcName += "/F5c";
-			break;
-		default:
-			break;
-		}
-		*/
-	//Sinet
-	/*
-		 switch (sRoute[3]) {
-				case 35:
-				*funcName = "/F1a";
-				break;
-				case 25:
-				*funcName = "/F1b";
-				break;
-				case 16:
-				*funcName = "/F1c";
-				break;
-				case 7:
-				*funcName = "/F2a";
-				break;
-				case 21:
-				*funcName = "/F2b";
-				break;
-				case 31:
-				*funcName = "/F2c";
-				break;
-				case 11:
-				*funcName = "/F3a";
-				break;
-				case 13:
-				*funcName = "/F3b";
-				break;
-				case 9:
-				*funcName = "/F3c";
-				break;
-				case 24:
-				*funcName = "/F4a";
-				break;
-				case 10:
-				*funcName = "/F4b";
-				break;
-				case 20:
-				*funcName = "/F4c";
-				break;
-				case 4:
-				*funcName = "/F5a";
-				break;
-				case 15:
-				*funcName = "/F5b";
-				break;
-				case 36:
-				*funcName = "/F5c";
-				break;
-				default:
-				break;
-				}
-				switch (sRoute[2]) {
-				case 35:
-				*funcName += "/F1a";
-				break;
-				case 25:
-				*funcName += "/F1b";
-				break;
-				case 16:
-				*funcName += "/F1c";
-				break;
-				case 7:
-				*funcName += "/F2a";
-				break;
-				case 21:
-				*funcName += "/F2b";
-				break;
-				case 31:
-				*funcName += "/F2c";
-				break;
-				case 11:
-				*funcName += "/F3a";
-				break;
-				case 13:
-				*funcName += "/F3b";
-				break;
-				case 9:
-				*funcName += "/F3c";
-				break;
-				case 24:
-				*funcName += "/F4a";
-				break;
-				case 10:
-				*funcName += "/F4b";
-				break;
-				case 20:
-				*funcName += "/F4c";
-				break;
-				case 4:
-				*funcName += "/F5a";
-				break;
-				case 15:
-				*funcName += "/F5b";
-				break;
-				case 36:
-				*funcName += "/F5c";
-				break;
-				default:
-				break;
-				}
-				switch (sRoute[1]) {
-				case 35:
-				*funcName += "/F1a";
-				break;
-				case 25:
-				*funcName += "/F1b";
-				break;
-				case 16:
-				*funcName += "/F1c";
-				break;
-				case 7:
-				*funcName += "/F2a";
-				break;
-				case 21:
-				*funcName += "/F2b";
-				break;
-				case 31:
-				*funcName += "/F2c";
-				break;
-				case 11:
-				*funcName += "/F3a";
-				break;
-				case 13:
-				*funcName += "/F3b";
-				break;
-				case 9:
-				*funcName += "/F3c";
-				break;
-				case 24:
-				*funcName += "/F4a";
-				break;
-				case 10:
-				*funcName += "/F4b";
-				break;
-				case 20:
-				*funcName += "/F4c";
-				break;
-				case 4:
-				*funcName += "/F5a";
-				break;
-				case 15:
-				*funcName += "/F5b";
-				break;
-				case 36:
-				*funcName += "/F5c";
-				break;
-				default:
-				break;
-			}
-*/
-				//Geant
-				///*
-				 switch (sRoute[3]) {
-				case 35:
-				*funcName = "/F1a";
-				break;
-				case 25:
-				*funcName = "/F1b";
-				break;
-				case 16:
-				*funcName = "/F1c";
-				break;
-				case 7:
-				*funcName = "/F2a";
-				break;
-				case 21:
-				*funcName = "/F2b";
-				break;
-				case 31:
-				*funcName = "/F2c";
-				break;
-				case 11:
-				*funcName = "/F3a";
-				break;
-				case 13:
-				*funcName = "/F3b";
-				break;
-				case 9:
-				*funcName = "/F3c";
-				break;
-				case 24:
-				*funcName = "/F4a";
-				break;
-				case 10:
-				*funcName = "/F4b";
-				break;
-				case 20:
-				*funcName = "/F4c";
-				break;
-				case 4:
-				*funcName = "/F5a";
-				break;
-				case 15:
-				*funcName = "/F5b";
-				break;
-				case 36:
-				*funcName = "/F5c";
-				break;
-				default:
-				break;
-				}
-				switch (sRoute[2]) {
-				case 35:
-				*funcName += "/F1a";
-				break;
-				case 25:
-				*funcName += "/F1b";
-				break;
-				case 16:
-				*funcName += "/F1c";
-				break;
-				case 7:
-				*funcName += "/F2a";
-				break;
-				case 21:
-				*funcName += "/F2b";
-				break;
-				case 31:
-				*funcName += "/F2c";
-				break;
-				case 11:
-				*funcName += "/F3a";
-				break;
-				case 13:
-				*funcName += "/F3b";
-				break;
-				case 9:
-				*funcName += "/F3c";
-				break;
-				case 24:
-				*funcName += "/F4a";
-				break;
-				case 10:
-				*funcName += "/F4b";
-				break;
-				case 20:
-				*funcName += "/F4c";
-				break;
-				case 4:
-				*funcName += "/F5a";
-				break;
-				case 15:
-				*funcName += "/F5b";
-				break;
-				case 36:
-				*funcName += "/F5c";
-				break;
-				default:
-				break;
-				}
-				switch (sRoute[1]) {
-				case 35:
-				*funcName += "/F1a";
-				break;
-				case 25:
-				*funcName += "/F1b";
-				break;
-				case 16:
-				*funcName += "/F1c";
-				break;
-				case 7:
-				*funcName += "/F2a";
-				break;
-				case 21:
-				*funcName += "/F2b";
-				break;
-				case 31:
-				*funcName += "/F2c";
-				break;
-				case 11:
-				*funcName += "/F3a";
-				break;
-				case 13:
-				*funcName += "/F3b";
-				break;
-				case 9:
-				*funcName += "/F3c";
-				break;
-				case 24:
-				*funcName += "/F4a";
-				break;
-				case 10:
-				*funcName += "/F4b";
-				break;
-				case 20:
-				*funcName += "/F4c";
-				break;
-				case 4:
-				*funcName += "/F5a";
-				break;
-				case 15:
-				*funcName += "/F5b";
-				break;
-				case 36:
-				*funcName += "/F5c";
-				break;
-				default:
-				break;
+		{
+			if (m_producer == nullptr) {
+				m_producer = SfcPathPlanner::FindProducer(m_interestName);
+				NS_ASSERT_MSG(m_producer != nullptr, "No producer serves " << m_interestName);
 			}
-			// */ //Geant
-		increaseTotalHops(distance);
-
+			const SfcPathPlanner::Path& path =
+					SfcPathPlanner::Get()->GetPath(GetNode(), m_producer, functionType, weight);
+			*funcName = path.functionName;
+			increaseTotalHops(path.hops);
+		}
 		break;  // end siraiwaNDN
 		case 1: //roundRobin
 		{
-			uint32_t randNum1 = ::ndn::random::generateWord32() % 5 + 1;
-			uint32_t randNum2 = ::ndn::random::generateWord32() % 5 + 1;
-			uint32_t randNum3 = ::ndn::random::generateWord32() % 5 + 1;
-			while(randNum1 == randNum2){
-				randNum2 = ::ndn::random::generateWord32() % 5 + 1;
+			// distinct random functions, as many as in the chain
+			for(uint32_t function : drawDistinctFunctions(*m_catalog, *m_rand, chain.functions.size())){
+				*funcName += roundRobin(function);
 			}
-			while(randNum1 == randNum3 || randNum2 == randNum3){
-				randNum3 = ::ndn::random::generateWord32() % 5 + 1;
-			}
-			
-			
-			switch(randNum1){//firstType
-				case 1:
-				*funcName += roundRobin(1);
-				break;
-				case 2:
-				*funcName += roundRobin(2);
-				break;
-				case 3:
-				*funcName += roundRobin(3);
-				break;
-				case 4:
-				*funcName += roundRobin(4);
-				break;
-				case 5:
-				*funcName += roundRobin(5);
-				break;
-				default:
-				break;
-			}
-			switch(randNum2){//secondType
-				case 1:
-				*funcName += roundRobin(1);
-				break;
-				case 2:
-				*funcName += roundRobin(2);
-				break;
-				case 3:
-				*funcName += roundRobin(3);
-				break;
-				case 4:
-				*funcName += roundRobin(4);
-				break;
-				case 5:
-				*funcName += roundRobin(5);
-				break;
-				default:
-				break;
-			}
-			switch(randNum3){//ThirdType
-				case 1:
-				*funcName += roundRobin(1);
-				break;
-				case 2:
-				*funcName += roundRobin(2);
-				break;
-				case 3:
-				*funcName += roundRobin(3);
-				break;
-				case 4:
-				*funcName += roundRobin(4);
-				break;
-				case 5:
-				*funcName += roundRobin(5);
-				break;
-				default:
-				break;
-			}
-			// switch(functionType){// firstType
-			// case 1:
-			// case 2:
-			// case 5:
-			// case 6:
-			// 	*funcName += roundRobin(1);
-			// 	break;
-			// case 3:
-			// case 4:
-			// case 9:
-			// case 10:
-			// 	*funcName += roundRobin(2);
-			// 	break;
-			// case 7:
-			// case 8:
-			// case 11:
-			// case 12:
-			// 	*funcName += roundRobin(3);
-			// 	break;
-			// default:
-			// 	break;
-			// }
-			// switch(functionType){// secondType
-			// case 1:
-			// case 2:
-			// case 11:
-			// case 12:
-			// 	*funcName += roundRobin(2);
-			// 	break;
-			// case 3:
-			// case 4:
-			// case 7:
-			// case 8:
-			// 	*funcName += roundRobin(1);
-			// 	break;
-			// case 5:
-			// case 6:
-			// case 9:
-			// case 10:
-			// 	*funcName += roundRobin(3);
-			// 	break;
-			// default:
-			// 	break;
-			// }
-			// switch(functionType){// thirdType
-			// case 1:
-			// case 3:
-			// case 5:
-			// case 7:
-			// case 9:
-			// case 11:
-			// 	*funcName += roundRobin(4);
-			// 	break;
-			// case 2:
-			// case 4:
-			// case 6:
-			// case 8:
-			// case 10:
-			// case 12:
-			// 	*funcName += roundRobin(5);
-			// 	break;
-			// default:
-			// 	break;
-			// }
 		}
 		break;//end roundRobin
 		case 2://duration
 		{
-			switch(functionType){
-			case 1:
-				funcName = duration(1,2,4);
-				break;
-			case 2:
-				funcName = duration(1,2,5);
-				break;
-			case 5:
-				funcName = duration(1,3,4);
-				break;
-			case 6:
-				funcName = duration(1,3,5);
-				break;
-			case 3:
-				funcName = duration(2,1,4);
-				break;
-			case 4:
-				funcName = duration(2,1,5);
-				break;
-			case 9:
-				funcName = duration(2,3,4);
-				break;
-			case 10:
-				funcName = duration(2,3,5);
-				break;
-			case 7:
-				funcName = duration(3,1,4);
-				break;
-			case 8:
-				funcName = duration(3,1,5);
-				break;
-			case 11:
-				funcName = duration(3,2,4);
-				break;
-			case 12:
-				funcName = duration(3,2,5);
-				break;
-			default:
-				break;
-			}
+			funcName = duration(chain);
 		}
 
 		break;//end duration
 
 		case 3:
 		{
-			uint32_t randNum1 = ::ndn::random::generateWord32() % 5 + 1;
-			uint32_t randNum2 = ::ndn::random::generateWord32() % 5 + 1;
-			uint32_t randNum3 = ::ndn::random::generateWord32() % 5 + 1;
-			while(randNum1 == randNum2){
-				randNum2 = ::ndn::random::generateWord32() % 5 + 1;
-			}
-			while(randNum1 == randNum3 || randNum2 == randNum3){
-				randNum3 = ::ndn::random::generateWord32() % 5 + 1;
-			}
-
-			switch(randNum1){//firstType
-				case 1:
-				*funcName += randChoice(1);
-				break;
-				case 2:
-				*funcName += randChoice(2);
-				break;
-				case 3:
-				*funcName += randChoice(3);
-				break;
-				case 4:
-				*funcName += randChoice(4);
-				break;
-				case 5:
-				*funcName += randChoice(5);
-				break;
-				default:
-				break;
+			for(uint32_t function : drawDistinctFunctions(*m_catalog, *m_rand, chain.functions.size())){
+				*funcName += randChoice(function);
 			}
-			switch(randNum2){//firstType
-				case 1:
-				*funcName += randChoice(1);
-				break;
-				case 2:
-				*funcName += randChoice(2);
-				break;
-				case 3:
-				*funcName += randChoice(3);
-				break;
-				case 4:
-				*funcName += randChoice(4);
-				break;
-				case 5:
-				*funcName += randChoice(5);
-				break;
-				default:
-				break;
-			}
-			switch(randNum3){//firstType
-				case 1:
-				*funcName += randChoice(1);
-				break;
-				case 2:
-				*funcName += randChoice(2);
-				break;
-				case 3:
-				*funcName += randChoice(3);
-				break;
-				case 4:
-				*funcName += randChoice(4);
-				break;
-				case 5:
-				*funcName += randChoice(5);
-				break;
-				default:
-				break;
-			}
-			// switch(functionType){// firstType
-			// case 1:
-			// case 2:
-			// case 5:
-			// case 6:
-			// 	*funcName += randChoice(1);
-			// 	break;
-			// case 3:
-			// case 4:
-			// case 9:
-			// case 10:
-			// 	*funcName += randChoice(2);
-			// 	break;
-			// case 7:
-			// case 8:
-			// case 11:
-			// case 12:
-			// 	*funcName += randChoice(3);
-			// 	break;
-			// default:
-			// 	break;
-			// }
-			// switch(functionType){// secondType
-			// case 1:
-			// case 2:
-			// case 11:
-			// case 12:
-			// 	*funcName += randChoice(2);
-			// 	break;
-			// case 3:
-			// case 4:
-			// case 7:
-			// case 8:
-			// 	*funcName += randChoice(1);
-			// 	break;
-			// case 5:
-			// case 6:
-			// case 9:
-			// case 10:
-			// 	*funcName += randChoice(3);
-			// 	break;
-			// default:
-			// 	break;
-			// }
-			// switch(functionType){// thirdType
-			// case 1:
-			// case 3:
-			// case 5:
-			// case 7:
-			// case 9:
-			// case 11:
-			// 	*funcName += randChoice(4);
-			// 	break;
-			// case 2:
-			// case 4:
-			// case 6:
-			// case 8:
-			// case 10:
-			// case 12:
-			// 	*funcName += randChoice(5);
-			// 	break;
-			// default:
-			// 	break;
-			// }
 		}
 		break;//end randChoice
 		case 4:
 		{
-			switch(functionType){
-			case 1:
-				funcName = fibControl(1,2,4);
-				break;
-			case 2:
-				funcName = fibControl(1,2,5);
-				break;
-			case 5:
-				funcName = fibControl(1,3,4);
-				break;
-			case 6:
-				funcName = fibControl(1,3,5);
-				break;
-			case 3:
-				funcName = fibControl(2,1,4);
-				break;
-			case 4:
-				funcName = fibControl(2,1,5);
-				break;
-			case 9:
-				funcName = fibControl(2,3,4);
-				break;
-			case 10:
-				funcName = fibControl(2,3,5);
-				break;
-			case 7:
-				funcName = fibControl(3,1,4);
-				break;
-			case 8:
-				funcName = fibControl(3,1,5);
-				break;
-			case 11:
-				funcName = fibControl(3,2,4);
-				break;
-			case 12:
-				funcName = fibControl(3,2,5);
-				break;
-			default:
-				break;
-			}
+			funcName = fibControl(chain);
 		}
 		break;
 		default:
@@ -6749,18 +365,14 @@ Consumer::SendPacket()
 	ns3::increaseTotalSend();
 	//
 
-	//choose Function Type from 1 to 6
-	uint32_t functionType = ::ndn::random::generateWord32() % 12 + 1;
+	//choose Function Type from the request mix of the catalog
+	uint32_t functionType = m_catalog->DrawChainType(drawWord());
 
-	int currentNode = ns3::Simulator::GetContext();
-	//std::cout << "Consumer Node: " <<  currentNode << std::endl;
 	//std::cout << "function type:"  <<  functionType << std::endl;
 
-	//dijkstra
-	int sRoute[N];
 	//need to change
 	double weight = ns3::getWeight();
-	shared_ptr<Name> functionName = sourceRouting(functionType, currentNode, sRoute, weight);
+	shared_ptr<Name> functionName = sourceRouting(functionType, weight);
 
 	/* for gid
   std::cout << "AllFC: " << getAllFcc() << std::endl;
@@ -6873,26 +485,7 @@ Consumer::SendPacket()
 	interest->setNonce(m_rand->GetValue(0, std::numeric_limits<uint32_t>::max()));
 	interest->setName(*nameWithSequence);
 	interest->setFunction(*functionName);
-	if(getChoiceType() == 2){
-		std::string headFunc = functionName->toUri();
-		int pos = headFunc.find("/",1);
-		headFunc.erase(pos, headFunc.size()-1);
-		Name headFuncName(headFunc);
-		shared_ptr<Name> headFuncNamePtr = make_shared<Name>(headFuncName);
-		interest->setFunctionFullName(*headFuncNamePtr);
-	}
-	if(getChoiceType() == 4){
-		// std::string headFunc = functionName->toUri();
-		// int pos = headFunc.find("/",1);
-		// headFunc.erase(pos, headFunc.size()-1);
-		// Name headFuncName(headFunc);
-		// shared_ptr<Name> headFuncNamePtr = make_shared<Name>(headFuncName);
-		// interest->setFunctionFullName(*headFuncNamePtr);
-		// std::string FibCon = "";
-		// Name FibConName(FibCon);
-		// shared_ptr<Name> FibConNamePtr = make_shared<Name>(FibConName);
-		// interest->setFunctionFullName(*FibConNamePtr);
-	}
+	GetSfcSelectionPolicy().beforeExpressInterest(*interest);
 
 	time::milliseconds interestLifeTime(m_interestLifeTime.GetMilliSeconds());
 	//time::milliseconds interestLifeTime(1000);
@@ -6904,6 +497,7 @@ Consumer::SendPacket()
 	// NS_LOG_INFO ("Requesting Interest: \n" << *interest);
 	NS_LOG_INFO("> Interest for " << seq);
 
+	m_latencyRecorder.OnSend(seq, functionType);
 	WillSendOutInterest(seq);
 
 	m_transmittedInterests(interest, this, m_face);
@@ -6934,6 +528,7 @@ Consumer::OnData(shared_ptr<const Data> data)
 	uint32_t seq = data->getName().at(-1).toSequenceNumber();
 	NS_LOG_INFO("< DATA for " << seq);
 	ns3::increaseServiceNum();
+	m_latencyRecorder.OnData(seq);
 	//std::cout << "Service Num: " << ns3::getServiceNum() << std::endl;
 
 	//added 2019/11/12
@@ -6942,35 +537,12 @@ Consumer::OnData(shared_ptr<const Data> data)
 			Name PreviousFuncName = *(data->getTag<lp::FunctionNameTag>());
 			std::string PFuncName = PreviousFuncName.toUri();
 
-			if(PFuncName.compare("/F1a") == 0){
-				table[0][1][0] = *(data->getTag<lp::PartialHopTag>());
-				table[1][1][0] = *(data->getTag<lp::CountTag>());
-			}else if(PFuncName.compare("/F1b") == 0){
-				table[0][1][1] = *(data->getTag<lp::PartialHopTag>());
-				table[1][1][1] = *(data->getTag<lp::CountTag>());
-			}else if(PFuncName.compare("/F1c") == 0){
-				table[0][1][2] = *(data->getTag<lp::PartialHopTag>());
-				table[1][1][2] = *(data->getTag<lp::CountTag>());
-			}else if(PFuncName.compare("/F2a") == 0){
-				table[0][2][0] = *(data->getTag<lp::PartialHopTag>());
-				table[1][2][0] = *(data->getTag<lp::CountTag>());
-			}else if(PFuncName.compare("/F2b") == 0){
-				table[0][2][1] = *(data->getTag<lp::PartialHopTag>());
-				table[1][2][1] = *(data->getTag<lp::CountTag>());
-			}else if(PFuncName.compare("/F2c") == 0){
-				table[0][2][2] = *(data->getTag<lp::PartialHopTag>());
-				table[1][2][2] = *(data->getTag<lp::CountTag>());
-			}else if(PFuncName.compare("/F3a") == 0){
-				table[0][3][0] = *(data->getTag<lp::PartialHopTag>());
-				table[1][3][0] = *(data->getTag<lp::CountTag>());
-			}else if(PFuncName.compare("/F3b") == 0){
-				table[0][3][1] = *(data->getTag<lp::PartialHopTag>());
-				table[1][3][1] = *(data->getTag<lp::CountTag>());
-			}else if(PFuncName.compare("/F3c") == 0){
-				table[0][3][2] = *(data->getTag<lp::PartialHopTag>());
-				table[1][3][2] = *(data->getTag<lp::CountTag>());
-			}else {
-
+			uint32_t function = 0;
+			uint32_t instance = 0;
+			if(m_catalog->FindInstance(PFuncName, function, instance)){
+				uint32_t counterIndex = m_catalog->GetFunction(function).firstCounterIndex + instance;
+				getTableEntry(0, counterIndex) = *(data->getTag<lp::PartialHopTag>());
+				getTableEntry(1, counterIndex) = *(data->getTag<lp::CountTag>());
 			}
 		}
 	}
@@ -7042,7 +614,7 @@ Consumer::OnData(shared_ptr<const Data> data)
 
 
 	int totalFcc = 0;
-	for(int i = 1; i < 16; i++){
+	for(uint32_t i = 1; i <= m_catalog->GetInstanceCount(); i++){
 		totalFcc += getTotalFcc(i);
 	}
 	//std::cout << "TotalFcc: " << totalFcc << std::endl;
@@ -30,6 +30,8 @@
 
 #include "ns3/ndnSIM/model/ndn-common.hpp"
 #include "ns3/ndnSIM/utils/ndn-rtt-estimator.hpp"
+#include "ns3/ndnSIM/utils/ndn-sfc-catalog.hpp"
+#include "ns3/ndnSIM/utils/ndn-sfc-latency-recorder.hpp"
 
 #include <set>
 #include <map>
@@ -39,8 +41,6 @@
 #include <boost/multi_index/ordered_index.hpp>
 #include <boost/multi_index/member.hpp>
 
-#define N 39//us24=26,sinet,Geant=39
-
 namespace ns3 {
 namespace ndn {
 
@@ -95,6 +95,12 @@ public:
   virtual void
   WillSendOutInterest(uint32_t sequenceNumber);
 
+  /**
+   * \brief Returns the service latencies of the chains requested so far, in simulated time
+   */
+  const SfcLatencyRecorder&
+  GetLatencyRecorder() const;
+
 public:
   typedef void (*LastRetransmittedInterestDataDelayCallback)(Ptr<App> app, uint32_t seqno, Time delay, int32_t hopCount);
   typedef void (*FirstInterestDataDelayCallback)(Ptr<App> app, uint32_t seqno, Time delay, uint32_t retxCount, int32_t hopCount);
@@ -128,26 +134,36 @@ protected:
   void
   SetRetxTimer(Time retxTimer);
 
-  double
-  dijkstra(int sp, int dp, int sRoute[N], int functionType, int consumerNode, double weight, int flag);
-
+  /**
+   * \brief Select the next instance of function \p func in turn
+   * \param func index of the function in SfcCatalog
+   * \return the selected instance, e.g. "/F1a"
+   */
   std::string
-  roundRobin(int func);
+  roundRobin(uint32_t func);
 
+  /**
+   * \brief Select the instance of function \p fn with the smallest hop count plus call count
+   * \return index of the selected instance
+   */
   int
-  funcJudge(int fn);
+  funcJudge(uint32_t fn);
 
   shared_ptr<std::string>
-  duration(int f1, int f2, int f3);
+  duration(const SfcCatalog::Chain& chain);
 
   std::string
-  randChoice(int func);
+  randChoice(uint32_t func);
 
   shared_ptr<std::string>
-  fibControl(int f1, int f2, int f3);
+  fibControl(const SfcCatalog::Chain& chain);
 
+  /**
+   * \brief Select an instance of each function of chain type \p functionType of SfcCatalog
+   * \return the selected instances, e.g. "/F1a/F2b/F4c"
+   */
   shared_ptr<Name>
-  sourceRouting(uint32_t functionType, int currentNode, int* sRoute, double weight);
+  sourceRouting(uint32_t functionType, double weight);
 
   /**
    * \brief Returns the frequency of checking the retransmission timeouts
@@ -156,6 +172,19 @@ protected:
   Time
   GetRetxTimer() const;
 
+protected:
+  /**
+   * \brief Get the hop count (\p kind 0) or call count (\p kind 1) of instance \p counterIndex
+   */
+  int&
+  getTableEntry(int kind, uint32_t counterIndex);
+
+  /**
+   * \brief Draw a uniformly distributed 32-bit value from m_rand, so that runs follow RngSeed
+   */
+  uint32_t
+  drawWord();
+
 protected:
   Ptr<UniformRandomVariable> m_rand; ///< @brief nonce generator
 
@@ -170,7 +199,10 @@ protected:
   Time m_offTime;          ///< \brief Time interval between packets
   Name m_interestName;     ///< \brief NDN Name of the Interest (use Name)
   Time m_interestLifeTime; ///< \brief LifeTime for interest packet
-  int table[2][6][3];
+  Ptr<Node> m_producer;    ///< \brief Node of the producer of m_interestName, for source routing
+  Ptr<SfcCatalog> m_catalog; ///< \brief SFC catalog of the simulation, set when the app starts
+  std::vector<int> table[2]; ///< \brief hop count (0) and call count (1), by instance number - 1
+  SfcLatencyRecorder m_latencyRecorder; ///< \brief Service latencies, by chain type
 
   /// @cond include_hidden
   /**
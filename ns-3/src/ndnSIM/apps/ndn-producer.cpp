@@ -26,6 +26,7 @@
 
 #include "model/ndn-l3-protocol.hpp"
 #include "helper/ndn-fib-helper.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/sfc-selection-policy.hpp"
 
 #include <memory>
 #include <ndn-cxx/lp/tags.hpp>
@@ -112,40 +113,18 @@ Producer::OnInterest(shared_ptr<const Interest> interest)
 
   auto data = make_shared<Data>();
   data->setName(dataName);
-  if(getChoiceType() == 2){
-	  Name funcName(interest->getFunctionFullName());
-	  auto string = funcName.toUri();
-	  //std::cout << "string:" << string << std::endl;
-
-	  data->setTag<lp::FunctionNameTag>(make_shared<lp::FunctionNameTag>(funcName));
-	  data->setTag<lp::PartialHopTag>(nullptr);
-	  data->setTag<lp::CountTag>(nullptr);
-	  data->setTag<lp::PreviousFunctionTag>(make_shared<lp::PreviousFunctionTag>(Name("")));
-	  shared_ptr<lp::PartialHopTag> partialHopTag = data->getTag<lp::PartialHopTag>();
-  }else if(getChoiceType() == 4){
-
-    Name funcName(interest->getFunctionFullName());
-	  auto string = funcName.toUri();
-	  //std::cout << "string:" << string << std::endl;
-
-    //data->setFunction(funcName);
-
-	  data->setTag<lp::FunctionNameTag>(nullptr);
-	  data->setTag<lp::PartialHopTag>(nullptr);
-	  data->setTag<lp::CountTag>(nullptr);
-	  /*
-	  data->setTag<lp::PartialHopTag>(make_shared<lp::PartialHopTag>(0));
-	  data->setTag<lp::CountTag>(make_shared<lp::CountTag>(0));
-	  shared_ptr<lp::PartialHopTag> partialHopTag = data->getTag<lp::PartialHopTag>();
-	  */
-	  //std::cout << "FuncNameTag: " << *(data->getTag<lp::FunctionNameTag>()) << ",the type name is "<< typeid(*(data->getTag<lp::FunctionNameTag>())).name() <<"PartialHopTag: "<< *(data->getTag<lp::PartialHopTag>()) << ", typeName is " << typeid(*(partialHopTag)).name() << ",CountTag: " << *(data->getTag<lp::CountTag>())<< std::endl;
-  }
+  GetSfcSelectionPolicy().beforeSendData(*interest, *data);
   data->setFreshnessPeriod(::ndn::time::milliseconds(m_freshness.GetMilliSeconds()));
   //std::cout << "Interest servicetime: " << interest->getServiceTime().count() << std::endl;
   data->setServiceTime(interest->getServiceTime());
    //std::cout << "Producer servicetime: " << data->getServiceTime().count() << std::endl;
 
-  data->setContent(make_shared< ::ndn::Buffer>(m_virtualPayloadSize));
+  if (m_content.empty() || m_content.value_size() != m_virtualPayloadSize) {
+    m_content = Block(::ndn::tlv::Content, make_shared< ::ndn::Buffer>(m_virtualPayloadSize));
+    m_content.encode();
+  }
+  // the encoded payload is copied only into the wire encoding of data
+  data->setContent(m_content);
 
 
   Signature signature;
@@ -64,6 +64,7 @@ private:
   Name m_postfix;
   uint32_t m_virtualPayloadSize;
   Time m_freshness;
+  Block m_content; ///< encoded Content of m_virtualPayloadSize bytes, shared by all Data
 
   uint32_t m_signature;
   Name m_keyLocator;
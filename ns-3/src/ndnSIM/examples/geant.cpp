@@ -162,6 +162,9 @@ main(int argc, char* argv[])
 	ndn::GlobalRoutingHelper ndnGlobalRoutingHelper;
 	ndnGlobalRoutingHelper.InstallAll();
 
+	// Function instances are hosted on the nodes named after them (F1a, F1b, ...)
+	ndn::FunctionHelper::InstallByNodeName({"F1", "F2", "F3", "F4", "F5"}, 'c');
+
 	//Consumer1
 	ndn::FibHelper::AddRoute(Names::Find<Node>("Consumer1"), "/F1a", Names::Find<Node>("Node1"), 0);
 	ndn::FibHelper::AddRoute(Names::Find<Node>("Consumer1"), "/F1b", Names::Find<Node>("Node1"), 0);
@@ -1192,9 +1195,11 @@ main(int argc, char* argv[])
 		writing_file << ns3::getTotalFcc(i) << std::endl;
 	ns3::printResult();
 
+	// Service latency percentiles per chain type, in simulated time
+	ndn::SfcLatencyRecorder latency = ndn::SfcLatencyRecorder::Collect();
+	std::cout << latency;
 	writing_file << "" << std::endl;
-	writing_file << ns3::getAverageServiceTime() << std::endl;
-	writing_file << ns3::getServiceNum() << std::endl;
+	writing_file << latency;
 	Simulator::Destroy();
 
 	return 0;
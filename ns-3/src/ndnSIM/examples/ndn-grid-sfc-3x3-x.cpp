@@ -73,6 +73,9 @@ main(int argc, char* argv[])
   ndn::GlobalRoutingHelper ndnGlobalRoutingHelper;
   ndnGlobalRoutingHelper.InstallAll();
 
+  // Function instances are hosted on the nodes named after them (F1a, F1b, ...)
+  ndn::FunctionHelper::InstallByNodeName({"F1", "F2", "F3"}, 'c');
+
 
   //FIB
   //Consumer
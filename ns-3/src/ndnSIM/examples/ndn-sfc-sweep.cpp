@@ -0,0 +1,182 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-sfc-sweep.cpp
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/ndnSIM-module.h"
+
+namespace ns3 {
+
+/**
+ * This scenario runs the GEANT SFC scenario (see geant.cpp) over a grid of selection
+ * policies, consumer frequencies and content store sizes.
+ *
+ * The topology is read once.  Every cell of the grid then runs in its own worker process,
+ * and all results are written to one tab-separated file, one row per cell.
+ *
+ * Routes toward the function instances are computed by NdnGlobalRoutingHelper instead of
+ * the hand-written FIB of geant.cpp.
+ *
+ * To run the whole sweep on all cores, use the following command:
+ *
+ *     ./waf --run="ndn-sfc-sweep --frequencies=50,100,200 --output=sweep-geant.tsv"
+ */
+
+static std::vector<std::string>
+splitList(const std::string& list)
+{
+  std::vector<std::string> items;
+  std::istringstream is(list);
+  std::string item;
+  while (std::getline(is, item, ',')) {
+    if (!item.empty()) {
+      items.push_back(item);
+    }
+  }
+  return items;
+}
+
+static void
+installScenario(const ndn::SfcSweepHelper::Cell& cell)
+{
+  NodeContainer endpoints;
+  NodeContainer routers;
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); ++node) {
+    std::string name = Names::FindName(*node);
+    if (name.compare(0, 4, "Node") == 0) {
+      routers.Add(*node);
+    }
+    else {
+      endpoints.Add(*node);
+    }
+  }
+
+  // Content stores on routers only
+  ndn::StackHelper routerHelper;
+  if (cell.csSize == 0) {
+    routerHelper.SetOldContentStore("ns3::ndn::cs::Nocache");
+  }
+  else {
+    routerHelper.SetOldContentStore("ns3::ndn::cs::Lru", "MaxSize", std::to_string(cell.csSize));
+  }
+  routerHelper.Install(routers);
+
+  ndn::StackHelper endpointHelper;
+  endpointHelper.SetOldContentStore("ns3::ndn::cs::Nocache");
+  endpointHelper.Install(endpoints);
+
+  ndn::GlobalRoutingHelper ndnGlobalRoutingHelper;
+  ndnGlobalRoutingHelper.InstallAll();
+
+  // Function instances are hosted on the nodes named after them (F1a, F1b, ...)
+  ndn::FunctionHelper::InstallByNodeName({"F1", "F2", "F3", "F4", "F5"}, 'c');
+  for (const std::string& function : {"F1", "F2", "F3", "F4", "F5"}) {
+    for (char instance = 'a'; instance <= 'c'; ++instance) {
+      std::string name = function + instance;
+      ndnGlobalRoutingHelper.AddOrigins("/" + name, Names::Find<Node>(name));
+    }
+  }
+
+  // Consumer i requests prefix (i + 1) % 4 + 1 from producer (i + 1) % 4 + 1, as in geant.cpp
+  ndn::AppHelper consumerHelper("ns3::ndn::ConsumerZipfMandelbrot");
+  consumerHelper.SetAttribute("Frequency", StringValue(cell.frequency));
+  consumerHelper.SetAttribute("NumberOfContents", StringValue("30"));
+
+  ndn::AppHelper producerHelper("ns3::ndn::Producer");
+  producerHelper.SetAttribute("PayloadSize", StringValue("1200"));
+
+  const double startTimes[] = {0, 0.02, 0.03, 0.04};
+  for (int i = 1; i <= 4; ++i) {
+    std::string prefix = "/prefix" + std::to_string((i + 1) % 4 + 1);
+    ndn::StrategyChoiceHelper::InstallAll(prefix, "/localhost/nfd/strategy/best-route/%FD%01");
+
+    consumerHelper.SetPrefix(prefix);
+    ApplicationContainer app = consumerHelper.Install(Names::Find<Node>("Consumer" + std::to_string(i)));
+    app.Start(Seconds(startTimes[i - 1]));
+
+    Ptr<Node> producer = Names::Find<Node>("Producer" + std::to_string((i + 1) % 4 + 1));
+    producerHelper.SetPrefix(prefix);
+    producerHelper.Install(producer);
+    ndnGlobalRoutingHelper.AddOrigins(prefix, producer);
+  }
+
+  ndn::GlobalRoutingHelper::CalculateRoutes();
+}
+
+int
+main(int argc, char* argv[])
+{
+  std::string policies = "siraiwaNDN,roundRobin,duration,randChoice,fibControl";
+  std::string frequencies = "100";
+  std::string csSizes = "0,100";
+  std::string seeds = "1";
+  std::string output = "sweep-geant.tsv";
+  int weight = 1;
+  uint32_t nWorkers = 0;
+  double stopTime = 200.0;
+
+  CommandLine cmd;
+  cmd.AddValue("policies", "comma-separated selection policies", policies);
+  cmd.AddValue("frequencies", "comma-separated consumer frequencies", frequencies);
+  cmd.AddValue("csSizes", "comma-separated router content store sizes, 0 for no cache", csSizes);
+  cmd.AddValue("seeds", "comma-separated random seeds", seeds);
+  cmd.AddValue("weight", "weight of the function call counts", weight);
+  cmd.AddValue("workers", "number of cells running at the same time, 0 for all cores", nWorkers);
+  cmd.AddValue("stop", "simulated seconds per cell", stopTime);
+  cmd.AddValue("output", "results file", output);
+  cmd.Parse(argc, argv);
+
+  ndn::SfcSweepHelper sweep;
+  for (const std::string& policy : splitList(policies)) {
+    sweep.AddPolicy(policy);
+  }
+  for (const std::string& frequency : splitList(frequencies)) {
+    sweep.AddFrequency(frequency);
+  }
+  for (const std::string& csSize : splitList(csSizes)) {
+    sweep.AddCsSize(std::stoul(csSize));
+  }
+  for (const std::string& seed : splitList(seeds)) {
+    sweep.AddSeed(std::stoul(seed));
+  }
+  sweep.AddWeight(weight);
+  if (nWorkers > 0) {
+    sweep.SetWorkerCount(nWorkers);
+  }
+  sweep.SetStopTime(Seconds(stopTime));
+
+  sweep.SetTopology([] {
+    AnnotatedTopologyReader topologyReader("", 38);
+    topologyReader.SetFileName("src/ndnSIM/examples/topologies/geant.txt");
+    topologyReader.Read();
+  });
+
+  sweep.Run(&installScenario, output);
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+  return ns3::main(argc, argv);
+}
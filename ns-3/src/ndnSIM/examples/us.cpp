@@ -76,6 +76,9 @@ main(int argc, char* argv[])
   ndn::GlobalRoutingHelper ndnGlobalRoutingHelper;
   ndnGlobalRoutingHelper.InstallAll();
 
+  // Function instances are hosted on the nodes named after them (F1a, F1b, ...)
+  ndn::FunctionHelper::InstallByNodeName({"F1", "F2", "F3", "F4", "F5"}, 'c');
+
 
   //Consumer1
   ndn::FibHelper::AddRoute(Names::Find<Node>("Consumer1"), "/F1a", Names::Find<Node>("Node1"), 0);
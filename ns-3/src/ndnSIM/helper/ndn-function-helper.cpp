@@ -0,0 +1,86 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-function-helper.hpp"
+
+#include "ns3/log.h"
+#include "ns3/names.h"
+
+#include "model/ndn-l3-protocol.hpp"
+#include "model/ndn-function-processor.hpp"
+#include "utils/ndn-sfc-catalog.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/forwarder.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+NS_LOG_COMPONENT_DEFINE("ndn.FunctionHelper");
+
+void
+FunctionHelper::Install(Ptr<Node> node, const std::string& function, char instance)
+{
+  Ptr<L3Protocol> l3Protocol = node->GetObject<L3Protocol>();
+  NS_ASSERT_MSG(l3Protocol != nullptr, "NDN stack should be installed on the node");
+  NS_ASSERT(l3Protocol->getForwarder() != nullptr);
+
+  NS_LOG_DEBUG("Node ID: " << node->GetId() << " hosts " << function << instance);
+  l3Protocol->getForwarder()->getFunctionInstanceRegistry().insert(function, instance);
+
+  if (node->GetObject<FunctionProcessor>() == nullptr) {
+    Ptr<FunctionProcessor> processor = CreateObject<FunctionProcessor>();
+    node->AggregateObject(processor);
+    l3Protocol->getForwarder()->setFunctionProcessor(processor);
+  }
+}
+
+void
+FunctionHelper::Install(const NodeContainer& c, const std::string& function, char instance)
+{
+  for (NodeContainer::Iterator i = c.Begin(); i != c.End(); ++i) {
+    Install(*i, function, instance);
+  }
+}
+
+void
+FunctionHelper::InstallByNodeName(const std::vector<std::string>& functions, char lastInstance)
+{
+  for (const std::string& function : functions) {
+    for (char instance = 'a'; instance <= lastInstance; ++instance) {
+      Ptr<Node> node = Names::Find<Node>(function + instance);
+      if (node == nullptr) {
+        NS_LOG_DEBUG("No node for " << function << instance);
+        continue;
+      }
+      Install(node, function, instance);
+    }
+  }
+}
+
+void
+FunctionHelper::InstallByNodeName()
+{
+  Ptr<SfcCatalog> catalog = SfcCatalog::Get();
+  for (uint32_t i = 0; i < catalog->GetNFunctions(); ++i) {
+    const SfcCatalog::Function& function = catalog->GetFunction(i);
+    InstallByNodeName({function.name}, 'a' + function.instances.size() - 1);
+  }
+}
+
+} // namespace ndn
+} // namespace ns3
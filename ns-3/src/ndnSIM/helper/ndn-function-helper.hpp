@@ -0,0 +1,91 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDNSIM_HELPER_NDN_FUNCTION_HELPER_HPP
+#define NDNSIM_HELPER_NDN_FUNCTION_HELPER_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ns3/node.h"
+#include "ns3/ptr.h"
+#include "ns3/node-container.h"
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-helpers
+ * @brief Helper to place service function instances on nodes
+ *
+ * A node hosting an instance processes Interests whose head function is that instance
+ * (or the function itself, when the FIB selects the instance).  Installed instances are
+ * kept in the FunctionInstanceRegistry of the node's forwarder, so scenarios no longer
+ * depend on node IDs.
+ *
+ * The first instance installed on a node also aggregates a FunctionProcessor to the node,
+ * which models the processing time, workers and queue of the node's instances.  Its
+ * attributes can be changed on the node afterwards, or for all nodes with Config::SetDefault.
+ *
+ * Example:
+ * @code
+ * ndn::FunctionHelper::Install(Names::Find<Node>("F1a"), "F1", 'a');
+ * Names::Find<Node>("F1a")->GetObject<ndn::FunctionProcessor>()
+ *   ->SetAttribute("Workers", UintegerValue(4));
+ * @endcode
+ */
+class FunctionHelper
+{
+public:
+  /**
+   * @brief Host instance @p instance of function @p function (e.g. "F1" and 'a') on @p node
+   *
+   * NDN stack must be installed on @p node.
+   */
+  static void
+  Install(Ptr<Node> node, const std::string& function, char instance);
+
+  /**
+   * @brief Host instance @p instance of function @p function on nodes in @p c container
+   */
+  static void
+  Install(const NodeContainer& c, const std::string& function, char instance);
+
+  /**
+   * @brief Host each instance on the node named after it
+   *
+   * For every function in @p functions and every instance from 'a' to @p lastInstance,
+   * the instance is installed on the node registered in ns3::Names as function name
+   * followed by the instance letter (e.g., "F1a").  Instances without such node are skipped.
+   */
+  static void
+  InstallByNodeName(const std::vector<std::string>& functions, char lastInstance);
+
+  /**
+   * @brief Host each instance of SfcCatalog on the node named after it
+   *
+   * The catalog should be loaded (see SfcCatalog::LoadFile) before the instances are installed.
+   */
+  static void
+  InstallByNodeName();
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDNSIM_HELPER_NDN_FUNCTION_HELPER_HPP
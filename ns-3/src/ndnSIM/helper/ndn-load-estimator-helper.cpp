@@ -0,0 +1,99 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-load-estimator-helper.hpp"
+
+#include "ns3/log.h"
+
+#include "model/ndn-l3-protocol.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/forwarder.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+NS_LOG_COMPONENT_DEFINE("ndn.LoadEstimatorHelper");
+
+LoadEstimatorHelper::LoadEstimatorHelper()
+{
+  SetEwma(MilliSeconds(50));
+}
+
+void
+LoadEstimatorHelper::SetEwma(Time timeConstant)
+{
+  if (!timeConstant.IsStrictlyPositive()) {
+    NS_FATAL_ERROR("Time constant of the load estimator must be positive");
+  }
+
+  time::nanoseconds tau(timeConstant.GetNanoSeconds());
+  m_makeLoadEstimator = [tau] { return make_unique<nfd::fib::EwmaLoadEstimator>(tau); };
+}
+
+void
+LoadEstimatorHelper::SetSlidingWindow(Time window, uint32_t nBuckets)
+{
+  if (nBuckets == 0 || window.GetNanoSeconds() < nBuckets) {
+    NS_FATAL_ERROR("Window of the load estimator must hold at least one nanosecond per bucket");
+  }
+
+  time::nanoseconds length(window.GetNanoSeconds());
+  m_makeLoadEstimator = [length, nBuckets] {
+    return make_unique<nfd::fib::SlidingWindowLoadEstimator>(length, nBuckets);
+  };
+}
+
+void
+LoadEstimatorHelper::SetTokenBucket(double rate)
+{
+  if (rate <= 0) {
+    NS_FATAL_ERROR("Rate of the load estimator must be positive");
+  }
+
+  m_makeLoadEstimator = [rate] { return make_unique<nfd::fib::TokenBucketLoadEstimator>(rate); };
+}
+
+void
+LoadEstimatorHelper::Install(Ptr<Node> node) const
+{
+  Ptr<L3Protocol> l3Protocol = node->GetObject<L3Protocol>();
+  NS_ASSERT_MSG(l3Protocol != nullptr, "NDN stack should be installed on the node");
+
+  shared_ptr<nfd::Forwarder> forwarder = l3Protocol->getForwarder();
+  NS_ASSERT(forwarder != nullptr);
+
+  NS_LOG_DEBUG("Node ID: " << node->GetId() << " gets a new load estimator");
+  forwarder->getFib().setLoadEstimator(m_makeLoadEstimator());
+}
+
+void
+LoadEstimatorHelper::Install(const NodeContainer& c) const
+{
+  for (NodeContainer::Iterator i = c.Begin(); i != c.End(); ++i) {
+    Install(*i);
+  }
+}
+
+void
+LoadEstimatorHelper::InstallAll() const
+{
+  Install(NodeContainer::GetGlobal());
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,105 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDNSIM_HELPER_NDN_LOAD_ESTIMATOR_HELPER_HPP
+#define NDNSIM_HELPER_NDN_LOAD_ESTIMATOR_HELPER_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+#include "ns3/ndnSIM/NFD/daemon/table/fib-load-estimator.hpp"
+
+#include "ns3/node.h"
+#include "ns3/ptr.h"
+#include "ns3/node-container.h"
+#include "ns3/nstime.h"
+
+#include <functional>
+#include <memory>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-helpers
+ * @brief Helper to select how the function call load of nodes is estimated
+ *
+ * The load is reported by the "fib-control" policy in the call count of Data, and counts the
+ * calls of the local instance in the "duration" policy.  Every node starts with an exponentially
+ * decayed count with a time constant of 50 ms; the helper replaces it per node.
+ *
+ * Example:
+ * @code
+ * ndn::LoadEstimatorHelper loadHelper;
+ * loadHelper.SetSlidingWindow(MilliSeconds(50), 10);
+ * loadHelper.InstallAll();
+ * @endcode
+ */
+class LoadEstimatorHelper
+{
+public:
+  /**
+   * @brief Create a helper installing an exponentially decayed count with a 50 ms time constant
+   */
+  LoadEstimatorHelper();
+
+  /**
+   * @brief Estimate the load as a call count decayed with time constant @p timeConstant
+   */
+  void
+  SetEwma(Time timeConstant);
+
+  /**
+   * @brief Estimate the load as the call count of the last @p window, in @p nBuckets steps
+   */
+  void
+  SetSlidingWindow(Time window, uint32_t nBuckets);
+
+  /**
+   * @brief Estimate the load as the backlog of calls above @p rate calls per second
+   */
+  void
+  SetTokenBucket(double rate);
+
+  /**
+   * @brief Install the estimator on @p node
+   *
+   * NDN stack must be installed on @p node.
+   */
+  void
+  Install(Ptr<Node> node) const;
+
+  /**
+   * @brief Install the estimator on nodes in @p c container
+   */
+  void
+  Install(const NodeContainer& c) const;
+
+  /**
+   * @brief Install the estimator on all nodes
+   */
+  void
+  InstallAll() const;
+
+private:
+  std::function<std::unique_ptr<nfd::fib::LoadEstimator>()> m_makeLoadEstimator;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDNSIM_HELPER_NDN_LOAD_ESTIMATOR_HELPER_HPP
@@ -0,0 +1,172 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-sfc-selection-policy-helper.hpp"
+
+#include "ns3/log.h"
+
+#include "model/ndn-l3-protocol.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/forwarder.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+NS_LOG_COMPONENT_DEFINE("ndn.SfcSelectionPolicyHelper");
+
+void
+SfcSelectionPolicyHelper::Install(Ptr<Node> node, const std::string& policy)
+{
+  Ptr<L3Protocol> l3Protocol = node->GetObject<L3Protocol>();
+  NS_ASSERT_MSG(l3Protocol != nullptr, "NDN stack should be installed on the node");
+
+  shared_ptr<nfd::Forwarder> forwarder = l3Protocol->getForwarder();
+  NS_ASSERT(forwarder != nullptr);
+
+  auto sfcSelectionPolicy = nfd::fw::SfcSelectionPolicy::create(policy, *forwarder);
+  if (sfcSelectionPolicy == nullptr) {
+    NS_FATAL_ERROR("Unknown SFC selection policy [" << policy << "]");
+  }
+
+  NS_LOG_DEBUG("Node ID: " << node->GetId() << " with SFC selection policy " << policy);
+  forwarder->setSfcSelectionPolicy(std::move(sfcSelectionPolicy));
+}
+
+void
+SfcSelectionPolicyHelper::Install(const NodeContainer& c, const std::string& policy)
+{
+  for (NodeContainer::Iterator i = c.Begin(); i != c.End(); ++i) {
+    Install(*i, policy);
+  }
+}
+
+void
+SfcSelectionPolicyHelper::InstallAll(const std::string& policy)
+{
+  Install(NodeContainer::GetGlobal(), policy);
+}
+
+void
+SfcSelectionPolicyHelper::SetFeedbackInterval(Ptr<Node> node, Time interval)
+{
+  Ptr<L3Protocol> l3Protocol = node->GetObject<L3Protocol>();
+  NS_ASSERT_MSG(l3Protocol != nullptr, "NDN stack should be installed on the node");
+
+  shared_ptr<nfd::Forwarder> forwarder = l3Protocol->getForwarder();
+  NS_ASSERT(forwarder != nullptr);
+
+  if (interval.IsStrictlyNegative()) {
+    NS_FATAL_ERROR("Feedback interval must not be negative");
+  }
+  forwarder->getSfcFeedbackAggregator().setInterval(time::nanoseconds(interval.GetNanoSeconds()));
+}
+
+void
+SfcSelectionPolicyHelper::SetFeedbackInterval(const NodeContainer& c, Time interval)
+{
+  for (NodeContainer::Iterator i = c.Begin(); i != c.End(); ++i) {
+    SetFeedbackInterval(*i, interval);
+  }
+}
+
+void
+SfcSelectionPolicyHelper::SetFeedbackIntervalAll(Time interval)
+{
+  SetFeedbackInterval(NodeContainer::GetGlobal(), interval);
+}
+
+void
+SfcSelectionPolicyHelper::EnableLoadAdvertisement(Ptr<Node> node, Time period, uint32_t ttl)
+{
+  Ptr<L3Protocol> l3Protocol = node->GetObject<L3Protocol>();
+  NS_ASSERT_MSG(l3Protocol != nullptr, "NDN stack should be installed on the node");
+
+  shared_ptr<nfd::Forwarder> forwarder = l3Protocol->getForwarder();
+  NS_ASSERT(forwarder != nullptr);
+
+  if (period.IsStrictlyNegative()) {
+    NS_FATAL_ERROR("Load advertisement period must not be negative");
+  }
+  forwarder->getSfcLoadAdvertiser().enable(time::nanoseconds(period.GetNanoSeconds()), ttl);
+}
+
+void
+SfcSelectionPolicyHelper::EnableLoadAdvertisement(const NodeContainer& c, Time period,
+                                                  uint32_t ttl)
+{
+  for (NodeContainer::Iterator i = c.Begin(); i != c.End(); ++i) {
+    EnableLoadAdvertisement(*i, period, ttl);
+  }
+}
+
+void
+SfcSelectionPolicyHelper::EnableLoadAdvertisementAll(Time period, uint32_t ttl)
+{
+  EnableLoadAdvertisement(NodeContainer::GetGlobal(), period, ttl);
+}
+
+void
+SfcSelectionPolicyHelper::SetInstanceSelection(Ptr<Node> node, const std::string& selection,
+                                               int affinityCostThreshold)
+{
+  Ptr<L3Protocol> l3Protocol = node->GetObject<L3Protocol>();
+  NS_ASSERT_MSG(l3Protocol != nullptr, "NDN stack should be installed on the node");
+
+  shared_ptr<nfd::Forwarder> forwarder = l3Protocol->getForwarder();
+  NS_ASSERT(forwarder != nullptr);
+
+  nfd::fib::InstanceSelection instanceSelection;
+  if (selection == "min-cost") {
+    instanceSelection = nfd::fib::InstanceSelection::MIN_COST;
+  }
+  else if (selection == "weighted") {
+    instanceSelection = nfd::fib::InstanceSelection::WEIGHTED;
+  }
+  else if (selection == "power-of-two") {
+    instanceSelection = nfd::fib::InstanceSelection::POWER_OF_TWO;
+  }
+  else if (selection == "affinity") {
+    instanceSelection = nfd::fib::InstanceSelection::AFFINITY;
+  }
+  else {
+    NS_FATAL_ERROR("Unknown instance selection [" << selection << "]");
+  }
+
+  NS_LOG_DEBUG("Node ID: " << node->GetId() << " with instance selection " << selection);
+  forwarder->getFib().setInstanceSelection(instanceSelection);
+  forwarder->getFib().setAffinityCostThreshold(affinityCostThreshold);
+}
+
+void
+SfcSelectionPolicyHelper::SetInstanceSelection(const NodeContainer& c, const std::string& selection,
+                                               int affinityCostThreshold)
+{
+  for (NodeContainer::Iterator i = c.Begin(); i != c.End(); ++i) {
+    SetInstanceSelection(*i, selection, affinityCostThreshold);
+  }
+}
+
+void
+SfcSelectionPolicyHelper::SetInstanceSelectionAll(const std::string& selection,
+                                                  int affinityCostThreshold)
+{
+  SetInstanceSelection(NodeContainer::GetGlobal(), selection, affinityCostThreshold);
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,151 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDNSIM_HELPER_NDN_SFC_SELECTION_POLICY_HELPER_HPP
+#define NDNSIM_HELPER_NDN_SFC_SELECTION_POLICY_HELPER_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ns3/node.h"
+#include "ns3/ptr.h"
+#include "ns3/node-container.h"
+#include "ns3/nstime.h"
+
+#include <limits>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-helpers
+ * @brief Helper to select how service function instances are chosen on nodes
+ *
+ * Each forwarder starts with the policy selected by ns3::setChoiceType.  The helper replaces
+ * it per node, so different nodes of the same scenario may run different policies.
+ * Available policies are "siraiwa-ndn", "round-robin", "duration", "rand-choice" and
+ * "fib-control".
+ *
+ * Example:
+ * @code
+ * ndn::SfcSelectionPolicyHelper::InstallAll("fib-control");
+ * @endcode
+ */
+class SfcSelectionPolicyHelper
+{
+public:
+  /**
+   * @brief Select policy @p policy on @p node
+   *
+   * NDN stack must be installed on @p node.
+   */
+  static void
+  Install(Ptr<Node> node, const std::string& policy);
+
+  /**
+   * @brief Select policy @p policy on nodes in @p c container
+   */
+  static void
+  Install(const NodeContainer& c, const std::string& policy);
+
+  /**
+   * @brief Select policy @p policy on all nodes
+   */
+  static void
+  InstallAll(const std::string& policy);
+
+  /**
+   * @brief Hold the call count and hop count feedback of Data on @p node for up to @p interval
+   *
+   * Feedback received within the interval is applied to the FIB in one pass, keeping only the
+   * latest feedback of each instance.  A zero interval, the default, applies every Data
+   * immediately.
+   */
+  static void
+  SetFeedbackInterval(Ptr<Node> node, Time interval);
+
+  /**
+   * @brief Set the feedback interval on nodes in @p c container
+   */
+  static void
+  SetFeedbackInterval(const NodeContainer& c, Time interval);
+
+  /**
+   * @brief Set the feedback interval on all nodes
+   */
+  static void
+  SetFeedbackIntervalAll(Time interval);
+
+  /**
+   * @brief Advertise the call load of the instances on @p node every @p period, up to @p ttl
+   *        hops away
+   *
+   * Routers apply the advertised call count and hop count to their FIB entry of the instance,
+   * so the costs seen by the "fib-control" policy stay current away from active flows.  The
+   * control traffic is counted by nfd::fw::SfcLoadAdvertiser on every node.  A zero period
+   * stops advertising.
+   */
+  static void
+  EnableLoadAdvertisement(Ptr<Node> node, Time period, uint32_t ttl);
+
+  /**
+   * @brief Enable load advertisement on nodes in @p c container
+   */
+  static void
+  EnableLoadAdvertisement(const NodeContainer& c, Time period, uint32_t ttl);
+
+  /**
+   * @brief Enable load advertisement on all nodes
+   */
+  static void
+  EnableLoadAdvertisementAll(Time period, uint32_t ttl);
+
+  /**
+   * @brief Select how the FIB of @p node chooses among the instances of a function
+   *
+   * Available selections are "min-cost" (the default), "weighted", which splits Interests with
+   * probabilities inversely proportional to the costs, "power-of-two", which takes the cheaper
+   * of two random instances, and "affinity", which pins each content flow to one instance by a
+   * hash of its name.  The selection is used by the "fib-control" policy.
+   *
+   * @param affinityCostThreshold with "affinity", the cost above which the flows pinned to an
+   *                              instance move to other instances
+   */
+  static void
+  SetInstanceSelection(Ptr<Node> node, const std::string& selection,
+                       int affinityCostThreshold = std::numeric_limits<int>::max());
+
+  /**
+   * @brief Select the instance selection on nodes in @p c container
+   */
+  static void
+  SetInstanceSelection(const NodeContainer& c, const std::string& selection,
+                       int affinityCostThreshold = std::numeric_limits<int>::max());
+
+  /**
+   * @brief Select the instance selection on all nodes
+   */
+  static void
+  SetInstanceSelectionAll(const std::string& selection,
+                          int affinityCostThreshold = std::numeric_limits<int>::max());
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDNSIM_HELPER_NDN_SFC_SELECTION_POLICY_HELPER_HPP
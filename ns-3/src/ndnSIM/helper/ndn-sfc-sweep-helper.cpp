@@ -0,0 +1,315 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-sfc-sweep-helper.hpp"
+
+#include "ns3/ndnSIM/utils/ndn-sfc-latency-recorder.hpp"
+
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/sfc-counter-store.h"
+#include "ns3/sfc-run-context.h"
+
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <thread>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace ns3 {
+namespace ndn {
+
+NS_LOG_COMPONENT_DEFINE("ndn.SfcSweepHelper");
+
+static std::ostream&
+operator<<(std::ostream& os, const SfcSweepHelper::Cell& cell)
+{
+  return os << cell.policy << '\t' << cell.weight << '\t' << cell.frequency << '\t'
+            << cell.csSize << '\t' << cell.seed;
+}
+
+/** @brief encode @p result as one line of whitespace-separated numbers
+ */
+static std::string
+encodeResult(const SfcSweepHelper::Result& result)
+{
+  std::ostringstream os;
+  os.precision(17);
+  os << result.totalSend << ' ' << result.serviceNum << ' ' << result.totalServiceTime << ' '
+     << result.averageServiceTime << ' ' << result.latencyP50 << ' ' << result.latencyP95 << ' '
+     << result.latencyP99 << ' ' << result.totalFcc.size();
+  for (int fcc : result.totalFcc) {
+    os << ' ' << fcc;
+  }
+  os << '\n';
+  return os.str();
+}
+
+static bool
+decodeResult(const std::string& line, SfcSweepHelper::Result& result)
+{
+  std::istringstream is(line);
+  size_t nInstances = 0;
+  is >> result.totalSend >> result.serviceNum >> result.totalServiceTime
+     >> result.averageServiceTime >> result.latencyP50 >> result.latencyP95 >> result.latencyP99
+     >> nInstances;
+  result.totalFcc.resize(nInstances);
+  for (int& fcc : result.totalFcc) {
+    is >> fcc;
+  }
+  return !is.fail();
+}
+
+SfcSweepHelper::SfcSweepHelper()
+  : m_stopTime(Seconds(200.0))
+  , m_nWorkers(std::max(1u, std::thread::hardware_concurrency()))
+{
+}
+
+void
+SfcSweepHelper::AddPolicy(const std::string& policy)
+{
+  SfcRunContext::ChoiceType type;
+  if (!SfcRunContext::ParseChoiceType(policy, type)) {
+    NS_FATAL_ERROR("Unknown SFC selection policy [" << policy << "]");
+  }
+  m_policies.push_back(policy);
+}
+
+void
+SfcSweepHelper::AddWeight(int weight)
+{
+  m_weights.push_back(weight);
+}
+
+void
+SfcSweepHelper::AddFrequency(const std::string& frequency)
+{
+  m_frequencies.push_back(frequency);
+}
+
+void
+SfcSweepHelper::AddCsSize(size_t csSize)
+{
+  m_csSizes.push_back(csSize);
+}
+
+void
+SfcSweepHelper::AddSeed(uint32_t seed)
+{
+  m_seeds.push_back(seed);
+}
+
+void
+SfcSweepHelper::SetTopology(const TopologyCallback& topology)
+{
+  m_topology = topology;
+}
+
+void
+SfcSweepHelper::SetStopTime(const Time& stopTime)
+{
+  m_stopTime = stopTime;
+}
+
+void
+SfcSweepHelper::SetWorkerCount(size_t nWorkers)
+{
+  NS_ASSERT(nWorkers > 0);
+  m_nWorkers = nWorkers;
+}
+
+std::vector<SfcSweepHelper::Cell>
+SfcSweepHelper::GetCells() const
+{
+  NS_ASSERT_MSG(!m_policies.empty(), "At least one SFC selection policy is required");
+
+  std::vector<int> weights = m_weights.empty() ? std::vector<int>{1} : m_weights;
+  std::vector<std::string> frequencies =
+    m_frequencies.empty() ? std::vector<std::string>{"100"} : m_frequencies;
+  std::vector<size_t> csSizes = m_csSizes.empty() ? std::vector<size_t>{100} : m_csSizes;
+  std::vector<uint32_t> seeds = m_seeds.empty() ? std::vector<uint32_t>{1} : m_seeds;
+
+  std::vector<Cell> cells;
+  for (const std::string& policy : m_policies) {
+    for (int weight : weights) {
+      for (const std::string& frequency : frequencies) {
+        for (size_t csSize : csSizes) {
+          for (uint32_t seed : seeds) {
+            cells.push_back({policy, weight, frequency, csSize, seed});
+          }
+        }
+      }
+    }
+  }
+  return cells;
+}
+
+SfcSweepHelper::Result
+SfcSweepHelper::RunCell(const Cell& cell, const ScenarioCallback& scenario) const
+{
+  RngSeedManager::SetSeed(cell.seed);
+  setChoiceType(cell.policy.c_str());
+  setWeight(cell.weight);
+
+  scenario(cell);
+
+  Simulator::Stop(m_stopTime);
+  Simulator::Run();
+
+  Ptr<SfcRunContext> context = SfcRunContext::Get();
+  Result result;
+  result.totalSend = context->GetTotalSend();
+  result.serviceNum = context->GetServiceNum();
+  result.totalServiceTime = context->GetTotalServiceTime();
+  result.averageServiceTime = context->GetAverageServiceTime();
+  result.totalFcc = SfcCounterStore::Get()->GetTotals();
+
+  SfcLatencyRecorder latency = SfcLatencyRecorder::Collect();
+  result.latencyP50 = latency.GetHistogram().GetPercentile(50.0).GetMicroSeconds() / 1000.0;
+  result.latencyP95 = latency.GetHistogram().GetPercentile(95.0).GetMicroSeconds() / 1000.0;
+  result.latencyP99 = latency.GetHistogram().GetPercentile(99.0).GetMicroSeconds() / 1000.0;
+
+  Simulator::Destroy();
+  return result;
+}
+
+std::vector<SfcSweepHelper::Result>
+SfcSweepHelper::Run(const ScenarioCallback& scenario, const std::string& filename) const
+{
+  std::vector<Cell> cells = GetCells();
+  std::vector<Result> results(cells.size());
+
+  if (m_topology) {
+    m_topology();
+  }
+
+  struct Worker
+  {
+    int fd;
+    size_t cell;
+  };
+  std::map<pid_t, Worker> workers;
+  size_t nextCell = 0;
+
+  while (nextCell < cells.size() || !workers.empty()) {
+    if (nextCell < cells.size() && workers.size() < m_nWorkers) {
+      int fds[2];
+      if (pipe(fds) != 0) {
+        NS_FATAL_ERROR("Cannot create a pipe to a sweep worker");
+      }
+
+      // buffered output would otherwise be printed by every worker
+      std::cout.flush();
+      std::cerr.flush();
+      std::fflush(nullptr);
+
+      pid_t pid = fork();
+      if (pid < 0) {
+        NS_FATAL_ERROR("Cannot fork a sweep worker");
+      }
+      if (pid == 0) {
+        close(fds[0]);
+        std::string line = encodeResult(RunCell(cells[nextCell], scenario));
+        bool isWritten = write(fds[1], line.data(), line.size()) == static_cast<ssize_t>(line.size());
+        close(fds[1]);
+        std::cout.flush();
+        std::fflush(nullptr);
+        _exit(isWritten ? 0 : 1);
+      }
+
+      close(fds[1]);
+      NS_LOG_INFO("Cell " << nextCell << " [" << cells[nextCell] << "] runs in process " << pid);
+      workers[pid] = {fds[0], nextCell};
+      ++nextCell;
+      continue;
+    }
+
+    int status = 0;
+    pid_t pid = waitpid(-1, &status, 0);
+    auto worker = workers.find(pid);
+    if (worker == workers.end()) {
+      continue;
+    }
+
+    // a worker writes a single short line, which fits in the pipe buffer before it exits
+    std::string line;
+    char buffer[4096];
+    ssize_t nRead;
+    while ((nRead = read(worker->second.fd, buffer, sizeof(buffer))) > 0) {
+      line.append(buffer, nRead);
+    }
+    close(worker->second.fd);
+
+    const Cell& cell = cells[worker->second.cell];
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0 ||
+        !decodeResult(line, results[worker->second.cell])) {
+      NS_FATAL_ERROR("Sweep cell [" << cell << "] failed");
+    }
+    NS_LOG_INFO("Cell " << worker->second.cell << " [" << cell << "] done");
+    workers.erase(worker);
+  }
+
+  Simulator::Destroy();
+
+  std::ofstream os(filename.c_str());
+  if (!os) {
+    NS_FATAL_ERROR("Cannot open " << filename);
+  }
+  WriteResults(os, cells, results);
+  return results;
+}
+
+void
+SfcSweepHelper::WriteResults(std::ostream& os, const std::vector<Cell>& cells,
+                             const std::vector<Result>& results)
+{
+  NS_ASSERT(cells.size() == results.size());
+
+  size_t nInstances = 0;
+  for (const Result& result : results) {
+    nInstances = std::max(nInstances, result.totalFcc.size());
+  }
+
+  os << "policy\tweight\tfrequency\tcs_size\tseed"
+     << "\ttotal_send\tservice_num\ttotal_service_time\taverage_service_time"
+     << "\tlatency_p50_ms\tlatency_p95_ms\tlatency_p99_ms";
+  for (size_t i = 1; i <= nInstances; ++i) {
+    os << "\tfcc_" << i;
+  }
+  os << "\n";
+
+  for (size_t i = 0; i < cells.size(); ++i) {
+    const Result& result = results[i];
+    os << cells[i] << '\t' << result.totalSend << '\t' << result.serviceNum << '\t'
+       << result.totalServiceTime << '\t' << result.averageServiceTime << '\t'
+       << result.latencyP50 << '\t' << result.latencyP95 << '\t' << result.latencyP99;
+    for (size_t j = 0; j < nInstances; ++j) {
+      os << '\t' << (j < result.totalFcc.size() ? result.totalFcc[j] : 0);
+    }
+    os << "\n";
+  }
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,182 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDNSIM_HELPER_NDN_SFC_SWEEP_HELPER_HPP
+#define NDNSIM_HELPER_NDN_SFC_SWEEP_HELPER_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ns3/nstime.h"
+
+#include <functional>
+#include <iosfwd>
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-helpers
+ * @brief Helper to run an SFC scenario over a grid of parameters
+ *
+ * The grid is the cartesian product of the selection policies, weights, consumer
+ * frequencies, content store sizes and random seeds added to the helper.  Every cell is
+ * simulated in its own worker process, forked after the topology has been built once, so
+ * that cells share the topology copy-on-write and never share simulator state.  Up to
+ * SetWorkerCount() cells run at the same time.  The results of all cells are written to a
+ * single tab-separated file with one row per cell.
+ *
+ * Example:
+ * @code
+ * ndn::SfcSweepHelper sweep;
+ * sweep.AddPolicy("fibControl");
+ * sweep.AddPolicy("roundRobin");
+ * sweep.AddFrequency("100");
+ * sweep.AddCsSize(100);
+ * sweep.SetTopology([] { ... read topology ... });
+ * sweep.Run([] (const ndn::SfcSweepHelper::Cell& cell) { ... install stack and apps ... },
+ *           "sweep.tsv");
+ * @endcode
+ */
+class SfcSweepHelper
+{
+public:
+  /**
+   * @brief Parameters of one simulation run
+   */
+  struct Cell
+  {
+    std::string policy;    ///< selection policy, as accepted by ns3::setChoiceType
+    int weight;            ///< weight of the call counts, see ns3::setWeight
+    std::string frequency; ///< consumer frequency, in Interests per second
+    size_t csSize;         ///< content store size in packets, 0 for no cache
+    uint32_t seed;         ///< RngSeed of the run, drives consumer and forwarder draws
+  };
+
+  /**
+   * @brief Metrics of one simulation run
+   */
+  struct Result
+  {
+    int totalSend;
+    int serviceNum;
+    int totalServiceTime;
+    double averageServiceTime;
+    double latencyP50; ///< median service latency of all chains, in milliseconds
+    double latencyP95; ///< 95th percentile service latency, in milliseconds
+    double latencyP99; ///< 99th percentile service latency, in milliseconds
+    std::vector<int> totalFcc; ///< function call count of every instance, from instance 1
+  };
+
+  /**
+   * @brief Callback that builds the part of the scenario shared by all cells
+   */
+  typedef std::function<void()> TopologyCallback;
+
+  /**
+   * @brief Callback that completes the scenario for @p cell, before the simulation starts
+   */
+  typedef std::function<void(const Cell& cell)> ScenarioCallback;
+
+  SfcSweepHelper();
+
+  /**
+   * @brief Add a selection policy to the grid, e.g. "fibControl"
+   */
+  void
+  AddPolicy(const std::string& policy);
+
+  void
+  AddWeight(int weight);
+
+  void
+  AddFrequency(const std::string& frequency);
+
+  void
+  AddCsSize(size_t csSize);
+
+  void
+  AddSeed(uint32_t seed);
+
+  /**
+   * @brief Set the callback that builds the topology, run once before the cells are forked
+   */
+  void
+  SetTopology(const TopologyCallback& topology);
+
+  /**
+   * @brief Set the simulated duration of each cell (default 200 seconds)
+   */
+  void
+  SetStopTime(const Time& stopTime);
+
+  /**
+   * @brief Set the maximum number of cells running at the same time
+   *
+   * Default is the number of hardware threads.
+   */
+  void
+  SetWorkerCount(size_t nWorkers);
+
+  /**
+   * @brief Get the cells of the grid
+   *
+   * Dimensions without any value added use weight 1, frequency "100", content store size
+   * 100 and seed 1.  The policy dimension must not be empty.
+   */
+  std::vector<Cell>
+  GetCells() const;
+
+  /**
+   * @brief Run all cells and write their results to @p filename
+   * @return the results, in the order of GetCells()
+   */
+  std::vector<Result>
+  Run(const ScenarioCallback& scenario, const std::string& filename) const;
+
+  /**
+   * @brief Write @p results of @p cells as tab-separated columns with a header row
+   */
+  static void
+  WriteResults(std::ostream& os, const std::vector<Cell>& cells,
+               const std::vector<Result>& results);
+
+private:
+  /**
+   * @brief Simulate @p cell in the current process
+   */
+  Result
+  RunCell(const Cell& cell, const ScenarioCallback& scenario) const;
+
+private:
+  std::vector<std::string> m_policies;
+  std::vector<int> m_weights;
+  std::vector<std::string> m_frequencies;
+  std::vector<size_t> m_csSizes;
+  std::vector<uint32_t> m_seeds;
+
+  TopologyCallback m_topology;
+  Time m_stopTime;
+  size_t m_nWorkers;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDNSIM_HELPER_NDN_SFC_SWEEP_HELPER_HPP
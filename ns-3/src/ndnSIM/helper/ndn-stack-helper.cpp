@@ -27,6 +27,7 @@
 
 #include "model/ndn-l3-protocol.hpp"
 #include "model/ndn-net-device-transport.hpp"
+#include "model/ndn-object-link-service.hpp"
 #include "utils/ndn-time.hpp"
 #include "utils/dummy-keychain.hpp"
 #include "model/cs/ndn-content-store.hpp"
@@ -51,6 +52,10 @@ StackHelper::StackHelper()
   , m_isStrategyChoiceManagerDisabled(false)
   , m_needSetDefaultRoutes(false)
   , m_maxCsSize(100)
+  , m_stragglerTime(MilliSeconds(500000))
+  , m_shouldFinalizeWhenServed(false)
+  , m_isPitArenaEnabled(false)
+  , m_isObjectPassing(false)
 {
   setCustomNdnCxxClocks();
 
@@ -135,6 +140,31 @@ StackHelper::setCsSize(size_t maxSize)
   m_maxCsSize = maxSize;
 }
 
+void
+StackHelper::setStragglerTime(const Time& stragglerTime)
+{
+  NS_ASSERT(!stragglerTime.IsNegative());
+  m_stragglerTime = stragglerTime;
+}
+
+void
+StackHelper::setFinalizeWhenServed(bool shouldFinalize)
+{
+  m_shouldFinalizeWhenServed = shouldFinalize;
+}
+
+void
+StackHelper::setPitArena(bool isEnabled)
+{
+  m_isPitArenaEnabled = isEnabled;
+}
+
+void
+StackHelper::setObjectPassing(bool isObjectPassing)
+{
+  m_isObjectPassing = isObjectPassing;
+}
+
 void
 StackHelper::setPolicy(const std::string& policy)
 {
@@ -197,6 +227,9 @@ StackHelper::Install(Ptr<Node> node) const
   }
 
   ndn->getConfig().put("tables.cs_max_packets", (m_maxCsSize == 0) ? 1 : m_maxCsSize);
+  ndn->getConfig().put("tables.pit_straggler_time", m_stragglerTime.GetMilliSeconds());
+  ndn->getConfig().put("tables.pit_finalize_when_served", m_shouldFinalizeWhenServed ? "yes" : "no");
+  ndn->getConfig().put("tables.pit_arena", m_isPitArenaEnabled ? "yes" : "no");
 
   // Create and aggregate content store if NFD's contest store has been disabled
   if (m_maxCsSize == 0) {
@@ -309,11 +342,17 @@ StackHelper::PointToPointNetDeviceCallback(Ptr<Node> node, Ptr<L3Protocol> ndn,
     remoteNetDevice = channel->GetDevice(1);
 
   // Create an ndnSIM-specific transport instance
-  ::nfd::face::GenericLinkService::Options opts;
-  opts.allowFragmentation = true;
-  opts.allowReassembly = true;
+  std::unique_ptr<::nfd::face::LinkService> linkService;
+  if (m_isObjectPassing) {
+    linkService = make_unique<ObjectLinkService>();
+  }
+  else {
+    ::nfd::face::GenericLinkService::Options opts;
+    opts.allowFragmentation = true;
+    opts.allowReassembly = true;
 
-  auto linkService = make_unique<::nfd::face::GenericLinkService>(opts);
+    linkService = make_unique<::nfd::face::GenericLinkService>(opts);
+  }
 
   auto transport = make_unique<NetDeviceTransport>(node, netDevice,
                                                    constructFaceUri(netDevice),
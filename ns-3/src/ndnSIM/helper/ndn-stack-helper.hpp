@@ -26,6 +26,7 @@
 #include "ns3/object-factory.h"
 #include "ns3/node.h"
 #include "ns3/node-container.h"
+#include "ns3/nstime.h"
 
 #include "ndn-face-container.hpp"
 #include "ndn-fib-helper.hpp"
@@ -86,6 +87,43 @@ public:
   void
   setPolicy(const std::string& policy);
 
+  /**
+   * @brief Set how long NFD keeps a satisfied or rejected PIT entry before finalizing it
+   *
+   * Default is 500 seconds, so that PIT entries outlive most scenarios.
+   */
+  void
+  setStragglerTime(const Time& stragglerTime);
+
+  /**
+   * @brief Set whether NFD finalizes a satisfied PIT entry as soon as all its in-records are served
+   *
+   * A PIT entry whose in-records are served one by one, in the order of their sequence numbers,
+   * still waits for the straggler timer until the last in-record is served.
+   */
+  void
+  setFinalizeWhenServed(bool shouldFinalize);
+
+  /**
+   * @brief Set whether NFD allocates PIT entries and their records from a per-node arena
+   *
+   * The arena keeps the memory of erased entries for new ones instead of returning it to the
+   * system allocator, which helps when long straggler times make the PIT churn.
+   */
+  void
+  setPitArena(bool isEnabled);
+
+  /**
+   * @brief Set whether point-to-point faces pass packets as objects instead of NDNLP wire encoding
+   *
+   * Link timing is unchanged, as the simulated packets keep the size of the NDNLP packets.  Must
+   * be set before the stack is installed on both ends of a link; the default is the wire format.
+   *
+   * @sa ObjectLinkService
+   */
+  void
+  setObjectPassing(bool isObjectPassing);
+
   /**
    * @brief Set ndnSIM 1.0 content store implementation and its attributes
    * @param contentStoreClass string, representing class of the content store
@@ -273,6 +311,10 @@ private:
 
   bool m_needSetDefaultRoutes;
   size_t m_maxCsSize;
+  Time m_stragglerTime;
+  bool m_shouldFinalizeWhenServed;
+  bool m_isPitArenaEnabled;
+  bool m_isObjectPassing;
 
   typedef std::function<std::unique_ptr<nfd::cs::Policy>()> PolicyCreationCallback;
   PolicyCreationCallback m_csPolicyCreationFunc;
@@ -119,8 +119,11 @@ public:
    *
    * If an entry is found, it is promoted to the top of most recent
    * used entries index, \see m_contentStore
+   *
+   * \returns the cached Data itself, not a copy; its tags must not be changed, as it is shared with
+   *          the content store
    */
-  virtual shared_ptr<Data>
+  virtual shared_ptr<const Data>
   Lookup(shared_ptr<const Interest> interest) = 0;
 
   /**
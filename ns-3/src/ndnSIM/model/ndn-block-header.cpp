@@ -19,16 +19,13 @@
 
 #include "ndn-block-header.hpp"
 
-#include <iosfwd>
-#include <boost/iostreams/concepts.hpp>
-#include <boost/iostreams/stream.hpp>
+#include <algorithm>
 
 #include <ndn-cxx/encoding/tlv.hpp>
 #include <ndn-cxx/interest.hpp>
 #include <ndn-cxx/data.hpp>
 #include <ndn-cxx/lp/packet.hpp>
 
-namespace io = boost::iostreams;
 namespace nfdFace = nfd::face;
 
 namespace ns3 {
@@ -73,37 +70,30 @@ BlockHeader::Serialize(ns3::Buffer::Iterator start) const
   start.Write(m_block.wire(), m_block.size());
 }
 
-class Ns3BufferIteratorSource : public io::source {
-public:
-  Ns3BufferIteratorSource(ns3::Buffer::Iterator& is)
-    : m_is(is)
-  {
-  }
-
-  std::streamsize
-  read(char* buf, std::streamsize nMaxRead)
-  {
-    std::streamsize i = 0;
-    for (; i < nMaxRead && !m_is.IsEnd(); ++i) {
-      buf[i] = m_is.ReadU8();
-    }
-    if (i == 0) {
-      return -1;
-    }
-    else {
-      return i;
-    }
-  }
-
-private:
-  ns3::Buffer::Iterator& m_is;
-};
-
 uint32_t
 BlockHeader::Deserialize(ns3::Buffer::Iterator start)
 {
-  io::stream<Ns3BufferIteratorSource> is(start);
-  m_block = ::ndn::Block::fromStream(is);
+  namespace tlv = ::ndn::tlv;
+
+  // TLV type and length take at most 9 bytes each
+  uint8_t header[18];
+  uint32_t headerSize = std::min<uint32_t>(sizeof(header), start.GetRemainingSize());
+  ns3::Buffer::Iterator peek = start;
+  peek.Read(header, headerSize);
+
+  const uint8_t* begin = header;
+  const uint8_t* end = header + headerSize;
+  tlv::readType(begin, end);
+  uint64_t length = tlv::readVarNumber(begin, end);
+  uint64_t size = (begin - header) + length;
+  if (size > start.GetRemainingSize()) {
+    BOOST_THROW_EXCEPTION(tlv::Error("Not enough data in the buffer to fully parse TLV"));
+  }
+
+  // a single copy out of the packet, which the Block then shares
+  auto buffer = make_shared<::ndn::Buffer>(size);
+  start.Read(buffer->get(), size);
+  m_block = Block(buffer);
   return m_block.size();
 }
 
@@ -0,0 +1,189 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-function-processor.hpp"
+
+#include "ns3/log.h"
+#include "ns3/pointer.h"
+#include "ns3/string.h"
+#include "ns3/uinteger.h"
+#include "ns3/simulator.h"
+#include "ns3/trace-source-accessor.h"
+
+NS_LOG_COMPONENT_DEFINE("ndn.FunctionProcessor");
+
+namespace ns3 {
+namespace ndn {
+
+NS_OBJECT_ENSURE_REGISTERED(FunctionProcessor);
+
+TypeId
+FunctionProcessor::GetTypeId()
+{
+  static TypeId tid =
+    TypeId("ns3::ndn::FunctionProcessor")
+      .SetGroupName("Ndn")
+      .SetParent<Object>()
+      .AddConstructor<FunctionProcessor>()
+
+      .AddAttribute("ServiceTime", "Processing time of one job, in seconds",
+                    StringValue("ns3::ConstantRandomVariable[Constant=0.04]"),
+                    MakePointerAccessor(&FunctionProcessor::m_serviceTime),
+                    MakePointerChecker<RandomVariableStream>())
+      .AddAttribute("Workers", "Number of jobs processed at the same time", UintegerValue(1),
+                    MakeUintegerAccessor(&FunctionProcessor::m_nWorkers),
+                    MakeUintegerChecker<uint32_t>(1))
+      .AddAttribute("QueueLimit", "Maximum number of waiting jobs, 0 for no limit",
+                    UintegerValue(0), MakeUintegerAccessor(&FunctionProcessor::m_queueLimit),
+                    MakeUintegerChecker<uint32_t>())
+
+      .AddTraceSource("QueueDepth", "Number of jobs waiting for a worker",
+                      MakeTraceSourceAccessor(&FunctionProcessor::m_queueDepth),
+                      "ns3::TracedValue::Uint32Callback")
+      .AddTraceSource("BusyWorkers", "Number of workers processing a job",
+                      MakeTraceSourceAccessor(&FunctionProcessor::m_busyWorkers),
+                      "ns3::TracedValue::Uint32Callback")
+      .AddTraceSource("BusyTime", "Total time spent by all workers on completed jobs",
+                      MakeTraceSourceAccessor(&FunctionProcessor::m_busyTime),
+                      "ns3::Time::TracedValueCallback")
+      .AddTraceSource("Served", "A job is completed",
+                      MakeTraceSourceAccessor(&FunctionProcessor::m_servedTrace),
+                      "ns3::ndn::FunctionProcessor::ServedCallback")
+      .AddTraceSource("Dropped", "A job is dropped because the queue is full",
+                      MakeTraceSourceAccessor(&FunctionProcessor::m_droppedTrace),
+                      "ns3::ndn::FunctionProcessor::DroppedCallback");
+  return tid;
+}
+
+FunctionProcessor::FunctionProcessor()
+  : m_nWorkers(1)
+  , m_queueLimit(0)
+  , m_lastJobId(0)
+  , m_queueDepth(0)
+  , m_busyWorkers(0)
+  , m_busyTime(Seconds(0))
+{
+  NS_LOG_FUNCTION(this);
+}
+
+FunctionProcessor::~FunctionProcessor()
+{
+}
+
+void
+FunctionProcessor::DoDispose()
+{
+  NS_LOG_FUNCTION(this);
+
+  for (auto& running : m_running) {
+    Simulator::Cancel(running.second.finishEvent);
+  }
+  m_running.clear();
+  m_queue.clear();
+  m_serviceTime = nullptr;
+
+  Object::DoDispose();
+}
+
+bool
+FunctionProcessor::Enqueue(const Job& job)
+{
+  PendingJob pending{job, Simulator::Now()};
+  if (m_busyWorkers < m_nWorkers) {
+    Start(pending);
+    return true;
+  }
+
+  if (m_queueLimit > 0 && m_queue.size() >= m_queueLimit) {
+    NS_LOG_DEBUG("Queue is full (" << m_queue.size() << " jobs), dropping");
+    m_droppedTrace(m_queue.size());
+    return false;
+  }
+
+  m_queue.push_back(pending);
+  m_queueDepth = m_queue.size();
+  return true;
+}
+
+uint32_t
+FunctionProcessor::GetQueueDepth() const
+{
+  return m_queueDepth;
+}
+
+uint32_t
+FunctionProcessor::GetBusyWorkers() const
+{
+  return m_busyWorkers;
+}
+
+Time
+FunctionProcessor::GetBusyTime() const
+{
+  return m_busyTime;
+}
+
+int64_t
+FunctionProcessor::AssignStreams(int64_t stream)
+{
+  m_serviceTime->SetStream(stream);
+  return 1;
+}
+
+void
+FunctionProcessor::Start(const PendingJob& pending)
+{
+  Time waitingTime = Simulator::Now() - pending.arrivalTime;
+  Time serviceTime = Seconds(m_serviceTime->GetValue());
+  uint64_t jobId = ++m_lastJobId;
+
+  NS_LOG_DEBUG("Job " << jobId << " waited " << waitingTime.As(Time::MS) << ", takes "
+                      << serviceTime.As(Time::MS));
+
+  m_busyWorkers = m_busyWorkers + 1;
+  EventId event = Simulator::Schedule(serviceTime, &FunctionProcessor::Finish, this, jobId,
+                                      serviceTime);
+  m_running[jobId] = RunningJob{pending.job, event, waitingTime};
+}
+
+void
+FunctionProcessor::Finish(uint64_t jobId, Time serviceTime)
+{
+  auto running = m_running.find(jobId);
+  NS_ASSERT(running != m_running.end());
+  Job job = running->second.job;
+  Time waitingTime = running->second.waitingTime;
+  m_running.erase(running);
+
+  m_busyWorkers = m_busyWorkers - 1;
+  m_busyTime = m_busyTime + serviceTime;
+  m_servedTrace(waitingTime, serviceTime);
+
+  if (!m_queue.empty()) {
+    PendingJob next = m_queue.front();
+    m_queue.pop_front();
+    m_queueDepth = m_queue.size();
+    Start(next);
+  }
+
+  job();
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,153 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_FUNCTION_PROCESSOR_H
+#define NDN_FUNCTION_PROCESSOR_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ns3/object.h"
+#include "ns3/nstime.h"
+#include "ns3/event-id.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/traced-value.h"
+#include "ns3/traced-callback.h"
+
+#include <deque>
+#include <functional>
+#include <map>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn
+ * @brief Service model of the function instances hosted on a node
+ *
+ * Each job (a Data packet processed by a function instance) occupies one of the "Workers"
+ * for a duration drawn from "ServiceTime".  Jobs arriving while all workers are busy wait in a
+ * FIFO queue of at most "QueueLimit" jobs (0 for no limit); a job arriving at a full queue is
+ * dropped.  When a job completes, its continuation is invoked and the next waiting job starts.
+ *
+ * The processor is aggregated to the node by FunctionHelper::Install, so its attributes can be
+ * set per node, or for all nodes with Config::SetDefault.
+ */
+class FunctionProcessor : public Object {
+public:
+  /**
+   * @brief Continuation of a job, invoked when its processing completes
+   */
+  typedef std::function<void()> Job;
+
+  static TypeId
+  GetTypeId();
+
+  FunctionProcessor();
+
+  virtual
+  ~FunctionProcessor();
+
+  /**
+   * @brief Submit @p job for processing
+   * @return false if the job is dropped because the queue is full
+   */
+  bool
+  Enqueue(const Job& job);
+
+  /**
+   * @return number of jobs waiting for a worker
+   */
+  uint32_t
+  GetQueueDepth() const;
+
+  /**
+   * @return number of workers processing a job
+   */
+  uint32_t
+  GetBusyWorkers() const;
+
+  /**
+   * @return total time spent by all workers on completed jobs
+   */
+  Time
+  GetBusyTime() const;
+
+  /**
+   * @brief Assign a fixed random variable stream number to the service time
+   * @return the number of streams used
+   */
+  int64_t
+  AssignStreams(int64_t stream);
+
+  /**
+   * @brief TracedCallback signature for a completed job
+   * @param waitingTime time the job spent in the queue
+   * @param serviceTime time the job spent on a worker
+   */
+  typedef void (*ServedCallback)(Time waitingTime, Time serviceTime);
+
+  /**
+   * @brief TracedCallback signature for a dropped job
+   * @param queueDepth number of jobs waiting when the job was dropped
+   */
+  typedef void (*DroppedCallback)(uint32_t queueDepth);
+
+protected:
+  virtual void
+  DoDispose();
+
+private:
+  struct PendingJob {
+    Job job;
+    Time arrivalTime;
+  };
+
+  struct RunningJob {
+    Job job;
+    EventId finishEvent;
+    Time waitingTime;
+  };
+
+  void
+  Start(const PendingJob& pending);
+
+  void
+  Finish(uint64_t jobId, Time serviceTime);
+
+private:
+  Ptr<RandomVariableStream> m_serviceTime; ///< @brief service time, in seconds
+  uint32_t m_nWorkers;
+  uint32_t m_queueLimit;
+
+  std::deque<PendingJob> m_queue;
+  std::map<uint64_t, RunningJob> m_running; ///< @brief jobs on a worker, by id
+  uint64_t m_lastJobId;
+
+  TracedValue<uint32_t> m_queueDepth;
+  TracedValue<uint32_t> m_busyWorkers;
+  TracedValue<Time> m_busyTime;
+
+  TracedCallback<Time, Time> m_servedTrace;
+  TracedCallback<uint32_t> m_droppedTrace;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_FUNCTION_PROCESSOR_H
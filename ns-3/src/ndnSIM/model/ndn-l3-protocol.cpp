@@ -104,6 +104,9 @@ L3Protocol::GetTypeId(void)
       .AddTraceSource("TimedOutInterests", "TimedOutInterests",
                       MakeTraceSourceAccessor(&L3Protocol::m_timedOutInterests),
                       "ns3::ndn::L3Protocol::TimedOutInterestsCallback")
+      .AddTraceSource("SfcData", "SFC tags and hosted instance of every incoming Data",
+                      MakeTraceSourceAccessor(&L3Protocol::m_sfcData),
+                      "ns3::ndn::L3Protocol::SfcDataCallback")
     ;
   return tid;
 }
@@ -219,6 +222,7 @@ L3Protocol::initialize(Ptr<Node> node)
 
   m_impl->m_forwarder->beforeSatisfyInterest.connect(std::ref(m_satisfiedInterests));
   m_impl->m_forwarder->beforeExpirePendingInterest.connect(std::ref(m_timedOutInterests));
+  m_impl->m_forwarder->afterReceiveSfcData.connect(std::ref(m_sfcData));
 }
 
 class IgnoreSections
@@ -43,6 +43,9 @@ class Entry;
 namespace cs {
 class Policy;
 } // namespace cs
+namespace fw {
+struct SfcDataTrace;
+} // namespace fw
 } // namespace nfd
 
 namespace ns3 {
@@ -174,6 +177,7 @@ public:
 
   typedef void (*SatisfiedInterestsCallback)(const nfd::pit::Entry& pitEntry, const Face& inFace, const Data& data);
   typedef void (*TimedOutInterestsCallback)(const nfd::pit::Entry& pitEntry);
+  typedef void (*SfcDataCallback)(const Data& data, const nfd::fw::SfcDataTrace& trace);
 
 protected:
   virtual void
@@ -218,6 +222,8 @@ private:
 
   TracedCallback<const nfd::pit::Entry&, const Face&/*in face*/, const Data&> m_satisfiedInterests;
   TracedCallback<const nfd::pit::Entry&> m_timedOutInterests;
+
+  TracedCallback<const Data&, const nfd::fw::SfcDataTrace&> m_sfcData; ///< @brief SFC state of incoming Data
 };
 
 } // namespace ndn
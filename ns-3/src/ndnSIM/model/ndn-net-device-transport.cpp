@@ -23,15 +23,94 @@
 #include "ndn-block-header.hpp"
 #include "../utils/ndn-ns3-packet-tag.hpp"
 
+#include "ns3/simulator.h"
+#include "ns3/simulator-singleton.h"
+
 #include <ndn-cxx/encoding/block.hpp>
 #include <ndn-cxx/interest.hpp>
 #include <ndn-cxx/data.hpp>
 
+#include <deque>
+#include <unordered_map>
+
 NS_LOG_COMPONENT_DEFINE("ndn.NetDeviceTransport");
 
 namespace ns3 {
 namespace ndn {
 
+/**
+ * @brief Objects passed by ObjectLinkService, by uid of the ns-3 packet carrying them
+ *
+ * The store is aggregated to the simulator implementation, so Simulator::Destroy releases it.
+ */
+class PassedPacketStore : public Object {
+public:
+  static TypeId
+  GetTypeId()
+  {
+    static TypeId tid = TypeId("ns3::ndn::PassedPacketStore")
+      .SetGroupName("Ndn")
+      .SetParent<Object>()
+      .AddConstructor<PassedPacketStore>();
+    return tid;
+  }
+
+  /**
+   * @brief Get the store of the running simulation, creating it if needed
+   *
+   * The store is looked up once per simulation and cached until Simulator::Destroy.
+   */
+  static Ptr<PassedPacketStore>
+  Get()
+  {
+    return SimulatorSingleton<PassedPacketStore>::Get();
+  }
+
+  void
+  Put(uint64_t uid, ObjectLinkService::PassedPacket&& packet)
+  {
+    // release the objects of packets lost on a link
+    Time now = Simulator::Now();
+    while (!m_sendTimes.empty() && m_sendTimes.front().first + LIFETIME < now) {
+      m_packets.erase(m_sendTimes.front().second);
+      m_sendTimes.pop_front();
+    }
+
+    m_packets[uid] = std::move(packet);
+    m_sendTimes.emplace_back(now, uid);
+  }
+
+  /**
+   * @brief Remove the object carried by the ns-3 packet @p uid
+   * @return whether the packet carries an object
+   */
+  static bool
+  Take(uint64_t uid, ObjectLinkService::PassedPacket& packet)
+  {
+    PassedPacketStore* store = SimulatorSingleton<PassedPacketStore>::Peek();
+    if (store == nullptr) {
+      return false;
+    }
+    auto found = store->m_packets.find(uid);
+    if (found == store->m_packets.end()) {
+      return false;
+    }
+    packet = std::move(found->second);
+    store->m_packets.erase(found);
+    return true;
+  }
+
+private:
+  static const Time LIFETIME;
+
+  std::unordered_map<uint64_t, ObjectLinkService::PassedPacket> m_packets;
+  std::deque<std::pair<Time, uint64_t>> m_sendTimes; ///< in send order
+};
+
+const Time PassedPacketStore::LIFETIME = Seconds(10);
+
+NS_OBJECT_ENSURE_REGISTERED(PassedPacketStore);
+
 NetDeviceTransport::NetDeviceTransport(Ptr<Node> node,
                                        const Ptr<NetDevice>& netDevice,
                                        const std::string& localUri,
@@ -99,6 +178,29 @@ NetDeviceTransport::doSend(Packet&& packet)
                     L3Protocol::ETHERNET_FRAME_TYPE);
 }
 
+void
+NetDeviceTransport::sendPassedPacket(ObjectLinkService::PassedPacket&& packet, size_t size)
+{
+  NS_LOG_FUNCTION(this << "Passing packet from netDevice with URI"
+                  << this->getLocalUri());
+
+  nfd::face::TransportState state = this->getState();
+  if (state != nfd::face::TransportState::UP && state != nfd::face::TransportState::DOWN) {
+    return;
+  }
+  if (state == nfd::face::TransportState::UP) {
+    ++this->nOutPackets;
+    this->nOutBytes += size;
+  }
+
+  // the bytes of the NS3 packet are not written, only its size matters
+  Ptr<ns3::Packet> ns3Packet = Create<ns3::Packet>(size);
+  PassedPacketStore::Get()->Put(ns3Packet->GetUid(), std::move(packet));
+
+  m_netDevice->Send(ns3Packet, m_netDevice->GetBroadcast(),
+                    L3Protocol::ETHERNET_FRAME_TYPE);
+}
+
 // callback
 void
 NetDeviceTransport::receiveFromNetDevice(Ptr<NetDevice> device,
@@ -109,11 +211,21 @@ NetDeviceTransport::receiveFromNetDevice(Ptr<NetDevice> device,
 {
   NS_LOG_FUNCTION(device << p << protocol << from << to << packetType);
 
-  // Convert NS3 packet to NFD packet
-  Ptr<ns3::Packet> packet = p->Copy();
+  ObjectLinkService::PassedPacket passedPacket;
+  if (PassedPacketStore::Take(p->GetUid(), passedPacket)) {
+    ++this->nInPackets;
+    this->nInBytes += p->GetSize();
+
+    auto linkService = dynamic_cast<ObjectLinkService*>(this->getLinkService());
+    if (linkService != nullptr) {
+      linkService->receivePassedPacket(passedPacket);
+    }
+    return;
+  }
 
+  // Convert NS3 packet to NFD packet; the header is read in place, without copying the packet
   BlockHeader header;
-  packet->RemoveHeader(header);
+  p->PeekHeader(header);
 
   auto nfdPacket = Packet(std::move(header.getBlock()));
 
@@ -21,6 +21,7 @@
 #define NDN_NET_DEVICE_TRANSPORT_HPP
 
 #include "ns3/ndnSIM/model/ndn-common.hpp"
+#include "ns3/ndnSIM/model/ndn-object-link-service.hpp"
 #include "ns3/ndnSIM/NFD/daemon/face/transport.hpp"
 
 #include "ns3/net-device.h"
@@ -54,6 +55,16 @@ public:
   Ptr<NetDevice>
   GetNetDevice() const;
 
+  /**
+   * \brief Send \p packet as an object, in an ns-3 packet of \p size bytes
+   *
+   * The peer transport hands \p packet to its ObjectLinkService.  The ns-3 packet only carries
+   * the size, so packets lost on the link leave their object behind for a while; the objects
+   * of packets not received within 10 seconds are released.
+   */
+  void
+  sendPassedPacket(ObjectLinkService::PassedPacket&& packet, size_t size);
+
 private:
   virtual void
   beforeChangePersistency(::ndn::nfd::FacePersistency newPersistency) override;
@@ -0,0 +1,245 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-object-link-service.hpp"
+#include "ndn-net-device-transport.hpp"
+
+#include <ndn-cxx/encoding/estimator.hpp>
+#include <ndn-cxx/lp/fields.hpp>
+#include <ndn-cxx/lp/tags.hpp>
+
+#include "ns3/log.h"
+
+NS_LOG_COMPONENT_DEFINE("ndn.ObjectLinkService");
+
+namespace ns3 {
+namespace ndn {
+
+using ::ndn::EncodingEstimator;
+
+/** \return size of the wire encoding of \p pkt, without encoding it
+ */
+template<typename Packet>
+static size_t
+getWireSize(const Packet& pkt)
+{
+  if (pkt.hasWire()) {
+    return pkt.wireEncode().size();
+  }
+  EncodingEstimator estimator;
+  return pkt.wireEncode(estimator);
+}
+
+/** \return size of the NDNLP header fields GenericLinkService adds for the tags of \p pkt
+ */
+static size_t
+getLpFieldsSize(const ::ndn::TagHost& pkt)
+{
+  EncodingEstimator estimator;
+  size_t length = 0;
+
+  shared_ptr<lp::CongestionMarkTag> congestionMarkTag = pkt.getTag<lp::CongestionMarkTag>();
+  if (congestionMarkTag != nullptr) {
+    length += lp::CongestionMarkField::encode(estimator, congestionMarkTag->get());
+  }
+  shared_ptr<lp::FunctionNameTag> functionNameTag = pkt.getTag<lp::FunctionNameTag>();
+  if (functionNameTag != nullptr) {
+    length += lp::FunctionNameTagField::tagEncode(estimator, functionNameTag->get());
+  }
+  shared_ptr<lp::CountTag> countTag = pkt.getTag<lp::CountTag>();
+  if (countTag != nullptr) {
+    length += lp::CountTagField::tagEncode(estimator, countTag->get());
+  }
+  shared_ptr<lp::PartialHopTag> partialHopTag = pkt.getTag<lp::PartialHopTag>();
+  if (partialHopTag != nullptr) {
+    length += lp::PartialHopTagField::tagEncode(estimator, partialHopTag->get());
+  }
+  shared_ptr<lp::HopCountTag> hopCountTag = pkt.getTag<lp::HopCountTag>();
+  length += lp::HopCountTagField::tagEncode(estimator,
+                                            hopCountTag != nullptr ? hopCountTag->get() : 0);
+  shared_ptr<lp::PreviousFunctionTag> previousFunctionTag = pkt.getTag<lp::PreviousFunctionTag>();
+  if (previousFunctionTag != nullptr) {
+    length += lp::PreviousFunctionTagField::tagEncode(estimator, previousFunctionTag->get());
+  }
+  shared_ptr<lp::PitFunctionNameTag> pitFunctionNameTag = pkt.getTag<lp::PitFunctionNameTag>();
+  if (pitFunctionNameTag != nullptr) {
+    length += lp::PitFunctionNameTagField::tagEncode(estimator, pitFunctionNameTag->get());
+  }
+  return length;
+}
+
+/** \return size of an NDNLP packet with header fields of \p fieldsSize bytes and a fragment of
+ *          \p netSize bytes
+ */
+static size_t
+getLpPacketSize(size_t fieldsSize, size_t netSize)
+{
+  EncodingEstimator estimator;
+  size_t length = netSize;
+  length += estimator.prependVarNumber(netSize);
+  length += estimator.prependVarNumber(lp::tlv::Fragment);
+  length += fieldsSize;
+  length += estimator.prependVarNumber(length);
+  length += estimator.prependVarNumber(lp::tlv::LpPacket);
+  return length;
+}
+
+/** \brief remove the tags GenericLinkService does not decode from a non-local link
+ */
+static void
+removeLocalTags(const ::ndn::TagHost& pkt)
+{
+  pkt.removeTag<lp::IncomingFaceIdTag>();
+  pkt.removeTag<lp::NextHopFaceIdTag>();
+  pkt.removeTag<lp::CachePolicyTag>();
+}
+
+/** \brief remove the SFC tags, which GenericLinkService decodes with Data only
+ */
+static void
+removeSfcTags(const ::ndn::TagHost& pkt)
+{
+  pkt.removeTag<lp::FunctionNameTag>();
+  pkt.removeTag<lp::CountTag>();
+  pkt.removeTag<lp::PartialHopTag>();
+  pkt.removeTag<lp::PreviousFunctionTag>();
+  pkt.removeTag<lp::PitFunctionNameTag>();
+}
+
+/** \brief set the per-hop state of a passed Data, replacing the state it had at the sender
+ */
+static void
+restoreHopState(const Data& data, const ObjectLinkService::DataHopState& hop)
+{
+  removeLocalTags(data);
+  data.setServiceTime(hop.serviceTime);
+  data.setTag(hop.congestionMark);
+  data.setTag(hop.functionName);
+  data.setTag(hop.count);
+  data.setTag(hop.partialHop);
+  data.setTag(hop.hopCount);
+  data.setTag(hop.previousFunction);
+  data.setTag(hop.pitFunctionName);
+}
+
+ObjectLinkService::ObjectLinkService()
+{
+}
+
+void
+ObjectLinkService::doSendInterest(const Interest& interest)
+{
+  size_t size = getLpPacketSize(getLpFieldsSize(interest), getWireSize(interest));
+
+  // unlike Data, the receiver gets a copy: the function chain, nonce and flags are fields of the
+  // Interest, which the forwarders of both nodes keep changing after it is sent
+  auto sent = make_shared<Interest>(interest);
+  removeLocalTags(*sent);
+  removeSfcTags(*sent);
+  shared_ptr<lp::HopCountTag> hopCountTag = interest.getTag<lp::HopCountTag>();
+  sent->setTag(make_shared<lp::HopCountTag>((hopCountTag != nullptr ? hopCountTag->get() : 0) + 1));
+
+  PassedPacket packet;
+  packet.interest = std::move(sent);
+  this->sendPassedPacket(std::move(packet), size);
+}
+
+void
+ObjectLinkService::doSendData(const Data& data)
+{
+  size_t size = getLpPacketSize(getLpFieldsSize(data), getWireSize(data));
+
+  // data is shared with the receiver; the tags the forwarder set for this downstream are taken now
+  PassedPacket packet;
+  packet.data = data.shared_from_this();
+  DataHopState& hop = packet.dataHop;
+  hop.serviceTime = data.getServiceTime();
+  hop.congestionMark = data.getTag<lp::CongestionMarkTag>();
+  hop.functionName = data.getTag<lp::FunctionNameTag>();
+  hop.count = data.getTag<lp::CountTag>();
+  hop.partialHop = data.getTag<lp::PartialHopTag>();
+  hop.hopCount = data.getTag<lp::HopCountTag>();
+  if (hop.hopCount == nullptr) {
+    hop.hopCount = make_shared<lp::HopCountTag>(0);
+  }
+  hop.previousFunction = data.getTag<lp::PreviousFunctionTag>();
+  hop.pitFunctionName = data.getTag<lp::PitFunctionNameTag>();
+
+  this->sendPassedPacket(std::move(packet), size);
+}
+
+void
+ObjectLinkService::doSendNack(const lp::Nack& nack)
+{
+  EncodingEstimator estimator;
+  size_t size = getLpPacketSize(getLpFieldsSize(nack) +
+                                  lp::NackField::encode(estimator, nack.getHeader()),
+                                getWireSize(nack.getInterest()));
+
+  auto sent = make_shared<lp::Nack>(nack.getInterest());
+  sent->setHeader(nack.getHeader());
+  removeLocalTags(sent->getInterest());
+  removeSfcTags(sent->getInterest());
+  sent->getInterest().removeTag<lp::HopCountTag>();
+  sent->getInterest().removeTag<lp::CongestionMarkTag>();
+  shared_ptr<lp::CongestionMarkTag> congestionMarkTag = nack.getTag<lp::CongestionMarkTag>();
+  if (congestionMarkTag != nullptr) {
+    sent->setTag(congestionMarkTag);
+  }
+
+  PassedPacket packet;
+  packet.nack = std::move(sent);
+  this->sendPassedPacket(std::move(packet), size);
+}
+
+void
+ObjectLinkService::sendPassedPacket(PassedPacket&& packet, size_t size)
+{
+  NS_ASSERT_MSG(dynamic_cast<NetDeviceTransport*>(this->getTransport()) != nullptr,
+                "ObjectLinkService needs a NetDeviceTransport");
+  static_cast<NetDeviceTransport*>(this->getTransport())->sendPassedPacket(std::move(packet), size);
+}
+
+void
+ObjectLinkService::doReceivePacket(nfd::face::Transport::Packet&& packet)
+{
+  NS_LOG_WARN("Received a packet in the wire format, the peer does not pass objects: DROP");
+}
+
+void
+ObjectLinkService::receivePassedPacket(const PassedPacket& packet)
+{
+  if (packet.interest != nullptr) {
+    this->receiveInterest(*packet.interest);
+  }
+  else if (packet.data != nullptr) {
+    // the forwarder sets tags on the Data it receives, so a Data the sender still holds, e.g. in
+    // its content store, is copied; a Data only this packet holds is received as is
+    bool isShared = !packet.data.unique();
+    shared_ptr<const Data> data = isShared ? make_shared<Data>(*packet.data) : packet.data;
+    restoreHopState(*data, packet.dataHop);
+    this->receiveData(*data);
+  }
+  else if (packet.nack != nullptr) {
+    this->receiveNack(*packet.nack);
+  }
+}
+
+} // namespace ndn
+} // namespace ns3
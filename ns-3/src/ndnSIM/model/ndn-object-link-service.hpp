@@ -0,0 +1,107 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_OBJECT_LINK_SERVICE_HPP
+#define NDN_OBJECT_LINK_SERVICE_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+#include "ns3/ndnSIM/NFD/daemon/face/link-service.hpp"
+
+#include <ndn-cxx/lp/tags.hpp>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * \ingroup ndn-face
+ * \brief Link service passing network-layer packets over simulated links as objects
+ *
+ * Instead of encoding an NDNLP packet that the receiver decodes again, the sender passes the
+ * Interest, Data or Nack object together with the tags the receiver would have decoded from the
+ * NDNLP header.  The ns-3 packet sent on the link has the size of the NDNLP packet
+ * GenericLinkService would have sent, so link timing is unchanged, but its bytes are not
+ * written.  Packets are not fragmented.
+ *
+ * Both ends of a link must use this link service: packets received in the wire format are
+ * dropped.  StackHelper::setObjectPassing selects it for all point-to-point links of a scenario,
+ * and GenericLinkService stays the default for wire-accurate simulations.
+ *
+ * \see NetDeviceTransport
+ */
+class ObjectLinkService : public nfd::face::LinkService
+{
+public:
+  /**
+   * \brief Per-hop state of a passed Data, taken when it is sent
+   *
+   * The Data object itself is shared with the sender, whose forwarder keeps setting its tags and
+   * service time for each downstream, so the values of this hop travel next to it.
+   */
+  struct DataHopState
+  {
+    time::milliseconds serviceTime;
+    shared_ptr<lp::CongestionMarkTag> congestionMark;
+    shared_ptr<lp::FunctionNameTag> functionName;
+    shared_ptr<lp::CountTag> count;
+    shared_ptr<lp::PartialHopTag> partialHop;
+    shared_ptr<lp::HopCountTag> hopCount;
+    shared_ptr<lp::PreviousFunctionTag> previousFunction;
+    shared_ptr<lp::PitFunctionNameTag> pitFunctionName;
+  };
+
+  /**
+   * \brief Network-layer packet passed over a link; exactly one of the pointers is set
+   */
+  struct PassedPacket
+  {
+    shared_ptr<const Interest> interest;
+    shared_ptr<const Data> data;
+    shared_ptr<const lp::Nack> nack;
+    DataHopState dataHop; ///< state of \p data on this hop
+  };
+
+  ObjectLinkService();
+
+  /**
+   * \brief Deliver \p packet passed by the peer link service
+   */
+  void
+  receivePassedPacket(const PassedPacket& packet);
+
+private:
+  virtual void
+  doSendInterest(const Interest& interest) override;
+
+  virtual void
+  doSendData(const Data& data) override;
+
+  virtual void
+  doSendNack(const lp::Nack& nack) override;
+
+  virtual void
+  doReceivePacket(nfd::face::Transport::Packet&& packet) override;
+
+  void
+  sendPassedPacket(PassedPacket&& packet, size_t size);
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_OBJECT_LINK_SERVICE_HPP
@@ -24,6 +24,10 @@
 #include "ns3/ndnSIM/helper/ndn-app-helper.hpp"
 #include "ns3/ndnSIM/helper/ndn-global-routing-helper.hpp"
 #include "ns3/ndnSIM/helper/ndn-network-region-table-helper.hpp"
+#include "ns3/ndnSIM/helper/ndn-function-helper.hpp"
+#include "ns3/ndnSIM/helper/ndn-sfc-selection-policy-helper.hpp"
+#include "ns3/ndnSIM/helper/ndn-load-estimator-helper.hpp"
+#include "ns3/ndnSIM/helper/ndn-sfc-sweep-helper.hpp"
 // #include "ns3/ndnSIM/helper/ndn-ip-faces-helper.hpp"
 // #include "ns3/ndnSIM/helper/ndn-link-control-helper.hpp"
 
@@ -34,9 +38,13 @@
 #include "ns3/ndnSIM/utils/tracers/ndn-app-delay-tracer.hpp"
 #include "ns3/ndnSIM/utils/tracers/ndn-cs-tracer.hpp"
 #include "ns3/ndnSIM/utils/tracers/ndn-l3-rate-tracer.hpp"
+#include "ns3/ndnSIM/utils/tracers/ndn-sfc-data-tracer.hpp"
+#include "ns3/ndnSIM/utils/ndn-sfc-catalog.hpp"
+#include "ns3/ndnSIM/utils/ndn-sfc-latency-recorder.hpp"
 
 // #include "ns3/ndnSIM/model/ndn-app-face.hpp"
 #include "ns3/ndnSIM/model/ndn-l3-protocol.hpp"
+#include "ns3/ndnSIM/model/ndn-function-processor.hpp"
 // #include "ns3/ndnSIM/model/ndn-net-device-face.hpp"
 
 // #include "ns3/ndnSIM/apps/ndn-app.hpp"
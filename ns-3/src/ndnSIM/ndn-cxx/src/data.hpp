@@ -239,6 +239,9 @@ public:
   void
   setServiceTime(const time::milliseconds& serviceTime) const
   {
+    if (serviceTime == m_serviceTime) {
+      return;
+    }
     m_serviceTime = serviceTime;
     m_wire.reset();
     //return *this;
@@ -0,0 +1,333 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2016 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "function-chain.hpp"
+#include "encoding/block-helpers.hpp"
+#include "encoding/encoding-buffer.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+namespace ndn {
+
+BOOST_CONCEPT_ASSERT((boost::EqualityComparable<FunctionChain>));
+
+const size_t FunctionChain::MAX_FUNCTIONS;
+const FunctionChain::FunctionId FunctionChain::INVALID_FUNCTION;
+const char FunctionChain::MARKER;
+
+namespace {
+
+/** @brief process-wide table of function name components
+ *
+ *  Components are kept in a deque so that references returned by
+ *  FunctionChain::getComponent stay valid when new functions are interned.
+ *  Slot 0 is reserved for INVALID_FUNCTION.
+ *
+ *  A function and its marked form are linked when the second of them is interned,
+ *  so that marking and unmarking are table lookups.
+ */
+class FunctionTable : noncopyable
+{
+public:
+  FunctionTable()
+  {
+    m_components.push_back(name::Component());
+    m_marked.push_back(FunctionChain::INVALID_FUNCTION);
+    m_unmarked.push_back(FunctionChain::INVALID_FUNCTION);
+  }
+
+  FunctionChain::FunctionId
+  intern(const name::Component& component)
+  {
+    std::string key(reinterpret_cast<const char*>(component.value()), component.value_size());
+    auto it = m_ids.find(key);
+    if (it != m_ids.end()) {
+      return it->second;
+    }
+
+    if (m_components.size() > std::numeric_limits<FunctionChain::FunctionId>::max()) {
+      BOOST_THROW_EXCEPTION(FunctionChain::Error("Too many distinct functions"));
+    }
+
+    FunctionChain::FunctionId id = static_cast<FunctionChain::FunctionId>(m_components.size());
+    m_components.push_back(component);
+    m_marked.push_back(FunctionChain::INVALID_FUNCTION);
+    m_unmarked.push_back(FunctionChain::INVALID_FUNCTION);
+    m_ids.emplace(key, id);
+
+    if (key.size() > 1 && key.back() == FunctionChain::MARKER) {
+      key.pop_back();
+      FunctionChain::FunctionId unmarked = intern(name::Component(key));
+      m_unmarked[id] = unmarked;
+      m_marked[unmarked] = id;
+    }
+    return id;
+  }
+
+  FunctionChain::FunctionId
+  mark(FunctionChain::FunctionId id)
+  {
+    const name::Component& component = get(id);
+    if (m_marked[id] == FunctionChain::INVALID_FUNCTION) {
+      std::string key(reinterpret_cast<const char*>(component.value()), component.value_size());
+      intern(name::Component(key + FunctionChain::MARKER));
+    }
+    return m_marked[id];
+  }
+
+  FunctionChain::FunctionId
+  unmark(FunctionChain::FunctionId id) const
+  {
+    return id < m_unmarked.size() ? m_unmarked[id] : FunctionChain::INVALID_FUNCTION;
+  }
+
+  const name::Component&
+  get(FunctionChain::FunctionId id) const
+  {
+    if (id == FunctionChain::INVALID_FUNCTION || id >= m_components.size()) {
+      BOOST_THROW_EXCEPTION(FunctionChain::Error("Unknown function identifier " + std::to_string(id)));
+    }
+    return m_components[id];
+  }
+
+private:
+  std::deque<name::Component> m_components;
+  std::unordered_map<std::string, FunctionChain::FunctionId> m_ids;
+  std::vector<FunctionChain::FunctionId> m_marked;   ///< marked form of each function
+  std::vector<FunctionChain::FunctionId> m_unmarked; ///< function of each marked form
+};
+
+FunctionTable&
+getFunctionTable()
+{
+  static FunctionTable table;
+  return table;
+}
+
+} // anonymous namespace
+
+FunctionChain::FunctionId
+FunctionChain::intern(const name::Component& component)
+{
+  return getFunctionTable().intern(component);
+}
+
+FunctionChain::FunctionId
+FunctionChain::intern(const std::string& function)
+{
+  return getFunctionTable().intern(name::Component(function));
+}
+
+const name::Component&
+FunctionChain::getComponent(FunctionId id)
+{
+  return getFunctionTable().get(id);
+}
+
+std::string
+FunctionChain::toString(FunctionId id)
+{
+  const name::Component& component = getComponent(id);
+  return std::string(reinterpret_cast<const char*>(component.value()), component.value_size());
+}
+
+FunctionChain::FunctionId
+FunctionChain::mark(FunctionId id)
+{
+  return getFunctionTable().mark(id);
+}
+
+FunctionChain::FunctionId
+FunctionChain::unmark(FunctionId id)
+{
+  return getFunctionTable().unmark(id);
+}
+
+FunctionChain::FunctionChain()
+  : m_begin(MAX_FUNCTIONS / 2)
+  , m_end(MAX_FUNCTIONS / 2)
+  , m_hasName(false)
+{
+}
+
+FunctionChain::FunctionChain(const Name& name)
+  : m_begin(MAX_FUNCTIONS / 2)
+  , m_end(MAX_FUNCTIONS / 2)
+  , m_hasName(false)
+{
+  if (name.size() > MAX_FUNCTIONS) {
+    BOOST_THROW_EXCEPTION(Error("Function chain " + name.toUri() + " is too long"));
+  }
+
+  m_begin = m_end = (MAX_FUNCTIONS - name.size()) / 2;
+  for (const name::Component& component : name) {
+    m_functions[m_end++] = intern(component);
+  }
+}
+
+void
+FunctionChain::popHead()
+{
+  if (empty()) {
+    return;
+  }
+  ++m_begin;
+  m_hasName = false;
+}
+
+void
+FunctionChain::replaceHead(FunctionId id)
+{
+  if (empty()) {
+    return;
+  }
+  m_functions[m_begin] = id;
+  m_hasName = false;
+}
+
+void
+FunctionChain::pushFront(FunctionId id)
+{
+  if (m_begin == 0) {
+    if (size() == MAX_FUNCTIONS) {
+      BOOST_THROW_EXCEPTION(Error("Function chain is full"));
+    }
+    recenter((MAX_FUNCTIONS - size() + 1) / 2);
+  }
+  m_functions[--m_begin] = id;
+  m_hasName = false;
+}
+
+void
+FunctionChain::pushBack(FunctionId id)
+{
+  if (m_end == MAX_FUNCTIONS) {
+    if (size() == MAX_FUNCTIONS) {
+      BOOST_THROW_EXCEPTION(Error("Function chain is full"));
+    }
+    recenter((MAX_FUNCTIONS - size()) / 2);
+  }
+  m_functions[m_end++] = id;
+  m_hasName = false;
+}
+
+void
+FunctionChain::prepend(const Name& name)
+{
+  for (auto i = name.rbegin(); i != name.rend(); ++i) {
+    pushFront(intern(*i));
+  }
+}
+
+void
+FunctionChain::clear()
+{
+  m_begin = m_end = MAX_FUNCTIONS / 2;
+  m_hasName = false;
+}
+
+void
+FunctionChain::recenter(size_t newBegin)
+{
+  size_t n = size();
+  std::memmove(&m_functions[newBegin], &m_functions[m_begin], n * sizeof(FunctionId));
+  m_begin = static_cast<uint8_t>(newBegin);
+  m_end = static_cast<uint8_t>(newBegin + n);
+}
+
+const Name&
+FunctionChain::toName() const
+{
+  if (!m_hasName) {
+    m_name.clear();
+    for (size_t i = m_begin; i != m_end; ++i) {
+      m_name.append(getComponent(m_functions[i]));
+    }
+    m_hasName = true;
+  }
+  return m_name;
+}
+
+template<encoding::Tag TAG>
+size_t
+FunctionChain::wireEncode(EncodingImpl<TAG>& encoder, uint32_t type) const
+{
+  size_t totalLength = 0;
+
+  for (size_t i = m_end; i != m_begin; --i) {
+    totalLength += getComponent(m_functions[i - 1]).wireEncode(encoder);
+  }
+
+  totalLength += encoder.prependVarNumber(totalLength);
+  totalLength += encoder.prependVarNumber(type);
+  return totalLength;
+}
+
+template size_t
+FunctionChain::wireEncode<encoding::EncoderTag>(EncodingImpl<encoding::EncoderTag>& encoder,
+                                                uint32_t type) const;
+
+template size_t
+FunctionChain::wireEncode<encoding::EstimatorTag>(EncodingImpl<encoding::EstimatorTag>& encoder,
+                                                  uint32_t type) const;
+
+void
+FunctionChain::wireDecode(const Block& wire, uint32_t type)
+{
+  if (wire.type() != type) {
+    BOOST_THROW_EXCEPTION(Error("Unexpected TLV type when decoding FunctionChain"));
+  }
+
+  wire.parse();
+  if (wire.elements_size() > MAX_FUNCTIONS) {
+    BOOST_THROW_EXCEPTION(Error("Function chain is too long"));
+  }
+
+  m_begin = m_end = (MAX_FUNCTIONS - wire.elements_size()) / 2;
+  for (const Block& element : wire.elements()) {
+    if (element.type() != tlv::NameComponent) {
+      BOOST_THROW_EXCEPTION(Error("Unexpected TLV type when decoding FunctionChain"));
+    }
+    m_functions[m_end++] = intern(name::Component(element));
+  }
+  m_hasName = false;
+}
+
+bool
+FunctionChain::operator==(const FunctionChain& other) const
+{
+  return size() == other.size() &&
+         std::equal(m_functions.begin() + m_begin, m_functions.begin() + m_end,
+                    other.m_functions.begin() + other.m_begin);
+}
+
+std::ostream&
+operator<<(std::ostream& os, const FunctionChain& chain)
+{
+  return os << chain.toName();
+}
+
+} // namespace ndn
@@ -0,0 +1,230 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2013-2016 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_FUNCTION_CHAIN_HPP
+#define NDN_FUNCTION_CHAIN_HPP
+
+#include "name.hpp"
+
+#include <array>
+
+namespace ndn {
+
+/** @brief represents a service function chain carried in an Interest
+ *
+ *  Functions are stored as interned identifiers in a fixed-capacity array with
+ *  a head index, so that removing, replacing or prepending a function does not
+ *  re-parse or re-allocate the chain.  The chain is encoded on the wire as a
+ *  sequence of NameComponents, exactly like the Name it replaces.
+ */
+class FunctionChain
+{
+public:
+  class Error : public tlv::Error
+  {
+  public:
+    explicit
+    Error(const std::string& what)
+      : tlv::Error(what)
+    {
+    }
+  };
+
+  typedef uint16_t FunctionId;
+
+  /** @brief maximum number of functions in a chain
+   */
+  static const size_t MAX_FUNCTIONS = 16;
+
+  /** @brief identifier that is never assigned to a function
+   */
+  static const FunctionId INVALID_FUNCTION = 0;
+
+  /** @brief suffix of a marked function, e.g. "F2+"
+   *
+   *  A marked function is one whose instance is still to be selected.
+   */
+  static const char MARKER = '+';
+
+public: // interning
+  /** @brief get the identifier of a function name component, assigning one if needed
+   */
+  static FunctionId
+  intern(const name::Component& component);
+
+  static FunctionId
+  intern(const std::string& function);
+
+  /** @brief get the name component of an interned function
+   *  @throw Error unknown identifier
+   */
+  static const name::Component&
+  getComponent(FunctionId id);
+
+  /** @brief get the value of an interned function as a string, without URI escaping
+   *  @throw Error unknown identifier
+   */
+  static std::string
+  toString(FunctionId id);
+
+  /** @brief get the identifier of the marked form of a function, interning it on first use
+   *  @throw Error unknown identifier
+   */
+  static FunctionId
+  mark(FunctionId id);
+
+  /** @brief get the function of a marked form
+   *  @return the unmarked function, or INVALID_FUNCTION if @p id is not marked
+   */
+  static FunctionId
+  unmark(FunctionId id);
+
+public:
+  /** @brief create an empty chain (`ndn:/`)
+   */
+  FunctionChain();
+
+  /** @brief create a chain from the components of @p name
+   */
+  explicit
+  FunctionChain(const Name& name);
+
+  size_t
+  size() const
+  {
+    return m_end - m_begin;
+  }
+
+  bool
+  empty() const
+  {
+    return m_begin == m_end;
+  }
+
+  /** @brief get the i-th function of the chain, counted from the head
+   */
+  FunctionId
+  get(size_t i) const
+  {
+    return m_functions[m_begin + i];
+  }
+
+  /** @brief get the head function, or INVALID_FUNCTION if the chain is empty
+   */
+  FunctionId
+  getHead() const
+  {
+    return empty() ? INVALID_FUNCTION : m_functions[m_begin];
+  }
+
+  const name::Component&
+  getHeadComponent() const
+  {
+    return getComponent(getHead());
+  }
+
+  /** @brief remove the head function; no-op on an empty chain
+   */
+  void
+  popHead();
+
+  /** @brief replace the head function; no-op on an empty chain
+   */
+  void
+  replaceHead(FunctionId id);
+
+  /** @brief insert a function before the head
+   *  @throw Error the chain is full
+   */
+  void
+  pushFront(FunctionId id);
+
+  /** @brief insert a function after the last one
+   *  @throw Error the chain is full
+   */
+  void
+  pushBack(FunctionId id);
+
+  /** @brief insert all components of @p name before the head, keeping their order
+   */
+  void
+  prepend(const Name& name);
+
+  void
+  clear();
+
+  /** @brief get the chain as a Name
+   *
+   *  The Name is built lazily and cached until the chain is modified.
+   */
+  const Name&
+  toName() const;
+
+  std::string
+  toUri() const
+  {
+    return toName().toUri();
+  }
+
+public: // encoding
+  /** @brief prepend the chain as a TLV block of type @p type
+   */
+  template<encoding::Tag TAG>
+  size_t
+  wireEncode(EncodingImpl<TAG>& encoder, uint32_t type) const;
+
+  /** @brief decode the chain from a block of type @p type containing NameComponents
+   *  @throw Error @p wire is not of type @p type, or contains other elements
+   */
+  void
+  wireDecode(const Block& wire, uint32_t type);
+
+public: // EqualityComparable concept
+  bool
+  operator==(const FunctionChain& other) const;
+
+  bool
+  operator!=(const FunctionChain& other) const
+  {
+    return !(*this == other);
+  }
+
+private:
+  /** @brief move the stored functions so that the head is at @p newBegin
+   */
+  void
+  recenter(size_t newBegin);
+
+private:
+  std::array<FunctionId, MAX_FUNCTIONS> m_functions;
+  uint8_t m_begin;
+  uint8_t m_end;
+
+  mutable Name m_name;
+  mutable bool m_hasName;
+};
+
+std::ostream&
+operator<<(std::ostream& os, const FunctionChain& chain);
+
+} // namespace ndn
+
+#endif // NDN_FUNCTION_CHAIN_HPP
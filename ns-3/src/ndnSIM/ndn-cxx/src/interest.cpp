@@ -23,8 +23,6 @@
 #include "util/random.hpp"
 #include "util/crypto.hpp"
 #include "data.hpp"
-#include "ns3/simulator.h"
-#include <ndn-cxx/lp/tags.hpp>
 
 namespace ndn {
 
@@ -211,14 +209,6 @@ Interest::matchesData(const Data& data) const
 		}
 	}
 
-	if(ns3::getChoiceType() == 4){
-		if(data.getTag<lp::FunctionNameTag>() != nullptr){
-			if(m_functionName.compare(*(data.getTag<lp::FunctionNameTag>())) != 0){
-				return false;
-			}
-		}
-	}
-
 	return true;
 }
 
@@ -264,11 +254,11 @@ Interest::wireEncode(EncodingImpl<TAG>& encoder) const
 	}
 
 	//FunctionName
-	totalLength += getFunction().wireEncodeFunc(encoder);
+	totalLength += m_functionName.wireEncode(encoder, tlv::FunctionName);
 
 	totalLength += getFunctionNextName().wireEncodeFuncNextName(encoder);
 
-	totalLength += getFunctionFullName().wireEncodeFuncFullName(encoder);
+	totalLength += m_functionFullName.wireEncode(encoder, tlv::FunctionFullName);
 
 	if (hasLink()) {
 		if (hasSelectedDelegation()) {
@@ -402,11 +392,11 @@ Interest::wireDecode(const Block& wire)
 	}
 
 	//FunctionName
-	m_functionName.wireDecodeFunc(m_wire.get(tlv::FunctionName));
+	m_functionName.wireDecode(m_wire.get(tlv::FunctionName), tlv::FunctionName);
 
 	m_functionNextName.wireDecodeFuncNextName(m_wire.get(tlv::FunctionNextName));
 
-	m_functionFullName.wireDecodeFuncFullName(m_wire.get(tlv::FunctionFullName));
+	m_functionFullName.wireDecode(m_wire.get(tlv::FunctionFullName), tlv::FunctionFullName);
 
 	//FunctionFlag
 	val = m_wire.find(tlv::FunctionFlag);
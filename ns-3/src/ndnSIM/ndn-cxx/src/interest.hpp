@@ -24,6 +24,7 @@
 
 #include <string>
 #include "name.hpp"
+#include "function-chain.hpp"
 #include "selectors.hpp"
 #include "util/time.hpp"
 #include "tag-host.hpp"
@@ -230,33 +231,36 @@ public: // Name and guiders
 
   const Name&
   getFunctionFullName() const
+  {
+	  return m_functionFullName.toName();
+  }
+
+  const FunctionChain&
+  getFunctionFullChain() const
   {
 	  return m_functionFullName;
   }
 
   void
-  setFunctionFullName(const Name& name)
+  setFunctionFullName(const Name& name) const
   {
-	  m_functionFullName = name;
+	  m_functionFullName = FunctionChain(name);
 	  m_wire.reset();
   }
 
+  /** @brief prepend the components of @p name to the function full name
+   */
   void
-  setFunctionFullName(const Name& name) const
-    {
-  	  m_functionFullName = name;
-  	  m_wire.reset();
-    }
+  addFunctionFullName(const Name& name) const
+  {
+	  m_functionFullName.prepend(name);
+	  m_wire.reset();
+  }
 
   void
-  addFunctionFullName(Name name) const
-  {
-	  std::string oldFunc = m_functionFullName.toUri();
-	  std::string newFunc = name.toUri();
-	  newFunc += oldFunc;
-	  //std::cout << "newFunc: " << newFunc << ", name: " << name.toUri() <<std::endl;
-	  shared_ptr<Name> addFunc = make_shared<Name>(Name(newFunc));
-	  this->setFunctionFullName(*addFunc);
+  addFunctionFullName(FunctionChain::FunctionId function) const
+  {
+	  m_functionFullName.pushFront(function);
 	  m_wire.reset();
   }
 
@@ -282,6 +286,12 @@ public: // Name and guiders
 
   const Name&
   getFunction() const
+  {
+    return m_functionName.toName();
+  }
+
+  const FunctionChain&
+  getFunctionChain() const
   {
     return m_functionName;
   }
@@ -290,28 +300,24 @@ public: // Name and guiders
   setFunction(const Name& functionName)
   const
   {
-    m_functionName = functionName;
+    m_functionName = FunctionChain(functionName);
     m_wire.reset();
     //return *this;
   }
 
+  void
+  setFunctionChain(const FunctionChain& functionChain) const
+  {
+    m_functionName = functionChain;
+    m_wire.reset();
+  }
+
   void
   removeHeadFunction(const Interest& interest)
   const
   {
-    std::string funcStr = interest.getFunction().toUri();
-    int pos = funcStr.find("/", 1);
-    if(pos == -1 && funcStr.size() > 1){
-      funcStr.erase(1, funcStr.size()-1);
-      Name newFunc(funcStr);
-      interest.setFunction(newFunc);
-    }
-    else if(pos != -1){
-      funcStr.erase(1, pos);
-      Name newFunc(funcStr);
-      interest.setFunction(newFunc);
-    }
-    m_wire.reset();
+    interest.m_functionName.popHead();
+    interest.m_wire.reset();
   }
 
   //defined by yamaguchi
@@ -319,20 +325,20 @@ public: // Name and guiders
   replaceHeadFunction(const Interest& interest, shared_ptr<std::string> str)
   const
   {
-	std::string funcStr = interest.getFunction().toUri();
-	int pos = funcStr.find("/", 1);
-	if(pos == -1 && funcStr.size() > 1){
-		std::string headFunc = *str;
-		Name newFunc(headFunc);
-		interest.setFunction(newFunc);
-	}
-	else if(pos != -1){
-		std::string headFunc = *str;
-		funcStr.erase(1,pos);
-		headFunc += funcStr;
-		Name newFunc(headFunc);
-		interest.setFunction(newFunc);
+	if (interest.m_functionName.empty()) {
+		return;
 	}
+	interest.m_functionName.popHead();
+	interest.m_functionName.prepend(Name(*str));
+	interest.m_wire.reset();
+  }
+
+  /** @brief replace the head function with @p function
+   */
+  void
+  replaceHeadFunction(FunctionChain::FunctionId function) const
+  {
+	m_functionName.replaceHead(function);
 	m_wire.reset();
   }
 
@@ -549,8 +555,8 @@ public: // EqualityComparable concept
 private:
   Name m_name;
   mutable Name m_functionNextName;
-  mutable Name m_functionFullName;
-  mutable Name m_functionName;
+  mutable FunctionChain m_functionFullName;
+  mutable FunctionChain m_functionName;
   Selectors m_selectors;
   mutable Block m_nonce;
   time::milliseconds m_interestLifetime;
@@ -0,0 +1,68 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ns3/ndnSIM/NFD/daemon/table/fib.hpp"
+#include "ns3/ndnSIM/NFD/daemon/table/pit-entry.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(TestFibEntryHandle, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(Resolve)
+{
+  nfd::NameTree nameTree;
+  nfd::Fib fib(nameTree);
+
+  BOOST_CHECK(fib.get(nfd::fib::EntryHandle()) == nullptr);
+
+  nfd::fib::Entry* f1a = fib.insert("/F1a").first;
+  nfd::fib::Entry* f1b = fib.insert("/F1b").first;
+  nfd::fib::EntryHandle h1a = fib.getHandle(*f1a);
+  nfd::fib::EntryHandle h1b = fib.getHandle(*f1b);
+  BOOST_CHECK(static_cast<bool>(h1a));
+  BOOST_CHECK_EQUAL(fib.get(h1a), f1a);
+  BOOST_CHECK_EQUAL(fib.get(h1b), f1b);
+
+  // an Interest keeps the handle in its PIT entry
+  nfd::pit::Entry pitEntry(*make_shared<Interest>("/prefix"));
+  pitEntry.setSelectedInstance(h1a);
+
+  // erasing the FIB entry leaves a stale handle, not a dangling pointer
+  fib.erase("/F1a");
+  BOOST_CHECK(fib.get(pitEntry.getSelectedInstance()) == nullptr);
+  BOOST_CHECK_EQUAL(fib.get(h1b), f1b);
+
+  // the slot is reused by a new entry with a new generation
+  nfd::fib::Entry* f1c = fib.insert("/F1c").first;
+  nfd::fib::EntryHandle h1c = fib.getHandle(*f1c);
+  BOOST_CHECK_EQUAL(h1c.getSlot(), h1a.getSlot());
+  BOOST_CHECK(fib.get(h1a) == nullptr);
+  BOOST_CHECK_EQUAL(fib.get(h1c), f1c);
+
+  nfd::fib::Entry detached("/F1d");
+  BOOST_CHECK(!fib.getHandle(detached));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
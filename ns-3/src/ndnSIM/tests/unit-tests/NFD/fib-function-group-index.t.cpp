@@ -0,0 +1,236 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ns3/ndnSIM/NFD/daemon/table/fib.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using ::ndn::FunctionChain;
+
+BOOST_FIXTURE_TEST_SUITE(TestFibFunctionGroupIndex, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(Groups)
+{
+  nfd::NameTree nameTree;
+  nfd::Fib fib(nameTree);
+
+  fib.insert("/F1c");
+  fib.insert("/F1a");
+  fib.insert("/F2a");
+  fib.insert("/prefix");
+  fib.insert("/F1b/extra");
+
+  const nfd::fib::FunctionGroup* f1 = fib.findFunctionGroup(FunctionChain::intern("F1"));
+  BOOST_REQUIRE(f1 != nullptr);
+  BOOST_REQUIRE_EQUAL(f1->size(), 2);
+  BOOST_CHECK_EQUAL(f1->getInstances()[0]->getPrefix(), Name("/F1a"));
+  BOOST_CHECK_EQUAL(f1->getInstances()[1]->getPrefix(), Name("/F1c"));
+
+  fib.insert("/F1b");
+  BOOST_REQUIRE_EQUAL(f1->size(), 3);
+  BOOST_CHECK_EQUAL(f1->getInstances()[1]->getPrefix(), Name("/F1b"));
+
+  BOOST_CHECK(fib.findFunctionGroup(FunctionChain::intern("prefi")) == nullptr);
+  BOOST_CHECK(fib.findFunctionGroup(FunctionChain::intern("F3")) == nullptr);
+
+  fib.erase("/F2a");
+  BOOST_CHECK(fib.findFunctionGroup(FunctionChain::intern("F2")) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(SelectFunction)
+{
+  nfd::NameTree nameTree;
+  nfd::Fib fib(nameTree);
+
+  nfd::fib::Entry* f1a = fib.insert("/F1a").first;
+  nfd::fib::Entry* f1b = fib.insert("/F1b").first;
+  nfd::fib::Entry* f1c = fib.insert("/F1c").first;
+  FunctionChain::FunctionId f1 = FunctionChain::intern("F1");
+
+  // ties are broken by instance order, and each selection counts a function call
+  BOOST_CHECK_EQUAL(fib.selectFunction(f1), f1a);
+  BOOST_CHECK_EQUAL(fib.selectFunction(f1), f1b);
+  BOOST_CHECK_EQUAL(fib.selectFunction(f1), f1c);
+  BOOST_CHECK_EQUAL(fib.selectFunction(Name("/F1/F2")), f1a);
+  BOOST_CHECK_EQUAL(f1a->getFcc(), 2);
+
+  // costs reported by Data update the selection
+  f1b->setPhc(5);
+  f1c->setFcc(0);
+  BOOST_CHECK_EQUAL(fib.selectFunction(f1), f1c);
+  f1a->setFcc(0);
+  f1c->setPhc(3);
+  BOOST_CHECK_EQUAL(fib.selectFunction(f1), f1a);
+
+  fib.erase(*f1a);
+  BOOST_CHECK_EQUAL(fib.findFunctionGroup(f1)->getMinCostInstance(), f1c);
+
+  BOOST_CHECK(fib.selectFunction(FunctionChain::intern("F9")) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(WeightedSelection)
+{
+  nfd::NameTree nameTree;
+  nfd::Fib fib(nameTree);
+  fib.setInstanceSelection(nfd::fib::InstanceSelection::WEIGHTED);
+
+  nfd::fib::Entry* f1a = fib.insert("/F1a").first;
+  nfd::fib::Entry* f1b = fib.insert("/F1b").first;
+  nfd::fib::Entry* f1c = fib.insert("/F1c").first;
+  f1b->setFcc(1);
+  f1c->setPhc(3);
+  FunctionChain::FunctionId f1 = FunctionChain::intern("F1");
+
+  // weights 1, 1/2 and 1/4 of 1 + cost
+  std::map<nfd::fib::Entry*, int> nSelected;
+  for (int i = 0; i < 7000; ++i) {
+    ++nSelected[fib.selectFunction(f1)];
+  }
+  BOOST_CHECK_CLOSE(nSelected[f1a], 4000, 5);
+  BOOST_CHECK_CLOSE(nSelected[f1b], 2000, 10);
+  BOOST_CHECK_CLOSE(nSelected[f1c], 1000, 15);
+
+  // selections do not change the costs
+  BOOST_CHECK_EQUAL(f1a->getFcc(), 0);
+  BOOST_CHECK_EQUAL(f1b->getFcc(), 1);
+
+  // the split follows reported costs
+  f1a->setPhc(100);
+  nSelected.clear();
+  for (int i = 0; i < 1000; ++i) {
+    ++nSelected[fib.selectFunction(f1)];
+  }
+  BOOST_CHECK_LT(nSelected[f1a], 50);
+}
+
+BOOST_AUTO_TEST_CASE(SeededSelection)
+{
+  // the same seed gives the same split on every run
+  auto select = [] (uint32_t seed) {
+    nfd::NameTree nameTree;
+    nfd::Fib fib(nameTree);
+    fib.setInstanceSelection(nfd::fib::InstanceSelection::WEIGHTED);
+    fib.seedRng(seed);
+
+    fib.insert("/F1a");
+    fib.insert("/F1b").first->setFcc(1);
+    fib.insert("/F1c").first->setPhc(3);
+    FunctionChain::FunctionId f1 = FunctionChain::intern("F1");
+
+    std::vector<Name> selected;
+    for (int i = 0; i < 7000; ++i) {
+      selected.push_back(fib.selectFunction(f1)->getPrefix());
+    }
+    return selected;
+  };
+
+  std::vector<Name> first = select(42);
+  std::vector<Name> second = select(42);
+  BOOST_CHECK(first == second);
+  BOOST_CHECK(select(43) != first);
+
+  // weights 1, 1/2 and 1/4 of 1 + cost
+  std::map<Name, int> nSelected;
+  for (const Name& prefix : first) {
+    ++nSelected[prefix];
+  }
+  BOOST_CHECK_CLOSE(nSelected[Name("/F1a")], 4000, 5);
+  BOOST_CHECK_CLOSE(nSelected[Name("/F1b")], 2000, 10);
+  BOOST_CHECK_CLOSE(nSelected[Name("/F1c")], 1000, 15);
+}
+
+BOOST_AUTO_TEST_CASE(PowerOfTwoSelection)
+{
+  nfd::NameTree nameTree;
+  nfd::Fib fib(nameTree);
+  fib.setInstanceSelection(nfd::fib::InstanceSelection::POWER_OF_TWO);
+
+  nfd::fib::Entry* f1a = fib.insert("/F1a").first;
+  nfd::fib::Entry* f1b = fib.insert("/F1b").first;
+  nfd::fib::Entry* f1c = fib.insert("/F1c").first;
+  f1b->setPhc(5);
+  f1c->setPhc(9);
+  FunctionChain::FunctionId f1 = FunctionChain::intern("F1");
+
+  // the most expensive instance loses every comparison until the others catch up
+  for (int i = 0; i < 6; ++i) {
+    BOOST_CHECK(fib.selectFunction(f1) != f1c);
+  }
+  BOOST_CHECK_EQUAL(f1a->getFcc() + f1b->getFcc(), 6);
+  BOOST_CHECK_EQUAL(f1c->getFcc(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(AffinitySelection)
+{
+  nfd::NameTree nameTree;
+  nfd::Fib fib(nameTree);
+  fib.setInstanceSelection(nfd::fib::InstanceSelection::AFFINITY);
+  fib.setAffinityCostThreshold(1000);
+
+  nfd::fib::Entry* f1a = fib.insert("/F1a").first;
+  nfd::fib::Entry* f1b = fib.insert("/F1b").first;
+  fib.insert("/F1c");
+  FunctionChain::FunctionId f1 = FunctionChain::intern("F1");
+
+  auto getFlow = [] (int content, uint64_t seq) {
+    return Name("/prefix").appendNumber(content).appendSequenceNumber(seq);
+  };
+
+  // all segments of a content go to the same instance
+  std::vector<nfd::fib::Entry*> pinned;
+  std::set<nfd::fib::Entry*> used;
+  for (int content = 0; content < 100; ++content) {
+    pinned.push_back(fib.selectFunction(f1, getFlow(content, 0)));
+    BOOST_CHECK_EQUAL(fib.selectFunction(f1, getFlow(content, 1)), pinned.back());
+    used.insert(pinned.back());
+  }
+  BOOST_CHECK_EQUAL(used.size(), 3u);
+
+  // only the flows of an instance over the threshold move
+  f1b->setPhc(2000);
+  for (int content = 0; content < 100; ++content) {
+    nfd::fib::Entry* selected = fib.selectFunction(f1, getFlow(content, 2));
+    if (pinned[content] == f1b) {
+      BOOST_CHECK(selected != f1b);
+    }
+    else {
+      BOOST_CHECK_EQUAL(selected, pinned[content]);
+    }
+  }
+
+  // and they come back when its cost drops
+  f1b->setPhc(0);
+  for (int content = 0; content < 100; ++content) {
+    BOOST_CHECK_EQUAL(fib.selectFunction(f1, getFlow(content, 3)), pinned[content]);
+  }
+
+  // with every instance over the threshold, flows stay pinned
+  f1a->setPhc(2000);
+  f1b->setPhc(2000);
+  fib.findExactMatch("/F1c")->setPhc(2000);
+  BOOST_CHECK_EQUAL(fib.selectFunction(f1, getFlow(0, 4)), pinned[0]);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,130 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ns3/ndnSIM/NFD/daemon/table/fib.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using nfd::fib::EwmaLoadEstimator;
+using nfd::fib::SlidingWindowLoadEstimator;
+using nfd::fib::TokenBucketLoadEstimator;
+
+typedef ::ndn::time::steady_clock::TimePoint TimePoint;
+using ::ndn::time::milliseconds;
+
+static const TimePoint T0 = TimePoint() + milliseconds(1000);
+
+BOOST_FIXTURE_TEST_SUITE(TestFibLoadEstimator, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(Ewma)
+{
+  EwmaLoadEstimator load(milliseconds(50));
+  for (int i = 0; i < 10; ++i) {
+    load.add(T0);
+  }
+  BOOST_CHECK_CLOSE(load.get(T0), 10, 1e-6);
+  BOOST_CHECK_CLOSE(load.get(T0 + milliseconds(50)), 10 * std::exp(-1), 1e-6);
+
+  // no step at any window boundary
+  BOOST_CHECK_GT(load.get(T0 + milliseconds(51)), 3);
+  BOOST_CHECK_LT(load.get(T0 + milliseconds(500)), 0.001);
+
+  load.add(T0 + milliseconds(500), 2);
+  BOOST_CHECK_CLOSE(load.get(T0 + milliseconds(500)), 2, 0.1);
+
+  load.reset();
+  BOOST_CHECK_EQUAL(load.get(T0 + milliseconds(500)), 0);
+}
+
+BOOST_AUTO_TEST_CASE(SlidingWindow)
+{
+  SlidingWindowLoadEstimator load(milliseconds(50), 5);
+  for (int i = 0; i < 10; ++i) {
+    load.add(T0 + milliseconds(i * 10)); // one call every 10 ms
+  }
+  // the window holds the calls of the last 5 buckets of 10 ms
+  BOOST_CHECK_EQUAL(load.get(T0 + milliseconds(90)), 5);
+  BOOST_CHECK_EQUAL(load.get(T0 + milliseconds(120)), 2);
+  BOOST_CHECK_EQUAL(load.get(T0 + milliseconds(130)), 1);
+  BOOST_CHECK_EQUAL(load.get(T0 + milliseconds(140)), 0);
+
+  load.add(T0 + milliseconds(10000));
+  BOOST_CHECK_EQUAL(load.get(T0 + milliseconds(10000)), 1);
+
+  load.reset();
+  BOOST_CHECK_EQUAL(load.get(T0 + milliseconds(10000)), 0);
+}
+
+BOOST_AUTO_TEST_CASE(TokenBucket)
+{
+  TokenBucketLoadEstimator load(100); // drains one call every 10 ms
+
+  // calls below the rate leave no backlog
+  for (int i = 0; i < 10; ++i) {
+    load.add(T0 + milliseconds(i * 20));
+  }
+  BOOST_CHECK_CLOSE(load.get(T0 + milliseconds(180)), 1, 1e-6);
+  BOOST_CHECK_EQUAL(load.get(T0 + milliseconds(200)), 0);
+
+  // a burst is drained at the rate
+  load.add(T0 + milliseconds(200), 5);
+  BOOST_CHECK_CLOSE(load.get(T0 + milliseconds(230)), 2, 1e-6);
+  BOOST_CHECK_EQUAL(load.get(T0 + milliseconds(300)), 0);
+}
+
+BOOST_AUTO_TEST_CASE(MakeEmpty)
+{
+  SlidingWindowLoadEstimator load(milliseconds(50), 5);
+  load.add(T0, 3);
+
+  // same window, but none of the calls of the original
+  unique_ptr<nfd::fib::LoadEstimator> empty = load.makeEmpty();
+  BOOST_CHECK_EQUAL(empty->get(T0), 0);
+  empty->add(T0 + milliseconds(10));
+  BOOST_CHECK_EQUAL(empty->get(T0 + milliseconds(50)), 1);
+  BOOST_CHECK_EQUAL(empty->get(T0 + milliseconds(60)), 0);
+  BOOST_CHECK_EQUAL(load.get(T0), 3);
+
+  TokenBucketLoadEstimator bucket(100);
+  unique_ptr<nfd::fib::LoadEstimator> emptyBucket = bucket.makeEmpty();
+  emptyBucket->add(T0, 2);
+  BOOST_CHECK_CLOSE(emptyBucket->get(T0 + milliseconds(10)), 1, 1e-6);
+}
+
+BOOST_AUTO_TEST_CASE(FibCallCount)
+{
+  nfd::NameTree nameTree;
+  nfd::Fib fib(nameTree);
+  fib.setLoadEstimator(make_unique<SlidingWindowLoadEstimator>(milliseconds(50), 1));
+
+  fib.increaseFcc();
+  fib.increaseFcc();
+  BOOST_CHECK_EQUAL(fib.getFcc(), 2);
+
+  fib.resetFcc();
+  BOOST_CHECK_EQUAL(fib.getFcc(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
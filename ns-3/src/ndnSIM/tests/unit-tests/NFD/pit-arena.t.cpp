@@ -0,0 +1,90 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ns3/ndnSIM/NFD/daemon/table/pit.hpp"
+#include "ns3/ndnSIM/NFD/daemon/face/null-face.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(TestPitArena, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(ReuseBlocks)
+{
+  nfd::pit::Arena arena;
+  void* a = arena.allocate(40);
+  void* b = arena.allocate(48);
+  BOOST_CHECK_EQUAL(arena.getNBlocks(), 2);
+  BOOST_CHECK_EQUAL(arena.getNSlabs(), 1);
+  BOOST_CHECK_EQUAL(reinterpret_cast<uintptr_t>(a) % nfd::pit::Arena::ALIGNMENT, 0);
+  BOOST_CHECK_EQUAL(reinterpret_cast<uintptr_t>(b) % nfd::pit::Arena::ALIGNMENT, 0);
+
+  // a freed block is reused for the same size class only
+  arena.deallocate(a, 40);
+  BOOST_CHECK_EQUAL(arena.getNBlocks(), 1);
+  BOOST_CHECK(arena.allocate(64) != a);
+  BOOST_CHECK_EQUAL(arena.allocate(33), a);
+
+  // large blocks are taken from the system allocator
+  void* large = arena.allocate(nfd::pit::Arena::MAX_BLOCK_SIZE + 1);
+  BOOST_CHECK_EQUAL(arena.getNBlocks(), 4);
+  arena.deallocate(large, nfd::pit::Arena::MAX_BLOCK_SIZE + 1);
+  BOOST_CHECK_EQUAL(arena.getNSlabs(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(PitEntries)
+{
+  nfd::NameTree nameTree;
+  shared_ptr<nfd::pit::Entry> entry;
+  {
+    nfd::Pit pit(nameTree);
+    pit.setArenaEnabled(true);
+    shared_ptr<const nfd::pit::Arena> arena = pit.getArena();
+    BOOST_REQUIRE(arena != nullptr);
+
+    entry = pit.insert(*make_shared<Interest>("/prefix/1")).first;
+    shared_ptr<nfd::pit::Entry> entry2 = pit.insert(*make_shared<Interest>("/prefix/2")).first;
+    BOOST_CHECK_EQUAL(arena->getNBlocks(), 2);
+
+    shared_ptr<nfd::Face> face = nfd::face::makeNullFace();
+    entry->insertOrUpdateInRecord(*face, entry->getInterest());
+    entry->insertOrUpdateOutRecord(*face, entry->getInterest());
+    BOOST_CHECK_EQUAL(arena->getNBlocks(), 4);
+
+    pit.erase(entry2.get());
+    entry2.reset();
+    BOOST_CHECK_EQUAL(arena->getNBlocks(), 3);
+
+    entry->clearInRecords();
+    entry->deleteOutRecord(*face);
+    BOOST_CHECK_EQUAL(arena->getNBlocks(), 1);
+
+    // entries allocated before the arena is disabled keep it alive
+    pit.setArenaEnabled(false);
+    BOOST_CHECK(pit.getArena() == nullptr);
+  }
+  BOOST_CHECK_EQUAL(entry->getName(), Name("/prefix/1"));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
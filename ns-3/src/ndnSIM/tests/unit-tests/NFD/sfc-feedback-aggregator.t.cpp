@@ -0,0 +1,104 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ns3/ndnSIM/NFD/daemon/fw/sfc-feedback-aggregator.hpp"
+
+#include "ns3/simulator.h"
+
+#include <ndn-cxx/lp/tags.hpp>
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using nfd::fw::SfcFeedbackAggregator;
+
+BOOST_FIXTURE_TEST_SUITE(TestSfcFeedbackAggregator, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(Immediate)
+{
+  nfd::NameTree nameTree;
+  nfd::Fib fib(nameTree);
+  nfd::fib::Entry* f1a = fib.insert("/F1a").first;
+
+  SfcFeedbackAggregator aggregator(fib);
+  aggregator.report(fib.getHandle(*f1a), 4, 2);
+  BOOST_CHECK_EQUAL(f1a->getFcc(), 4);
+  BOOST_CHECK_EQUAL(f1a->getPhc(), 2);
+  BOOST_CHECK_EQUAL(aggregator.getCounters().nApplied, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(Batched)
+{
+  nfd::NameTree nameTree;
+  nfd::Fib fib(nameTree);
+  nfd::fib::Entry* f1a = fib.insert("/F1a").first;
+  nfd::fib::Entry* f1b = fib.insert("/F1b").first;
+  nfd::fib::Entry* f1c = fib.insert("/F1c").first;
+  nfd::fib::EntryHandle f1cHandle = fib.getHandle(*f1c);
+
+  SfcFeedbackAggregator aggregator(fib);
+  aggregator.setInterval(::ndn::time::milliseconds(10));
+
+  Simulator::Schedule(MilliSeconds(1), [&] {
+    aggregator.report(fib.getHandle(*f1a), 5, 1);
+    aggregator.report(fib.getHandle(*f1b), 3, 3);
+    aggregator.report(f1cHandle, 9, 9);
+    fib.erase("/F1c");
+  });
+  Simulator::Schedule(MilliSeconds(6), [&] {
+    aggregator.report(fib.getHandle(*f1a), 7, 2);
+
+    // nothing is applied before the interval elapses
+    BOOST_CHECK_EQUAL(f1a->getFcc(), 0);
+    BOOST_CHECK_EQUAL(f1b->getFcc(), 0);
+  });
+  Simulator::Run();
+
+  // the latest report of each instance is applied
+  BOOST_CHECK_EQUAL(f1a->getFcc(), 7);
+  BOOST_CHECK_EQUAL(f1a->getPhc(), 2);
+  BOOST_CHECK_EQUAL(f1b->getFcc(), 3);
+  BOOST_CHECK_EQUAL(f1b->getPhc(), 3);
+  BOOST_CHECK(fib.findFunctionGroup(::ndn::FunctionChain::intern("F1"))->getMinCostInstance() == f1b);
+
+  const SfcFeedbackAggregator::Counters& counters = aggregator.getCounters();
+  BOOST_CHECK_EQUAL(counters.nReports, 4u);
+  BOOST_CHECK_EQUAL(counters.nCoalesced, 1u);
+  BOOST_CHECK_EQUAL(counters.nApplied, 2u);
+  BOOST_CHECK_EQUAL(counters.totalDelay, ::ndn::time::milliseconds(10 + 5));
+}
+
+BOOST_AUTO_TEST_CASE(SharedTags)
+{
+  auto tag = nfd::fw::makeFeedbackTag<lp::CountTag>(3);
+  BOOST_CHECK_EQUAL(tag->get(), 3u);
+  BOOST_CHECK(nfd::fw::makeFeedbackTag<lp::CountTag>(3) == tag);
+  BOOST_CHECK(nfd::fw::makeFeedbackTag<lp::PartialHopTag>(3) != nullptr);
+
+  auto largeTag = nfd::fw::makeFeedbackTag<lp::CountTag>(100000);
+  BOOST_CHECK_EQUAL(largeTag->get(), 100000u);
+  BOOST_CHECK(nfd::fw::makeFeedbackTag<lp::CountTag>(100000) != largeTag);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
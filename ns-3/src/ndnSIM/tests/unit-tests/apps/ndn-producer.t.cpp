@@ -0,0 +1,107 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "apps/ndn-producer.hpp"
+
+#include "ns3/string.h"
+#include "ns3/uinteger.h"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class ProducerFixture : public ScenarioHelperWithCleanupFixture
+{
+public:
+  void
+  onTransmittedData(shared_ptr<const Data> data, Ptr<App> app, shared_ptr<Face> face)
+  {
+    datas.push_back(data);
+  }
+
+  void
+  setPayloadSize(Ptr<Application> producer, uint32_t payloadSize)
+  {
+    producer->SetAttribute("PayloadSize", UintegerValue(payloadSize));
+  }
+
+  /** \return Content of \p payloadSize bytes, encoded for a single Data
+   */
+  static Block
+  makeContent(size_t payloadSize)
+  {
+    Block content(::ndn::tlv::Content, make_shared< ::ndn::Buffer>(payloadSize));
+    content.encode();
+    return content;
+  }
+
+public:
+  std::vector<shared_ptr<const Data>> datas;
+};
+
+BOOST_FIXTURE_TEST_SUITE(AppsNdnProducer, ProducerFixture)
+
+BOOST_AUTO_TEST_CASE(SharedContent)
+{
+  Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("10Mbps"));
+  Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("10ms"));
+  Config::SetDefault("ns3::DropTailQueue::MaxPackets", StringValue("20"));
+
+  createTopology({
+      {"1", "2"},
+    });
+
+  addRoutes({
+      {"1", "2", "/prefix", 1},
+    });
+
+  addApps({
+      {"1", "ns3::ndn::ConsumerCbr",
+          {{"Prefix", "/prefix"}, {"Frequency", "10"}},
+          "0s", "0.99s"},
+      {"2", "ns3::ndn::Producer",
+          {{"Prefix", "/prefix"}, {"PayloadSize", "1024"}},
+          "0s", "100s"}
+    });
+
+  Ptr<Application> producer = getNode("2")->GetApplication(0);
+  producer->TraceConnectWithoutContext("TransmittedDatas",
+                                       MakeCallback(&ProducerFixture::onTransmittedData, this));
+  // the cached Content has to follow a change of PayloadSize
+  Simulator::Schedule(Seconds(0.45), &ProducerFixture::setPayloadSize, this, producer, 100u);
+
+  Simulator::Stop(Seconds(2.0));
+  Simulator::Run();
+
+  BOOST_REQUIRE_EQUAL(datas.size(), 10);
+  Block before = makeContent(1024);
+  Block after = makeContent(100);
+  for (size_t i = 0; i < datas.size(); ++i) {
+    const Block& expected = i < 5 ? before : after;
+    const Block& content = datas[i]->getContent();
+    BOOST_CHECK_EQUAL(content.value_size(), expected.value_size());
+    BOOST_CHECK_EQUAL_COLLECTIONS(content.begin(), content.end(), expected.begin(), expected.end());
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,98 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "helper/ndn-function-helper.hpp"
+#include "model/ndn-function-processor.hpp"
+
+#include "ns3/ndnSIM/NFD/daemon/fw/forwarder.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using ::ndn::FunctionChain;
+
+class FunctionHelperFixture : public ScenarioHelperWithCleanupFixture
+{
+public:
+  FunctionHelperFixture()
+  {
+    createTopology({
+        {"A", "F1a"},
+        {"A", "F1b"},
+        {"F1a", "F2a"}
+      });
+  }
+
+  nfd::fw::FunctionInstanceRegistry&
+  getRegistry(const std::string& node)
+  {
+    return getNode(node)->GetObject<L3Protocol>()->getForwarder()->getFunctionInstanceRegistry();
+  }
+};
+
+BOOST_FIXTURE_TEST_SUITE(HelperNdnFunctionHelper, FunctionHelperFixture)
+
+BOOST_AUTO_TEST_CASE(Install)
+{
+  FunctionHelper::Install(getNode("F1a"), "F1", 'a');
+
+  const nfd::fw::FunctionInstanceRegistry& registry = getRegistry("F1a");
+  BOOST_CHECK_EQUAL(registry.size(), 1);
+
+  const nfd::fw::FunctionInstance* fi = registry.findByInstance(FunctionChain::intern("F1a"));
+  BOOST_REQUIRE(fi != nullptr);
+  BOOST_CHECK_EQUAL(fi->functionNumber, 1);
+  BOOST_CHECK_EQUAL(fi->instanceIndex, 0);
+  BOOST_CHECK_EQUAL(registry.findByFunction(FunctionChain::intern("F1")), fi);
+  BOOST_CHECK(registry.findByInstance(FunctionChain::intern("F1b")) == nullptr);
+
+  // registering the same instance again keeps a single entry
+  FunctionHelper::Install(getNode("F1a"), "F1", 'a');
+  BOOST_CHECK_EQUAL(registry.size(), 1);
+
+  BOOST_CHECK(getRegistry("A").empty());
+
+  // hosting nodes process Data through a FunctionProcessor
+  Ptr<FunctionProcessor> processor = getNode("F1a")->GetObject<FunctionProcessor>();
+  BOOST_REQUIRE(processor != nullptr);
+  BOOST_CHECK_EQUAL(getNode("F1a")->GetObject<L3Protocol>()->getForwarder()->getFunctionProcessor(),
+                    processor);
+  BOOST_CHECK(getNode("A")->GetObject<FunctionProcessor>() == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(InstallByNodeName)
+{
+  FunctionHelper::InstallByNodeName({"F1", "F2"}, 'c');
+
+  BOOST_CHECK_EQUAL(getRegistry("F1a").size(), 1);
+  BOOST_CHECK_EQUAL(getRegistry("F1b").size(), 1);
+  BOOST_CHECK_EQUAL(getRegistry("F2a").size(), 1);
+  BOOST_CHECK(getRegistry("A").empty());
+
+  const nfd::fw::FunctionInstance* fi = getRegistry("F1b").findByInstance(FunctionChain::intern("F1b"));
+  BOOST_REQUIRE(fi != nullptr);
+  BOOST_CHECK_EQUAL(fi->instanceIndex, 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
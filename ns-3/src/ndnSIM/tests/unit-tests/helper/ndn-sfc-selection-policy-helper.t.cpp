@@ -0,0 +1,158 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "helper/ndn-sfc-selection-policy-helper.hpp"
+#include "helper/ndn-function-helper.hpp"
+
+#include "ns3/ndnSIM/NFD/daemon/fw/forwarder.hpp"
+
+#include <ndn-cxx/lp/tags.hpp>
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using ::ndn::FunctionChain;
+
+class SfcSelectionPolicyHelperFixture : public ScenarioHelperWithCleanupFixture
+{
+public:
+  SfcSelectionPolicyHelperFixture()
+  {
+    Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("10Mbps"));
+    Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("1ms"));
+    Config::SetDefault("ns3::DropTailQueue::MaxPackets", StringValue("500"));
+
+    createTopology({
+        {"A", "F1a"},
+        {"A", "F1b"}
+      });
+  }
+
+  nfd::Forwarder&
+  getForwarder(const std::string& node)
+  {
+    return *getNode(node)->GetObject<L3Protocol>()->getForwarder();
+  }
+};
+
+BOOST_FIXTURE_TEST_SUITE(HelperNdnSfcSelectionPolicyHelper, SfcSelectionPolicyHelperFixture)
+
+BOOST_AUTO_TEST_CASE(Install)
+{
+  SfcSelectionPolicyHelper::InstallAll("round-robin");
+  SfcSelectionPolicyHelper::Install(getNode("F1a"), "fib-control");
+
+  BOOST_CHECK(dynamic_cast<nfd::fw::FibControlSfcSelectionPolicy*>(
+                &getForwarder("F1a").getSfcSelectionPolicy()) != nullptr);
+  BOOST_CHECK(dynamic_cast<nfd::fw::RoundRobinSfcSelectionPolicy*>(
+                &getForwarder("F1b").getSfcSelectionPolicy()) != nullptr);
+  BOOST_CHECK(dynamic_cast<nfd::fw::RoundRobinSfcSelectionPolicy*>(
+                &getForwarder("A").getSfcSelectionPolicy()) != nullptr);
+
+  BOOST_CHECK(nfd::fw::SfcSelectionPolicy::isRegistered("duration"));
+  BOOST_CHECK(!nfd::fw::SfcSelectionPolicy::isRegistered("unknown"));
+}
+
+BOOST_AUTO_TEST_CASE(LocalInstance)
+{
+  FunctionHelper::Install(getNode("F1a"), "F1", 'a');
+
+  SfcSelectionPolicyHelper::Install(getNode("F1a"), "round-robin");
+  const nfd::fw::SfcSelectionPolicy& roundRobin = getForwarder("F1a").getSfcSelectionPolicy();
+  BOOST_CHECK(roundRobin.findLocalInstance(FunctionChain(Name("/F1a/F2"))) != nullptr);
+  BOOST_CHECK(roundRobin.findLocalInstance(FunctionChain(Name("/F1/F2"))) == nullptr);
+
+  // with fibControl, the head is a function whose instance is selected through the FIB
+  SfcSelectionPolicyHelper::Install(getNode("F1a"), "fib-control");
+  const nfd::fw::SfcSelectionPolicy& fibControl = getForwarder("F1a").getSfcSelectionPolicy();
+  BOOST_CHECK(fibControl.findLocalInstance(FunctionChain(Name("/F1/F2"))) != nullptr);
+  BOOST_CHECK(fibControl.findLocalInstance(FunctionChain(Name("/F2/F1"))) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(FeedbackWithoutCount)
+{
+  SfcSelectionPolicyHelper::Install(getNode("A"), "fib-control");
+  nfd::Forwarder& forwarder = getForwarder("A");
+
+  auto interest = make_shared<Interest>("/prefix/1");
+  nfd::pit::DataMatchResult pitMatches{forwarder.getPit().insert(*interest).first};
+
+  // Data from a producer that does not take part in the feedback carries no call count
+  auto data = make_shared<Data>("/prefix/1");
+  data->setTag(make_shared<lp::PartialHopTag>(2));
+  forwarder.getSfcSelectionPolicy().afterReceiveDataAtRouter(*data, pitMatches);
+  BOOST_CHECK_EQUAL(forwarder.getSfcFeedbackAggregator().getCounters().nReports, 0u);
+
+  BOOST_REQUIRE(data->getTag<lp::PartialHopTag>() != nullptr);
+  BOOST_CHECK_EQUAL(data->getTag<lp::PartialHopTag>()->get(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(LoadAdvertisement)
+{
+  FunctionHelper::Install(getNode("F1a"), "F1", 'a');
+  addRoutes({
+      {"A", "F1a", "/F1a", 1},
+      {"F1b", "A", "/F1a", 1}
+    });
+
+  // a call count that does not decay during the test
+  nfd::Fib& fib = getForwarder("F1a").getFib();
+  fib.setLoadEstimator(make_unique<nfd::fib::SlidingWindowLoadEstimator>(::ndn::time::seconds(10), 1));
+  for (int i = 0; i < 3; ++i) {
+    fib.increaseFcc();
+  }
+
+  // whatever the phase, two advertisements are originated before 250 ms; the copies still in
+  // flight when advertising stops are delivered before the counters are checked
+  SfcSelectionPolicyHelper::EnableLoadAdvertisement(getNode("F1a"), MilliSeconds(100), 2);
+  Simulator::Schedule(MilliSeconds(250), [this] {
+      SfcSelectionPolicyHelper::EnableLoadAdvertisement(getNode("F1a"), Seconds(0), 2);
+    });
+  Simulator::Stop(MilliSeconds(500));
+  Simulator::Run();
+
+  nfd::fib::Entry* atA = getForwarder("A").getFib().findExactMatch("/F1a");
+  BOOST_REQUIRE(atA != nullptr);
+  BOOST_CHECK_EQUAL(atA->getFcc(), 3);
+  BOOST_CHECK_EQUAL(atA->getPhc(), 0);
+
+  nfd::fib::Entry* atF1b = getForwarder("F1b").getFib().findExactMatch("/F1a");
+  BOOST_REQUIRE(atF1b != nullptr);
+  BOOST_CHECK_EQUAL(atF1b->getFcc(), 3);
+  BOOST_CHECK_EQUAL(atF1b->getPhc(), 1);
+
+  // every advertisement reaches A and is relayed once to F1b, where the TTL is reached
+  const auto& origin = getForwarder("F1a").getSfcLoadAdvertiser().getCounters();
+  const auto& router = getForwarder("A").getSfcLoadAdvertiser().getCounters();
+  const auto& edge = getForwarder("F1b").getSfcLoadAdvertiser().getCounters();
+  BOOST_CHECK_GE(origin.nOriginated, 2u);
+  BOOST_CHECK_EQUAL(origin.nSent, origin.nOriginated);
+  BOOST_CHECK_EQUAL(router.nApplied, origin.nOriginated);
+  BOOST_CHECK_EQUAL(router.nSent, origin.nOriginated);
+  BOOST_CHECK_GT(router.nSentBytes, 0u);
+  BOOST_CHECK_EQUAL(edge.nApplied, origin.nOriginated);
+  BOOST_CHECK_EQUAL(edge.nSent, 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,70 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "helper/ndn-sfc-sweep-helper.hpp"
+
+#include "../tests-common.hpp"
+
+#include <sstream>
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(HelperSfcSweepHelper, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(Grid)
+{
+  SfcSweepHelper sweep;
+  sweep.AddPolicy("fibControl");
+  sweep.AddPolicy("roundRobin");
+  sweep.AddCsSize(0);
+  sweep.AddCsSize(100);
+  sweep.AddSeed(1);
+  sweep.AddSeed(2);
+
+  std::vector<SfcSweepHelper::Cell> cells = sweep.GetCells();
+  BOOST_REQUIRE_EQUAL(cells.size(), 8);
+  BOOST_CHECK_EQUAL(cells[0].policy, "fibControl");
+  BOOST_CHECK_EQUAL(cells[0].weight, 1);
+  BOOST_CHECK_EQUAL(cells[0].frequency, "100");
+  BOOST_CHECK_EQUAL(cells[0].csSize, 0);
+  BOOST_CHECK_EQUAL(cells[0].seed, 1);
+  BOOST_CHECK_EQUAL(cells[1].seed, 2);
+  BOOST_CHECK_EQUAL(cells[2].csSize, 100);
+  BOOST_CHECK_EQUAL(cells[7].policy, "roundRobin");
+}
+
+BOOST_AUTO_TEST_CASE(WriteResults)
+{
+  std::vector<SfcSweepHelper::Cell> cells = {{"duration", 1, "50", 100, 3}};
+  std::vector<SfcSweepHelper::Result> results = {{10, 9, 360, 40, 35.5, 80, 120.25, {4, 5}}};
+
+  std::ostringstream os;
+  SfcSweepHelper::WriteResults(os, cells, results);
+  BOOST_CHECK_EQUAL(os.str(),
+                    "policy\tweight\tfrequency\tcs_size\tseed\ttotal_send\tservice_num"
+                    "\ttotal_service_time\taverage_service_time"
+                    "\tlatency_p50_ms\tlatency_p95_ms\tlatency_p99_ms\tfcc_1\tfcc_2\n"
+                    "duration\t1\t50\t100\t3\t10\t9\t360\t40\t35.5\t80\t120.25\t4\t5\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
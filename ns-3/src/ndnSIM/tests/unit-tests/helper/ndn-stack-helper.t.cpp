@@ -62,6 +62,30 @@ BOOST_AUTO_TEST_CASE(TestNfdContentStorePolicy)
   BOOST_CHECK_EQUAL(protoNode1->getForwarder()->getCs().getPolicy()->getName(), "priority_fifo");
 }
 
+BOOST_AUTO_TEST_CASE(TestPitStragglerTime)
+{
+  NodeContainer nodes;
+  nodes.Create(2);
+
+  ndn::StackHelper ndnHelper;
+  ndnHelper.Install(nodes.Get(0));
+
+  ndnHelper.setStragglerTime(MilliSeconds(100));
+  ndnHelper.setFinalizeWhenServed(true);
+  ndnHelper.setPitArena(true);
+  ndnHelper.Install(nodes.Get(1));
+
+  shared_ptr<nfd::Forwarder> fw0 = L3Protocol::getL3Protocol(nodes.Get(0))->getForwarder();
+  BOOST_CHECK_EQUAL(fw0->getStragglerTime(), ::ndn::time::milliseconds(500000));
+  BOOST_CHECK_EQUAL(fw0->shouldFinalizeWhenServed(), false);
+  BOOST_CHECK(fw0->getPit().getArena() == nullptr);
+
+  shared_ptr<nfd::Forwarder> fw1 = L3Protocol::getL3Protocol(nodes.Get(1))->getForwarder();
+  BOOST_CHECK_EQUAL(fw1->getStragglerTime(), ::ndn::time::milliseconds(100));
+  BOOST_CHECK_EQUAL(fw1->shouldFinalizeWhenServed(), true);
+  BOOST_CHECK(fw1->getPit().getArena() != nullptr);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace ndn
@@ -155,6 +155,32 @@ BOOST_AUTO_TEST_CASE(PrintLpPacket)
   }
 }
 
+BOOST_AUTO_TEST_CASE(Decode)
+{
+  Data data("/other/prefix");
+  data.setContent(std::make_shared< ::ndn::Buffer>(1024));
+  ndn::StackHelper::getKeyChain().sign(data);
+  lp::Packet lpPacket(data.wireEncode());
+  Block wire = lpPacket.wireEncode();
+  BlockHeader header(nfd::face::Transport::Packet(Block(wire)));
+
+  // link layer padding after the block is not part of it
+  Ptr<Packet> packet = Create<Packet>();
+  packet->AddPaddingAtEnd(20);
+  packet->AddHeader(header);
+
+  BlockHeader decoded;
+  BOOST_CHECK_EQUAL(packet->PeekHeader(decoded), wire.size());
+  BOOST_CHECK_EQUAL_COLLECTIONS(decoded.getBlock().begin(), decoded.getBlock().end(),
+                                wire.begin(), wire.end());
+  BOOST_CHECK_EQUAL(packet->GetSize(), wire.size() + 20);
+
+  // a block cut short is rejected
+  Ptr<Packet> truncated = packet->CreateFragment(0, wire.size() - 1);
+  BlockHeader partial;
+  BOOST_CHECK_THROW(truncated->PeekHeader(partial), ::ndn::tlv::Error);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace ndn
@@ -0,0 +1,95 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "model/ndn-function-processor.hpp"
+
+#include "ns3/string.h"
+#include "ns3/uinteger.h"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class FunctionProcessorFixture : public CleanupFixture
+{
+public:
+  FunctionProcessorFixture()
+    : processor(CreateObject<FunctionProcessor>())
+  {
+    processor->SetAttribute("ServiceTime", StringValue("ns3::ConstantRandomVariable[Constant=0.01]"));
+    processor->SetAttribute("Workers", UintegerValue(1));
+    processor->SetAttribute("QueueLimit", UintegerValue(1));
+  }
+
+  FunctionProcessor::Job
+  makeJob()
+  {
+    return [this] { finishTimes.push_back(Simulator::Now()); };
+  }
+
+public:
+  Ptr<FunctionProcessor> processor;
+  std::vector<Time> finishTimes;
+};
+
+BOOST_FIXTURE_TEST_SUITE(ModelNdnFunctionProcessor, FunctionProcessorFixture)
+
+BOOST_AUTO_TEST_CASE(Queue)
+{
+  BOOST_CHECK(processor->Enqueue(makeJob()));
+  BOOST_CHECK(processor->Enqueue(makeJob()));
+  BOOST_CHECK_EQUAL(processor->GetBusyWorkers(), 1);
+  BOOST_CHECK_EQUAL(processor->GetQueueDepth(), 1);
+
+  // the only worker is busy and the queue is full
+  BOOST_CHECK(!processor->Enqueue(makeJob()));
+
+  Simulator::Run();
+
+  BOOST_REQUIRE_EQUAL(finishTimes.size(), 2);
+  BOOST_CHECK_EQUAL(finishTimes[0], MilliSeconds(10));
+  BOOST_CHECK_EQUAL(finishTimes[1], MilliSeconds(20));
+  BOOST_CHECK_EQUAL(processor->GetBusyWorkers(), 0);
+  BOOST_CHECK_EQUAL(processor->GetQueueDepth(), 0);
+  BOOST_CHECK_EQUAL(processor->GetBusyTime(), MilliSeconds(20));
+}
+
+BOOST_AUTO_TEST_CASE(Workers)
+{
+  processor->SetAttribute("Workers", UintegerValue(2));
+
+  BOOST_CHECK(processor->Enqueue(makeJob()));
+  BOOST_CHECK(processor->Enqueue(makeJob()));
+  BOOST_CHECK(processor->Enqueue(makeJob()));
+  BOOST_CHECK_EQUAL(processor->GetBusyWorkers(), 2);
+  BOOST_CHECK_EQUAL(processor->GetQueueDepth(), 1);
+
+  Simulator::Run();
+
+  BOOST_REQUIRE_EQUAL(finishTimes.size(), 3);
+  BOOST_CHECK_EQUAL(finishTimes[0], MilliSeconds(10));
+  BOOST_CHECK_EQUAL(finishTimes[1], MilliSeconds(10));
+  BOOST_CHECK_EQUAL(finishTimes[2], MilliSeconds(20));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,181 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2016  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "model/ndn-object-link-service.hpp"
+
+#include "ns3/ndnSIM/NFD/daemon/fw/forwarder.hpp"
+
+#include <ndn-cxx/lp/tags.hpp>
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+/** \brief run the exchange of the InterestAndData case in its own simulation
+ *  \return the bytes sent by the consumer face and by the producer face
+ */
+static std::pair<uint64_t, uint64_t>
+runExchange(bool isObjectPassing)
+{
+  std::pair<uint64_t, uint64_t> nOutBytes;
+  {
+    ScenarioHelper helper;
+    helper.getStackHelper().setObjectPassing(isObjectPassing);
+    helper.createTopology({
+        {"1", "2"},
+      });
+    helper.addRoutes({
+        {"1", "2", "/prefix", 1},
+      });
+    helper.addApps({
+        {"1", "ns3::ndn::ConsumerCbr",
+            {{"Prefix", "/prefix"}, {"Frequency", "10"}},
+            "0s", "0.99s"},
+        {"2", "ns3::ndn::Producer",
+            {{"Prefix", "/prefix"}, {"PayloadSize", "1024"}},
+            "0s", "100s"}
+      });
+
+    Simulator::Stop(Seconds(2.0));
+    Simulator::Run();
+
+    nOutBytes.first = helper.getFace("1", "2")->getCounters().nOutBytes;
+    nOutBytes.second = helper.getFace("2", "1")->getCounters().nOutBytes;
+  }
+
+  Simulator::Destroy();
+  Names::Clear();
+  GlobalRouter::clear();
+  return nOutBytes;
+}
+
+BOOST_FIXTURE_TEST_SUITE(ModelNdnObjectLinkService, ScenarioHelperWithCleanupFixture)
+
+BOOST_AUTO_TEST_CASE(InterestAndData)
+{
+  Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("10Mbps"));
+  Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("10ms"));
+  Config::SetDefault("ns3::DropTailQueue::MaxPackets", StringValue("20"));
+
+  getStackHelper().setObjectPassing(true);
+
+  createTopology({
+      {"1", "2"},
+    });
+
+  addRoutes({
+      {"1", "2", "/prefix", 1},
+    });
+
+  addApps({
+      {"1", "ns3::ndn::ConsumerCbr",
+          {{"Prefix", "/prefix"}, {"Frequency", "10"}},
+          "0s", "0.99s"},
+      {"2", "ns3::ndn::Producer",
+          {{"Prefix", "/prefix"}, {"PayloadSize", "1024"}},
+          "0s", "100s"}
+    });
+
+  shared_ptr<Face> consumerFace = getFace("1", "2");
+  shared_ptr<Face> producerFace = getFace("2", "1");
+  BOOST_CHECK(dynamic_cast<ObjectLinkService*>(consumerFace->getLinkService()) != nullptr);
+
+  Simulator::Stop(Seconds(2.0));
+  Simulator::Run();
+
+  BOOST_CHECK_EQUAL(consumerFace->getCounters().nOutInterests, 10);
+  BOOST_CHECK_EQUAL(producerFace->getCounters().nInInterests, 10);
+  BOOST_CHECK_EQUAL(producerFace->getCounters().nOutData, 10);
+  BOOST_CHECK_EQUAL(consumerFace->getCounters().nInData, 10);
+
+  // the simulated packets have the size of the NDNLP packets, Data carrying the 1024-byte payload
+  BOOST_CHECK_EQUAL(consumerFace->getCounters().nOutBytes, producerFace->getCounters().nInBytes);
+  BOOST_CHECK_EQUAL(producerFace->getCounters().nOutBytes, consumerFace->getCounters().nInBytes);
+  BOOST_CHECK_GT(consumerFace->getCounters().nInBytes, 10 * 1024);
+}
+
+BOOST_AUTO_TEST_CASE(SameBytesAsGeneric)
+{
+  Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("10Mbps"));
+  Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("10ms"));
+  Config::SetDefault("ns3::DropTailQueue::MaxPackets", StringValue("20"));
+
+  // passing objects must not change the traffic seen by the links
+  std::pair<uint64_t, uint64_t> generic = runExchange(false);
+  std::pair<uint64_t, uint64_t> object = runExchange(true);
+  BOOST_CHECK_GT(generic.second, 10 * 1024);
+  BOOST_CHECK_EQUAL(object.first, generic.first);
+  BOOST_CHECK_EQUAL(object.second, generic.second);
+}
+
+BOOST_AUTO_TEST_CASE(SenderKeepsData)
+{
+  Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("10Mbps"));
+  Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("10ms"));
+  Config::SetDefault("ns3::DropTailQueue::MaxPackets", StringValue("20"));
+
+  getStackHelper().setObjectPassing(true);
+
+  createTopology({
+      {"1", "2"},
+      {"2", "3"},
+      {"4", "2"},
+    });
+
+  addRoutes({
+      {"1", "2", "/prefix", 1},
+      {"4", "2", "/prefix", 1},
+      {"2", "3", "/prefix", 1},
+    });
+
+  // the consumer on 4 asks for the same Data later, so node 2 sends it from its content store
+  addApps({
+      {"1", "ns3::ndn::ConsumerCbr",
+          {{"Prefix", "/prefix"}, {"Frequency", "10"}},
+          "0s", "0.49s"},
+      {"4", "ns3::ndn::ConsumerCbr",
+          {{"Prefix", "/prefix"}, {"Frequency", "10"}},
+          "1s", "1.49s"},
+      {"3", "ns3::ndn::Producer",
+          {{"Prefix", "/prefix"}, {"PayloadSize", "1024"}},
+          "0s", "100s"}
+    });
+
+  Simulator::Stop(Seconds(2.0));
+  Simulator::Run();
+
+  BOOST_CHECK_EQUAL(getFace("3", "2")->getCounters().nOutData, 5);
+  BOOST_CHECK_EQUAL(getFace("2", "4")->getCounters().nOutData, 5);
+  BOOST_CHECK_EQUAL(getFace("4", "2")->getCounters().nInData, 5);
+
+  // the cached Data keep the incoming face set by node 2, not the one set by node 4
+  const nfd::Cs& cs = getNode("2")->GetObject<L3Protocol>()->getForwarder()->getCs();
+  BOOST_CHECK_EQUAL(cs.size(), 5);
+  for (const nfd::cs::Entry& entry : cs) {
+    shared_ptr<lp::IncomingFaceIdTag> tag = entry.getData().getTag<lp::IncomingFaceIdTag>();
+    BOOST_REQUIRE(tag != nullptr);
+    BOOST_CHECK_EQUAL(tag->get(), getFace("2", "3")->getId());
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
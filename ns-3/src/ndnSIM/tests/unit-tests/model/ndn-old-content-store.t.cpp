@@ -67,6 +67,18 @@ BOOST_AUTO_TEST_CASE(RandomPolicy)
   BOOST_CHECK(entries["1"] != entries["2"]); // this test has a small chance of failing
 }
 
+BOOST_AUTO_TEST_CASE(LookupSharesData)
+{
+  ObjectFactory factory("ns3::ndn::cs::Lru");
+  Ptr<ContentStore> cs = factory.Create<ContentStore>();
+
+  auto data = make_shared<Data>("/prefix/1");
+  cs->Add(data);
+
+  BOOST_CHECK_EQUAL(cs->Lookup(make_shared<Interest>("/prefix/1")), data);
+  BOOST_CHECK(cs->Lookup(make_shared<Interest>("/prefix/2")) == nullptr);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace ndn
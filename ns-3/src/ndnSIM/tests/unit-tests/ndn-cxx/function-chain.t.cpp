@@ -0,0 +1,116 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include <ndn-cxx/function-chain.hpp>
+#include <ndn-cxx/interest.hpp>
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using ::ndn::FunctionChain;
+
+BOOST_AUTO_TEST_SUITE(NdnCxxFunctionChain)
+
+BOOST_AUTO_TEST_CASE(HeadOperations)
+{
+  FunctionChain chain(Name("/F1/F2/F4"));
+  BOOST_CHECK_EQUAL(chain.size(), 3);
+  BOOST_CHECK_EQUAL(chain.getHead(), FunctionChain::intern("F1"));
+
+  chain.popHead();
+  BOOST_CHECK_EQUAL(chain.toName(), Name("/F2/F4"));
+
+  chain.replaceHead(FunctionChain::intern("F2a"));
+  BOOST_CHECK_EQUAL(chain.toName(), Name("/F2a/F4"));
+
+  chain.popHead();
+  chain.popHead();
+  BOOST_CHECK(chain.empty());
+  BOOST_CHECK_EQUAL(chain.getHead(), FunctionChain::INVALID_FUNCTION);
+
+  chain.popHead();
+  BOOST_CHECK(chain.empty());
+}
+
+BOOST_AUTO_TEST_CASE(Marking)
+{
+  FunctionChain::FunctionId f2 = FunctionChain::intern("F2");
+  FunctionChain::FunctionId f2Marked = FunctionChain::mark(f2);
+  BOOST_CHECK_EQUAL(FunctionChain::toString(f2Marked), "F2+");
+  BOOST_CHECK_EQUAL(FunctionChain::mark(f2), f2Marked);
+  BOOST_CHECK_EQUAL(FunctionChain::unmark(f2Marked), f2);
+  BOOST_CHECK_EQUAL(FunctionChain::unmark(f2), FunctionChain::INVALID_FUNCTION);
+  BOOST_CHECK_EQUAL(FunctionChain::unmark(FunctionChain::INVALID_FUNCTION), FunctionChain::INVALID_FUNCTION);
+
+  // a marked function decoded from the wire is linked to its function
+  FunctionChain chain(Name("/F7+/F8"));
+  BOOST_CHECK_EQUAL(FunctionChain::unmark(chain.getHead()), FunctionChain::intern("F7"));
+  BOOST_CHECK_EQUAL(FunctionChain::mark(FunctionChain::intern("F7")), chain.getHead());
+}
+
+BOOST_AUTO_TEST_CASE(Prepend)
+{
+  FunctionChain chain;
+  for (size_t i = 0; i < FunctionChain::MAX_FUNCTIONS; ++i) {
+    chain.pushFront(FunctionChain::intern("F" + std::to_string(i)));
+  }
+  BOOST_CHECK_EQUAL(chain.size(), FunctionChain::MAX_FUNCTIONS);
+  BOOST_CHECK_EQUAL(chain.getHead(), FunctionChain::intern("F" + std::to_string(FunctionChain::MAX_FUNCTIONS - 1)));
+  BOOST_CHECK_THROW(chain.pushFront(FunctionChain::intern("F1")), FunctionChain::Error);
+
+  FunctionChain fullName;
+  fullName.prepend(Name("/F4c"));
+  fullName.prepend(Name("/F1a/F2b"));
+  BOOST_CHECK_EQUAL(fullName.toName(), Name("/F1a/F2b/F4c"));
+}
+
+BOOST_AUTO_TEST_CASE(InterestEncoding)
+{
+  Interest interest("/prefix");
+  interest.setNonce(10);
+  interest.setFunction(Name("/F1/F3/F5"));
+  interest.removeHeadFunction(interest);
+  interest.addFunctionFullName(Name("/F1b"));
+
+  Interest decoded(interest.wireEncode());
+  BOOST_CHECK_EQUAL(decoded.getFunction(), Name("/F3/F5"));
+  BOOST_CHECK(decoded.getFunctionChain() == interest.getFunctionChain());
+  BOOST_CHECK_EQUAL(decoded.getFunctionFullName(), Name("/F1b"));
+}
+
+BOOST_AUTO_TEST_CASE(BlockEncoding)
+{
+  FunctionChain chain(Name("/F1/F2/F4"));
+  ::ndn::EncodingBuffer encoder;
+  chain.wireEncode(encoder, ::ndn::tlv::FunctionName);
+
+  FunctionChain decoded;
+  decoded.wireDecode(encoder.block(), ::ndn::tlv::FunctionName);
+  BOOST_CHECK(decoded == chain);
+
+  BOOST_CHECK_THROW(decoded.wireDecode(encoder.block(), ::ndn::tlv::FunctionFullName),
+                    FunctionChain::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
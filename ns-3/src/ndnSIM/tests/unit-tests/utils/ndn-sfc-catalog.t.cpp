@@ -0,0 +1,126 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/ndn-sfc-latency-recorder.hpp"
+#include "utils/ndn-sfc-catalog.hpp"
+
+#include "ns3/simulator.h"
+#include "ns3/sfc-counter-store.h"
+
+#include <sstream>
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(UtilsSfcCatalog, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(Default)
+{
+  Ptr<SfcCatalog> catalog = SfcCatalog::Get();
+  BOOST_CHECK_EQUAL(catalog->GetNFunctions(), 5u);
+  BOOST_CHECK_EQUAL(catalog->GetInstanceCount(), 15u);
+  BOOST_CHECK_EQUAL(catalog->GetNChainTypes(), 12u);
+  BOOST_CHECK_EQUAL(catalog->GetFunction(2).instances.back(), "F3c");
+
+  // chain type 3 is F2 -> F1 -> F4
+  const std::vector<uint32_t> chain3 = {1, 0, 3};
+  const std::vector<uint32_t>& functions = catalog->GetChain(3).functions;
+  BOOST_CHECK_EQUAL_COLLECTIONS(functions.begin(), functions.end(), chain3.begin(), chain3.end());
+
+  BOOST_CHECK_EQUAL(catalog->GetCounterIndex("F1", 0), 1u);
+  BOOST_CHECK_EQUAL(catalog->GetCounterIndex("F2", 1), 5u);
+  BOOST_CHECK_EQUAL(catalog->GetCounterIndex("F5", 2), 15u);
+  BOOST_CHECK_EQUAL(catalog->GetCounterIndex("F5", 3), 0u);
+  BOOST_CHECK_EQUAL(catalog->GetCounterIndex("F6", 0), 0u);
+
+  uint32_t function = 0;
+  uint32_t instance = 0;
+  BOOST_CHECK(catalog->FindInstance("/F2b", function, instance));
+  BOOST_CHECK_EQUAL(function, 1u);
+  BOOST_CHECK_EQUAL(instance, 1u);
+  BOOST_CHECK(!catalog->FindInstance("F2d", function, instance));
+  BOOST_CHECK(!catalog->FindInstance("F6a", function, instance));
+
+  // equal weights draw as the consumers did before the catalog
+  BOOST_CHECK_EQUAL(catalog->DrawChainType(0), 1u);
+  BOOST_CHECK_EQUAL(catalog->DrawChainType(13), 2u);
+  BOOST_CHECK_EQUAL(catalog->DrawChainType(4294967295u), 4294967295u % 12 + 1);
+}
+
+BOOST_AUTO_TEST_CASE(LoadFileScale)
+{
+  SfcCatalog::LoadFile(std::string(TEST_SFC_CATALOGS_PATH) + "/scale-20x8.txt");
+
+  Ptr<SfcCatalog> catalog = SfcCatalog::Get();
+  BOOST_CHECK_EQUAL(catalog->GetNFunctions(), 20u);
+  BOOST_CHECK_EQUAL(catalog->GetInstanceCount(), 160u);
+  BOOST_CHECK_EQUAL(catalog->GetNChainTypes(), 16u);
+  BOOST_CHECK_EQUAL(catalog->GetCounterIndex("F20", 7), 160u);
+
+  // the counters grow to one per instance of the catalog
+  BOOST_CHECK_EQUAL(SfcCounterStore::Get()->GetInstanceCount(), 160u);
+}
+
+BOOST_AUTO_TEST_CASE(Load)
+{
+  std::istringstream is("# two functions\n"
+                        "function A 2\n"
+                        "\n"
+                        "function B 8 # trailing comment\n"
+                        "chain 3 A B\n"
+                        "chain 1 B\n");
+  Ptr<SfcCatalog> catalog = CreateObject<SfcCatalog>();
+  catalog->Load(is);
+
+  BOOST_CHECK_EQUAL(catalog->GetNFunctions(), 2u);
+  BOOST_CHECK_EQUAL(catalog->FindFunction("B"), 1);
+  BOOST_CHECK_EQUAL(catalog->FindFunction("F1"), -1);
+  BOOST_CHECK_EQUAL(catalog->GetInstanceCount(), 10u);
+  BOOST_CHECK_EQUAL(catalog->GetFunction(1).instances.back(), "Bh");
+  BOOST_CHECK_EQUAL(catalog->GetCounterIndex("B", 0), 3u);
+
+  BOOST_REQUIRE_EQUAL(catalog->GetNChainTypes(), 2u);
+  BOOST_CHECK_EQUAL(catalog->GetChain(1).functions.size(), 2u);
+  BOOST_CHECK_EQUAL(catalog->GetChain(2).functions.size(), 1u);
+  BOOST_CHECK_EQUAL(catalog->GetChain(1).weight, 3);
+
+  // chain type 1 takes the first three quarters of the draws
+  BOOST_CHECK_EQUAL(catalog->DrawChainType(0), 1u);
+  BOOST_CHECK_EQUAL(catalog->DrawChainType(0xBFFFFFFFu), 1u);
+  BOOST_CHECK_EQUAL(catalog->DrawChainType(0xC0000000u), 2u);
+  BOOST_CHECK_EQUAL(catalog->DrawChainType(0xFFFFFFFFu), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(PerSimulation)
+{
+  Ptr<SfcCatalog> catalog = SfcCatalog::Get();
+  catalog->AddFunction("F6", 1);
+  BOOST_CHECK_EQUAL(SfcCatalog::Get()->GetNFunctions(), 6u);
+  BOOST_CHECK_EQUAL(SfcCatalog::Get()->GetCounterIndex("F6", 0), 16u);
+
+  Simulator::Destroy();
+  BOOST_CHECK_EQUAL(SfcCatalog::Get()->GetNFunctions(), 5u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
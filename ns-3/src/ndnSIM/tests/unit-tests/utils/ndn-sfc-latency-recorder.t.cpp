@@ -0,0 +1,101 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/ndn-sfc-latency-recorder.hpp"
+
+#include "ns3/simulator.h"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(UtilsSfcLatencyRecorder, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(Histogram)
+{
+  LatencyHistogram histogram;
+  BOOST_CHECK_EQUAL(histogram.GetCount(), 0u);
+  BOOST_CHECK_EQUAL(histogram.GetPercentile(50), Time(0));
+
+  // small values have their own bucket
+  histogram.Record(NanoSeconds(5));
+  BOOST_CHECK_EQUAL(histogram.GetPercentile(50), NanoSeconds(5));
+
+  for (int i = 1; i <= 1000; ++i) {
+    histogram.Record(MicroSeconds(i));
+  }
+  BOOST_CHECK_EQUAL(histogram.GetCount(), 1001u);
+  BOOST_CHECK_EQUAL(histogram.GetMin(), NanoSeconds(5));
+  BOOST_CHECK_EQUAL(histogram.GetMax(), MilliSeconds(1));
+  BOOST_CHECK_EQUAL(histogram.GetPercentile(100), MilliSeconds(1));
+
+  // percentiles are within 1/64 above the exact value
+  const std::pair<double, int64_t> expected[] = {{50, 500000}, {95, 950000}, {99, 990000}};
+  for (const auto& percentile : expected) {
+    int64_t value = histogram.GetPercentile(percentile.first).GetNanoSeconds();
+    BOOST_CHECK_GE(value, percentile.second - 1000);
+    BOOST_CHECK_LE(value, percentile.second + percentile.second / 64);
+  }
+
+  LatencyHistogram other;
+  other.Record(Seconds(2));
+  histogram.Merge(other);
+  BOOST_CHECK_EQUAL(histogram.GetCount(), 1002u);
+  BOOST_CHECK_EQUAL(histogram.GetMax(), Seconds(2));
+  BOOST_CHECK_EQUAL(histogram.GetPercentile(100), Seconds(2));
+}
+
+BOOST_AUTO_TEST_CASE(Recorder)
+{
+  SfcLatencyRecorder recorder;
+  Time latency;
+  Time unknown;
+
+  Simulator::Schedule(Seconds(0), [&] { recorder.OnSend(1, 3); });
+  // a retransmission keeps the first send time and chain type
+  Simulator::Schedule(MilliSeconds(1), [&] { recorder.OnSend(1, 7); });
+  Simulator::Schedule(MicroSeconds(2500), [&] {
+    latency = recorder.OnData(1);
+    unknown = recorder.OnData(2);
+  });
+  Simulator::Run();
+
+  BOOST_CHECK_EQUAL(latency, MicroSeconds(2500));
+  BOOST_CHECK(unknown.IsStrictlyNegative());
+
+  BOOST_CHECK_EQUAL(recorder.GetHistogram().GetCount(), 1u);
+  BOOST_CHECK_EQUAL(recorder.GetHistogram(3).GetCount(), 1u);
+  BOOST_CHECK_EQUAL(recorder.GetHistogram(7).GetCount(), 0u);
+  BOOST_CHECK_EQUAL(recorder.GetHistogram(3).GetMax(), MicroSeconds(2500));
+
+  SfcLatencyRecorder total;
+  total.Merge(recorder);
+  total.Merge(recorder);
+  BOOST_CHECK_EQUAL(total.GetHistogram(3).GetCount(), 2u);
+
+  std::ostringstream os;
+  os << total;
+  BOOST_CHECK_NE(os.str().find("2.500"), std::string::npos);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
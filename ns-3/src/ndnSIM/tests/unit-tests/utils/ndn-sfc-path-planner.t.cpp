@@ -0,0 +1,106 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/ndn-sfc-path-planner.hpp"
+#include "helper/ndn-app-helper.hpp"
+#include "helper/ndn-function-helper.hpp"
+
+#include "ns3/sfc-counter-store.h"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class SfcPathPlannerFixture : public ScenarioHelperWithCleanupFixture
+{
+public:
+  SfcPathPlannerFixture()
+  {
+    // routers R1-R2-R3; every other node is attached to a single router
+    createTopology({
+        {"R1", "R2"},
+        {"R2", "R3"},
+        {"C", "R1"},
+        {"P", "R3"},
+        {"F1a", "R1"},
+        {"F1b", "R3"},
+        {"F2a", "R2"},
+        {"F4a", "R3"},
+        {"F4b", "R1"}
+      });
+    FunctionHelper::InstallByNodeName({"F1", "F2", "F4"}, 'b');
+
+    AppHelper producerHelper("ns3::ndn::Producer");
+    producerHelper.SetPrefix("/prefix");
+    producerHelper.Install(getNode("P"));
+  }
+};
+
+BOOST_FIXTURE_TEST_SUITE(UtilsSfcPathPlanner, SfcPathPlannerFixture)
+
+BOOST_AUTO_TEST_CASE(Topology)
+{
+  Ptr<SfcPathPlanner> planner = SfcPathPlanner::Get();
+  BOOST_CHECK_EQUAL(planner, SfcPathPlanner::Get());
+
+  BOOST_CHECK_EQUAL(planner->GetHops(getNode("C"), getNode("P")), 2);
+  BOOST_CHECK_EQUAL(planner->GetHops(getNode("C"), getNode("F1a")), 0);
+  BOOST_CHECK_EQUAL(planner->GetHops(getNode("R2"), getNode("F1b")), 1);
+
+  BOOST_CHECK_EQUAL(SfcPathPlanner::FindProducer("/prefix/seq=1"), getNode("P"));
+  BOOST_CHECK(SfcPathPlanner::FindProducer("/other") == nullptr);
+
+  const SfcPathPlanner::ChainFunctions& functions = SfcPathPlanner::GetChainFunctions(3);
+  BOOST_CHECK_EQUAL(functions[0], 2);
+  BOOST_CHECK_EQUAL(functions[1], 1);
+  BOOST_CHECK_EQUAL(functions[2], 4);
+}
+
+BOOST_AUTO_TEST_CASE(Path)
+{
+  Ptr<SfcPathPlanner> planner = SfcPathPlanner::Get();
+  Ptr<SfcCounterStore> counters = SfcCounterStore::Get();
+
+  // chain type 1 is F1 -> F2 -> F4
+  const SfcPathPlanner::Path* path = &planner->GetPath(getNode("C"), getNode("P"), 1, 1);
+  BOOST_CHECK_EQUAL(path->functionName, "/F1a/F2a/F4a");
+  BOOST_CHECK_EQUAL(path->hops, 2);
+
+  // calls in the current window do not change the path until the window rolls over
+  for (int i = 0; i < 10; ++i) {
+    counters->IncreaseTotal(1);
+  }
+  path = &planner->GetPath(getNode("C"), getNode("P"), 1, 1);
+  BOOST_CHECK_EQUAL(path->functionName, "/F1a/F2a/F4a");
+
+  counters->SwapWindow();
+  path = &planner->GetPath(getNode("C"), getNode("P"), 1, 1);
+  BOOST_CHECK_EQUAL(path->functionName, "/F1b/F2a/F4a");
+  BOOST_CHECK_EQUAL(path->hops, 4);
+
+  // without weight, only hops count
+  path = &planner->GetPath(getNode("C"), getNode("P"), 1, 0);
+  BOOST_CHECK_EQUAL(path->functionName, "/F1a/F2a/F4a");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,132 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/tracers/ndn-sfc-data-tracer.hpp"
+#include "helper/ndn-function-helper.hpp"
+
+#include "ns3/ndnSIM/NFD/daemon/fw/forwarder.hpp"
+
+#include <ndn-cxx/lp/tags.hpp>
+
+#include <boost/filesystem.hpp>
+
+#include <fstream>
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+const boost::filesystem::path TEST_SFC_TRACE = boost::filesystem::path(TEST_CONFIG_PATH) / "sfc-trace.bin";
+
+class SfcDataTracerFixture : public ScenarioHelperWithCleanupFixture
+{
+public:
+  SfcDataTracerFixture()
+  {
+    boost::filesystem::create_directories(TEST_CONFIG_PATH);
+
+    createTopology({
+        {"A", "F1b"}
+      });
+    FunctionHelper::Install(getNode("F1b"), "F1", 'b');
+  }
+
+  ~SfcDataTracerFixture()
+  {
+    boost::filesystem::remove(TEST_SFC_TRACE);
+    SfcDataTracer::Destroy(); // additional cleanup
+  }
+
+  void
+  receiveData(const std::string& node, const std::string& from, shared_ptr<Data> data)
+  {
+    getNode(node)->GetObject<L3Protocol>()->getForwarder()
+      ->startProcessData(*getFace(node, from), *data);
+  }
+};
+
+BOOST_FIXTURE_TEST_SUITE(UtilsTracersNdnSfcDataTracer, SfcDataTracerFixture)
+
+BOOST_AUTO_TEST_CASE(InstallAll)
+{
+  SfcDataTracer::InstallAll(TEST_SFC_TRACE.string());
+
+  auto tagged = make_shared<Data>("/prefix/1");
+  tagged->setTag(make_shared<lp::CountTag>(7));
+  tagged->setTag(make_shared<lp::PartialHopTag>(2));
+  receiveData("A", "F1b", tagged);
+  receiveData("F1b", "A", make_shared<Data>("/prefix/2"));
+
+  SfcDataTracer::Destroy(); // to force the records to be written
+
+  std::ifstream is(TEST_SFC_TRACE.string().c_str(), std::ios_base::binary);
+  std::vector<SfcDataTracer::Record> records = SfcDataTracer::Read(is);
+  BOOST_REQUIRE_EQUAL(records.size(), 2u);
+
+  BOOST_CHECK_EQUAL(records[0].time, Time(0));
+  BOOST_CHECK_EQUAL(records[0].nodeId, getNode("A")->GetId());
+  BOOST_CHECK_EQUAL(records[0].counterIndex, 0u);
+  BOOST_CHECK_EQUAL(records[0].functionCount, 7);
+  BOOST_CHECK_EQUAL(records[0].hopCount, 2);
+
+  // F1b is instance 2 of the default catalog
+  BOOST_CHECK_EQUAL(records[1].nodeId, getNode("F1b")->GetId());
+  BOOST_CHECK_EQUAL(records[1].counterIndex, 2u);
+  BOOST_CHECK_EQUAL(records[1].functionCount, -1);
+  BOOST_CHECK_EQUAL(records[1].hopCount, -1);
+}
+
+BOOST_AUTO_TEST_CASE(SeveralInstances)
+{
+  FunctionHelper::Install(getNode("F1b"), "F2", 'a');
+  SfcDataTracer::Install(getNode("F1b"), TEST_SFC_TRACE.string());
+
+  // the instance is the hosted one named by the Data, none without a name
+  auto named = make_shared<Data>("/prefix/1");
+  named->setTag(make_shared<lp::FunctionNameTag>(Name("/F3c/F2a/F1a")));
+  receiveData("F1b", "A", named);
+  receiveData("F1b", "A", make_shared<Data>("/prefix/2"));
+
+  SfcDataTracer::Destroy();
+
+  std::ifstream is(TEST_SFC_TRACE.string().c_str(), std::ios_base::binary);
+  std::vector<SfcDataTracer::Record> records = SfcDataTracer::Read(is);
+  BOOST_REQUIRE_EQUAL(records.size(), 2u);
+  BOOST_CHECK_EQUAL(records[0].counterIndex, 4u); // F2a
+  BOOST_CHECK_EQUAL(records[1].counterIndex, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(NoSink)
+{
+  // without a tracer, Data are processed without any output
+  SfcDataTracer::Install(getNode("A"), TEST_SFC_TRACE.string());
+  receiveData("F1b", "A", make_shared<Data>("/prefix/1"));
+
+  SfcDataTracer::Destroy();
+
+  std::ifstream is(TEST_SFC_TRACE.string().c_str(), std::ios_base::binary);
+  BOOST_CHECK_EQUAL(SfcDataTracer::Read(is).size(), 0u);
+  BOOST_CHECK_EQUAL(boost::filesystem::file_size(TEST_SFC_TRACE), 8u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,137 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-latency-histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace ns3 {
+namespace ndn {
+
+static const uint64_t SUB_BUCKET_COUNT = uint64_t(1) << LatencyHistogram::SUB_BUCKET_BITS;
+static const uint64_t SUB_BUCKET_HALF_COUNT = SUB_BUCKET_COUNT / 2;
+
+LatencyHistogram::LatencyHistogram()
+  : m_count(0)
+  , m_min(std::numeric_limits<uint64_t>::max())
+  , m_max(0)
+  , m_sum(0)
+{
+}
+
+size_t
+LatencyHistogram::GetIndex(uint64_t value)
+{
+  if (value < SUB_BUCKET_COUNT) {
+    return value;
+  }
+
+  // value is in [2^(b + SUB_BUCKET_BITS - 1), 2^(b + SUB_BUCKET_BITS)) for bucket b >= 1
+  int highestBit = 63 - __builtin_clzll(value);
+  int bucket = highestBit - (SUB_BUCKET_BITS - 1);
+  return bucket * SUB_BUCKET_HALF_COUNT + (value >> bucket);
+}
+
+uint64_t
+LatencyHistogram::GetHighestEquivalentValue(size_t index)
+{
+  if (index < SUB_BUCKET_COUNT) {
+    return index;
+  }
+
+  int bucket = index / SUB_BUCKET_HALF_COUNT - 1;
+  uint64_t subBucket = index - bucket * SUB_BUCKET_HALF_COUNT;
+  return ((subBucket + 1) << bucket) - 1;
+}
+
+void
+LatencyHistogram::Record(Time latency)
+{
+  uint64_t value = latency.IsStrictlyNegative() ? 0 : latency.GetNanoSeconds();
+
+  size_t index = GetIndex(value);
+  if (index >= m_counts.size()) {
+    m_counts.resize(index + 1, 0);
+  }
+  ++m_counts[index];
+
+  ++m_count;
+  m_min = std::min(m_min, value);
+  m_max = std::max(m_max, value);
+  m_sum += value;
+}
+
+void
+LatencyHistogram::Merge(const LatencyHistogram& other)
+{
+  if (other.m_counts.size() > m_counts.size()) {
+    m_counts.resize(other.m_counts.size(), 0);
+  }
+  for (size_t i = 0; i < other.m_counts.size(); ++i) {
+    m_counts[i] += other.m_counts[i];
+  }
+
+  m_count += other.m_count;
+  m_min = std::min(m_min, other.m_min);
+  m_max = std::max(m_max, other.m_max);
+  m_sum += other.m_sum;
+}
+
+Time
+LatencyHistogram::GetMin() const
+{
+  return m_count == 0 ? Time(0) : NanoSeconds(m_min);
+}
+
+Time
+LatencyHistogram::GetMax() const
+{
+  return NanoSeconds(m_max);
+}
+
+Time
+LatencyHistogram::GetMean() const
+{
+  return m_count == 0 ? Time(0) : NanoSeconds(static_cast<int64_t>(m_sum / m_count));
+}
+
+Time
+LatencyHistogram::GetPercentile(double percentile) const
+{
+  if (m_count == 0) {
+    return Time(0);
+  }
+
+  percentile = std::min(std::max(percentile, 0.0), 100.0);
+  uint64_t rank = std::max<uint64_t>(1, std::ceil(percentile / 100 * m_count));
+
+  uint64_t seen = 0;
+  for (size_t i = 0; i < m_counts.size(); ++i) {
+    seen += m_counts[i];
+    if (seen >= rank) {
+      return NanoSeconds(std::min(GetHighestEquivalentValue(i), m_max));
+    }
+  }
+  return NanoSeconds(m_max);
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,111 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDNSIM_UTILS_NDN_LATENCY_HISTOGRAM_HPP
+#define NDNSIM_UTILS_NDN_LATENCY_HISTOGRAM_HPP
+
+#include "ns3/nstime.h"
+
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-apps
+ * @brief Streaming histogram of latencies with logarithmic buckets
+ *
+ * Latencies are counted in nanoseconds into HDR-style buckets: values below 2^SUB_BUCKET_BITS
+ * have their own bucket, and every larger power-of-two range is split into
+ * 2^(SUB_BUCKET_BITS - 1) linear sub-buckets.  A percentile is therefore reported with a relative
+ * error below 2^-(SUB_BUCKET_BITS - 1), whatever the range of the latencies, while recording
+ * takes constant time and memory grows only with the logarithm of the largest latency.
+ */
+class LatencyHistogram {
+public:
+  /**
+   * @brief Precision of the buckets, 7 bits for a relative error below 1/64
+   */
+  static const int SUB_BUCKET_BITS = 7;
+
+  LatencyHistogram();
+
+  /**
+   * @brief Count one latency; negative latencies are counted as zero
+   */
+  void
+  Record(Time latency);
+
+  /**
+   * @brief Add the counts of @p other to this histogram
+   */
+  void
+  Merge(const LatencyHistogram& other);
+
+  uint64_t
+  GetCount() const
+  {
+    return m_count;
+  }
+
+  /**
+   * @return the smallest recorded latency, or zero if none is recorded
+   */
+  Time
+  GetMin() const;
+
+  /**
+   * @return the largest recorded latency, or zero if none is recorded
+   */
+  Time
+  GetMax() const;
+
+  /**
+   * @return the mean of the recorded latencies, or zero if none is recorded
+   */
+  Time
+  GetMean() const;
+
+  /**
+   * @brief Get the latency at or below which @p percentile percent of the latencies lie
+   * @param percentile from 0 to 100
+   * @return the upper bound of the bucket holding that latency, at most GetMax()
+   */
+  Time
+  GetPercentile(double percentile) const;
+
+private:
+  static size_t
+  GetIndex(uint64_t value);
+
+  static uint64_t
+  GetHighestEquivalentValue(size_t index);
+
+private:
+  std::vector<uint64_t> m_counts; ///< @brief counts, by bucket index
+  uint64_t m_count;
+  uint64_t m_min;       ///< @brief in nanoseconds
+  uint64_t m_max;       ///< @brief in nanoseconds
+  long double m_sum;    ///< @brief in nanoseconds
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDNSIM_UTILS_NDN_LATENCY_HISTOGRAM_HPP
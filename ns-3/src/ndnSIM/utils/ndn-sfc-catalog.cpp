@@ -0,0 +1,294 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-sfc-catalog.hpp"
+
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/simulator-singleton.h"
+#include "ns3/sfc-counter-store.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+NS_LOG_COMPONENT_DEFINE("ndn.SfcCatalog");
+
+namespace ns3 {
+namespace ndn {
+
+NS_OBJECT_ENSURE_REGISTERED(SfcCatalog);
+
+TypeId
+SfcCatalog::GetTypeId()
+{
+  static TypeId tid = TypeId("ns3::ndn::SfcCatalog")
+    .SetGroupName("Ndn")
+    .SetParent<Object>()
+    .AddConstructor<SfcCatalog>();
+  return tid;
+}
+
+SfcCatalog::SfcCatalog()
+{
+  SetDefault();
+}
+
+Ptr<SfcCatalog>
+SfcCatalog::Get()
+{
+  return SimulatorSingleton<SfcCatalog>::Get();
+}
+
+void
+SfcCatalog::LoadFile(const std::string& fileName)
+{
+  std::ifstream is(fileName);
+  if (!is) {
+    NS_FATAL_ERROR("Cannot open SFC catalog " << fileName);
+  }
+
+  Ptr<SfcCatalog> catalog = Get();
+  catalog->Load(is, fileName);
+
+  Ptr<SfcCounterStore> counters = SfcCounterStore::Get();
+  if (counters->GetInstanceCount() < catalog->GetInstanceCount()) {
+    counters->SetInstanceCount(catalog->GetInstanceCount());
+  }
+}
+
+void
+SfcCatalog::Load(std::istream& is, const std::string& source)
+{
+  Clear();
+
+  std::string line;
+  for (int lineNo = 1; std::getline(is, line); ++lineNo) {
+    line = line.substr(0, line.find('#'));
+    std::istringstream fields(line);
+    std::string keyword;
+    if (!(fields >> keyword)) {
+      continue;
+    }
+
+    if (keyword == "function") {
+      std::string name;
+      uint32_t nInstances = 0;
+      if (!(fields >> name >> nInstances)) {
+        NS_FATAL_ERROR(source << ":" << lineNo << ": expecting 'function <name> <instances>'");
+      }
+      AddFunction(name, nInstances);
+    }
+    else if (keyword == "chain") {
+      double weight = 0;
+      std::vector<std::string> functions;
+      std::string function;
+      if (!(fields >> weight)) {
+        NS_FATAL_ERROR(source << ":" << lineNo << ": expecting 'chain <weight> <function>...'");
+      }
+      while (fields >> function) {
+        functions.push_back(function);
+      }
+      AddChain(functions, weight);
+    }
+    else {
+      NS_FATAL_ERROR(source << ":" << lineNo << ": unknown entry '" << keyword << "'");
+    }
+  }
+
+  if (m_chains.empty()) {
+    NS_FATAL_ERROR(source << ": no chain is defined");
+  }
+  NS_LOG_DEBUG("Loaded " << m_functions.size() << " functions, " << m_nInstances
+               << " instances and " << m_chains.size() << " chains from " << source);
+}
+
+void
+SfcCatalog::Clear()
+{
+  m_functions.clear();
+  m_functionIndex.clear();
+  m_nInstances = 0;
+  m_chains.clear();
+  m_cumulativeWeights.clear();
+  m_hasEqualWeights = true;
+}
+
+uint32_t
+SfcCatalog::AddFunction(const std::string& name, uint32_t nInstances)
+{
+  if (nInstances < 1 || nInstances > MAX_INSTANCE_COUNT) {
+    NS_FATAL_ERROR("Function " << name << " must have 1 to " << MAX_INSTANCE_COUNT
+                   << " instances");
+  }
+  if (!m_functionIndex.emplace(name, m_functions.size()).second) {
+    NS_FATAL_ERROR("Function " << name << " is defined twice");
+  }
+
+  Function function;
+  function.name = name;
+  function.firstCounterIndex = m_nInstances + 1;
+  for (uint32_t i = 0; i < nInstances; ++i) {
+    function.instances.push_back(name + static_cast<char>('a' + i));
+  }
+  m_functions.push_back(function);
+  m_nInstances += nInstances;
+  return m_functions.size() - 1;
+}
+
+uint32_t
+SfcCatalog::AddChain(const std::vector<std::string>& functions, double weight)
+{
+  if (functions.empty()) {
+    NS_FATAL_ERROR("A chain must have at least one function");
+  }
+  if (!(weight > 0)) {
+    NS_FATAL_ERROR("The weight of a chain must be positive");
+  }
+
+  Chain chain;
+  chain.weight = weight;
+  for (const std::string& name : functions) {
+    int function = FindFunction(name);
+    if (function < 0) {
+      NS_FATAL_ERROR("Function " << name << " of a chain is not defined");
+    }
+    chain.functions.push_back(function);
+  }
+
+  if (!m_chains.empty() && weight != m_chains.front().weight) {
+    m_hasEqualWeights = false;
+  }
+  m_cumulativeWeights.push_back((m_cumulativeWeights.empty() ? 0 : m_cumulativeWeights.back()) +
+                                weight);
+  m_chains.push_back(chain);
+  return m_chains.size();
+}
+
+uint32_t
+SfcCatalog::GetNFunctions() const
+{
+  return m_functions.size();
+}
+
+const SfcCatalog::Function&
+SfcCatalog::GetFunction(uint32_t index) const
+{
+  NS_ASSERT_MSG(index < m_functions.size(), "Unknown function index " << index);
+  return m_functions[index];
+}
+
+int
+SfcCatalog::FindFunction(const std::string& name) const
+{
+  auto function = m_functionIndex.find(name);
+  return function == m_functionIndex.end() ? -1 : static_cast<int>(function->second);
+}
+
+bool
+SfcCatalog::FindInstance(const std::string& instanceName, uint32_t& function,
+                         uint32_t& instance) const
+{
+  size_t begin = !instanceName.empty() && instanceName[0] == '/' ? 1 : 0;
+  if (instanceName.size() < begin + 2) {
+    return false;
+  }
+
+  int index = FindFunction(instanceName.substr(begin, instanceName.size() - begin - 1));
+  if (index < 0) {
+    return false;
+  }
+  uint32_t letter = instanceName.back() - 'a';
+  if (letter >= m_functions[index].instances.size()) {
+    return false;
+  }
+
+  function = index;
+  instance = letter;
+  return true;
+}
+
+uint32_t
+SfcCatalog::GetInstanceCount() const
+{
+  return m_nInstances;
+}
+
+uint32_t
+SfcCatalog::GetCounterIndex(const std::string& name, int instance) const
+{
+  int index = FindFunction(name);
+  if (index < 0 || instance < 0 ||
+      static_cast<size_t>(instance) >= m_functions[index].instances.size()) {
+    return 0;
+  }
+  return m_functions[index].firstCounterIndex + instance;
+}
+
+uint32_t
+SfcCatalog::GetNChainTypes() const
+{
+  return m_chains.size();
+}
+
+const SfcCatalog::Chain&
+SfcCatalog::GetChain(uint32_t chainType) const
+{
+  NS_ASSERT_MSG(1 <= chainType && chainType <= m_chains.size(),
+                "Unknown chain type " << chainType);
+  return m_chains[chainType - 1];
+}
+
+uint32_t
+SfcCatalog::DrawChainType(uint32_t word) const
+{
+  NS_ASSERT_MSG(!m_chains.empty(), "The catalog has no chain");
+  if (m_hasEqualWeights) {
+    return word % m_chains.size() + 1;
+  }
+
+  double point = word / 4294967296.0 * m_cumulativeWeights.back();
+  auto chain = std::upper_bound(m_cumulativeWeights.begin(), m_cumulativeWeights.end(), point);
+  if (chain == m_cumulativeWeights.end()) {
+    --chain;
+  }
+  return chain - m_cumulativeWeights.begin() + 1;
+}
+
+void
+SfcCatalog::SetDefault()
+{
+  Clear();
+  for (const char* name : {"F1", "F2", "F3", "F4", "F5"}) {
+    AddFunction(name, 3);
+  }
+
+  // chain types 1 to 12 of the SFC scenarios
+  static const char* CHAINS[][3] = {
+    {"F1", "F2", "F4"}, {"F1", "F2", "F5"}, {"F2", "F1", "F4"}, {"F2", "F1", "F5"},
+    {"F1", "F3", "F4"}, {"F1", "F3", "F5"}, {"F3", "F1", "F4"}, {"F3", "F1", "F5"},
+    {"F2", "F3", "F4"}, {"F2", "F3", "F5"}, {"F3", "F2", "F4"}, {"F3", "F2", "F5"},
+  };
+  for (const auto& chain : CHAINS) {
+    AddChain({chain[0], chain[1], chain[2]});
+  }
+}
+
+} // namespace ndn
+} // namespace ns3
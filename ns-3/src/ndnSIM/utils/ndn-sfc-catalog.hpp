@@ -0,0 +1,200 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDNSIM_UTILS_NDN_SFC_CATALOG_HPP
+#define NDNSIM_UTILS_NDN_SFC_CATALOG_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ns3/object.h"
+#include "ns3/ptr.h"
+
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-apps
+ * @brief Service functions, their instances and the chains requested by the consumers
+ *
+ * Instances of a function are named after the function and a letter, e.g. "F1a", "F1b".  They
+ * are numbered from 1 across all functions in catalog order, which is the numbering of
+ * ns3::SfcCounterStore: with the default catalog, F1a = 1, ..., F5c = 15.  Chain types are
+ * numbered from 1 in catalog order, and each chain type is requested with a probability
+ * proportional to its weight.
+ *
+ * The default catalog holds functions F1 to F5 with 3 instances each, and the 12 chains of the
+ * SFC scenarios with equal weights.  A catalog can be read from a file with one entry per line,
+ * fields separated by spaces, and comments starting with '#':
+ *
+ *     # function <name> <number of instances>
+ *     function F1 3
+ *     function F2 3
+ *     # chain <weight> <function> <function> ...
+ *     chain 2 F1 F2
+ *     chain 1 F2 F1
+ *
+ * The catalog is read by consumers, forwarders and function instances, so it should be loaded
+ * before FunctionHelper installs the instances.
+ */
+class SfcCatalog : public Object {
+public:
+  /**
+   * @brief Maximum number of instances of a function, one per instance letter
+   */
+  static const uint32_t MAX_INSTANCE_COUNT = 26;
+
+  struct Function {
+    std::string name;                   ///< e.g. "F1"
+    std::vector<std::string> instances; ///< instance names, e.g. "F1a"
+    uint32_t firstCounterIndex;         ///< instance number of the first instance
+  };
+
+  struct Chain {
+    std::vector<uint32_t> functions; ///< function indices, in chain order
+    double weight;                   ///< relative request rate
+  };
+
+  static TypeId
+  GetTypeId();
+
+  /**
+   * @brief Create the default catalog
+   */
+  SfcCatalog();
+
+  /**
+   * @brief Get the catalog of the running simulation, creating the default one if needed
+   *
+   * The catalog is aggregated to the simulator implementation, so Simulator::Destroy restores
+   * the default catalog.  It is looked up once per simulation and cached until then.
+   */
+  static Ptr<SfcCatalog>
+  Get();
+
+  /**
+   * @brief Replace the catalog of the running simulation by the one in file @p fileName
+   */
+  static void
+  LoadFile(const std::string& fileName);
+
+  /**
+   * @brief Replace the content of this catalog by the one read from @p is
+   * @param source name of the input, used in error messages
+   */
+  void
+  Load(std::istream& is, const std::string& source = "input");
+
+  /**
+   * @brief Remove all functions and chains
+   */
+  void
+  Clear();
+
+  /**
+   * @brief Add function @p name with @p nInstances instances
+   * @return index of the function
+   */
+  uint32_t
+  AddFunction(const std::string& name, uint32_t nInstances);
+
+  /**
+   * @brief Add a chain of the functions named @p functions, requested with weight @p weight
+   * @return chain type of the chain
+   */
+  uint32_t
+  AddChain(const std::vector<std::string>& functions, double weight = 1.0);
+
+  uint32_t
+  GetNFunctions() const;
+
+  const Function&
+  GetFunction(uint32_t index) const;
+
+  /**
+   * @return index of function @p name, or -1 if it is not in the catalog
+   */
+  int
+  FindFunction(const std::string& name) const;
+
+  /**
+   * @brief Find instance @p instanceName, e.g. "F2b", or "/F2b"
+   * @param[out] function index of the function of the instance
+   * @param[out] instance index of the instance among instances of the function
+   * @return whether the instance is in the catalog
+   */
+  bool
+  FindInstance(const std::string& instanceName, uint32_t& function, uint32_t& instance) const;
+
+  /**
+   * @return total number of instances of all functions
+   */
+  uint32_t
+  GetInstanceCount() const;
+
+  /**
+   * @return instance number of instance @p instance of function @p name, or 0 if unknown
+   */
+  uint32_t
+  GetCounterIndex(const std::string& name, int instance) const;
+
+  /**
+   * @return number of chain types
+   */
+  uint32_t
+  GetNChainTypes() const;
+
+  /**
+   * @brief Get chain type @p chainType, numbered from 1
+   */
+  const Chain&
+  GetChain(uint32_t chainType) const;
+
+  /**
+   * @brief Draw a chain type according to the chain weights
+   * @param word uniformly distributed 32-bit random value
+   *
+   * With equal weights, the chain type is word % GetNChainTypes() + 1, as drawn by the consumers
+   * before the catalog existed.
+   */
+  uint32_t
+  DrawChainType(uint32_t word) const;
+
+private:
+  void
+  SetDefault();
+
+private:
+  std::vector<Function> m_functions;
+  std::map<std::string, uint32_t> m_functionIndex; ///< function indices, by name
+  uint32_t m_nInstances;
+
+  std::vector<Chain> m_chains;
+  std::vector<double> m_cumulativeWeights; ///< sum of weights of chain types 1 to i + 1
+  bool m_hasEqualWeights;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDNSIM_UTILS_NDN_SFC_CATALOG_HPP
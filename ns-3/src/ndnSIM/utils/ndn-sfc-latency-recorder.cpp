@@ -0,0 +1,124 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-sfc-latency-recorder.hpp"
+
+#include "ns3/ndnSIM/apps/ndn-consumer.hpp"
+
+#include "ns3/node-list.h"
+#include "ns3/simulator.h"
+
+#include <iomanip>
+
+namespace ns3 {
+namespace ndn {
+
+void
+SfcLatencyRecorder::OnSend(uint32_t seq, uint32_t chainType)
+{
+  m_pending.insert(std::make_pair(seq, Request{Simulator::Now(), chainType}));
+}
+
+Time
+SfcLatencyRecorder::OnData(uint32_t seq)
+{
+  auto request = m_pending.find(seq);
+  if (request == m_pending.end()) {
+    return Time(-1);
+  }
+
+  Time latency = Simulator::Now() - request->second.sendTime;
+  uint32_t chainType = request->second.chainType;
+  m_pending.erase(request);
+
+  if (chainType >= m_byChainType.size()) {
+    m_byChainType.resize(chainType + 1);
+  }
+  m_byChainType[chainType].Record(latency);
+  m_all.Record(latency);
+  return latency;
+}
+
+void
+SfcLatencyRecorder::Merge(const SfcLatencyRecorder& other)
+{
+  if (other.m_byChainType.size() > m_byChainType.size()) {
+    m_byChainType.resize(other.m_byChainType.size());
+  }
+  for (size_t chainType = 0; chainType < other.m_byChainType.size(); ++chainType) {
+    m_byChainType[chainType].Merge(other.m_byChainType[chainType]);
+  }
+  m_all.Merge(other.m_all);
+}
+
+const LatencyHistogram&
+SfcLatencyRecorder::GetHistogram(uint32_t chainType) const
+{
+  static const LatencyHistogram empty;
+  return chainType < m_byChainType.size() ? m_byChainType[chainType] : empty;
+}
+
+static void
+printRow(std::ostream& os, const std::string& label, const LatencyHistogram& histogram)
+{
+  os << std::setw(6) << label << std::setw(10) << histogram.GetCount();
+  for (double percentile : {50.0, 95.0, 99.0, 100.0}) {
+    os << std::setw(12) << histogram.GetPercentile(percentile).GetMicroSeconds() / 1000.0;
+  }
+  os << "\n";
+}
+
+void
+SfcLatencyRecorder::Print(std::ostream& os) const
+{
+  std::ios::fmtflags flags = os.flags();
+  std::streamsize precision = os.precision();
+  os << std::fixed << std::setprecision(3);
+
+  os << std::setw(6) << "Chain" << std::setw(10) << "Count" << std::setw(12) << "p50(ms)"
+     << std::setw(12) << "p95(ms)" << std::setw(12) << "p99(ms)" << std::setw(12) << "max(ms)"
+     << "\n";
+  for (size_t chainType = 0; chainType < m_byChainType.size(); ++chainType) {
+    if (m_byChainType[chainType].GetCount() > 0) {
+      printRow(os, std::to_string(chainType), m_byChainType[chainType]);
+    }
+  }
+  printRow(os, "all", m_all);
+
+  os.flags(flags);
+  os.precision(precision);
+}
+
+SfcLatencyRecorder
+SfcLatencyRecorder::Collect()
+{
+  SfcLatencyRecorder total;
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); ++node) {
+    for (uint32_t i = 0; i < (*node)->GetNApplications(); ++i) {
+      Ptr<Consumer> consumer = DynamicCast<Consumer>((*node)->GetApplication(i));
+      if (consumer != nullptr) {
+        total.Merge(consumer->GetLatencyRecorder());
+      }
+    }
+  }
+  return total;
+}
+
+} // namespace ndn
+} // namespace ns3
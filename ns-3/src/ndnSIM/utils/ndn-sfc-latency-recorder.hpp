@@ -0,0 +1,115 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDNSIM_UTILS_NDN_SFC_LATENCY_RECORDER_HPP
+#define NDNSIM_UTILS_NDN_SFC_LATENCY_RECORDER_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+#include "ns3/ndnSIM/utils/ndn-latency-histogram.hpp"
+
+#include "ns3/nstime.h"
+
+#include <iostream>
+#include <map>
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-apps
+ * @brief Service latency of the chains requested by a consumer, in simulated time
+ *
+ * The latency of a request is the simulated time from the first Interest for a sequence number
+ * to the Data satisfying it, so retransmissions are included.  Latencies are kept in one
+ * LatencyHistogram per chain type and in one for all types, which gives percentiles with a
+ * resolution well below one millisecond at any simulation length.
+ */
+class SfcLatencyRecorder {
+public:
+  /**
+   * @brief Note that an Interest for @p seq, requesting chain type @p chainType, is sent now
+   *
+   * A retransmission keeps the send time and chain type of the first Interest.
+   */
+  void
+  OnSend(uint32_t seq, uint32_t chainType);
+
+  /**
+   * @brief Note that Data for @p seq is received now, and record its latency
+   * @return the latency, or a negative time if no Interest for @p seq is pending
+   */
+  Time
+  OnData(uint32_t seq);
+
+  /**
+   * @brief Add the latencies of @p other to this recorder
+   */
+  void
+  Merge(const SfcLatencyRecorder& other);
+
+  /**
+   * @return the latencies of all chain types
+   */
+  const LatencyHistogram&
+  GetHistogram() const
+  {
+    return m_all;
+  }
+
+  /**
+   * @return the latencies of chain type @p chainType
+   */
+  const LatencyHistogram&
+  GetHistogram(uint32_t chainType) const;
+
+  /**
+   * @brief Write count, p50, p95, p99 and max in milliseconds, one line per chain type
+   */
+  void
+  Print(std::ostream& os) const;
+
+  /**
+   * @brief Merge the recorders of all ndn::Consumer applications in the simulation
+   */
+  static SfcLatencyRecorder
+  Collect();
+
+private:
+  struct Request {
+    Time sendTime;
+    uint32_t chainType;
+  };
+
+  std::map<uint32_t, Request> m_pending; ///< @brief requests waiting for Data, by sequence number
+  std::vector<LatencyHistogram> m_byChainType; ///< @brief indexed by chain type
+  LatencyHistogram m_all;
+};
+
+inline std::ostream&
+operator<<(std::ostream& os, const SfcLatencyRecorder& recorder)
+{
+  recorder.Print(os);
+  return os;
+}
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDNSIM_UTILS_NDN_SFC_LATENCY_RECORDER_HPP
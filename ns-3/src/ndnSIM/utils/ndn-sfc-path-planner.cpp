@@ -0,0 +1,325 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-sfc-path-planner.hpp"
+#include "ndn-sfc-catalog.hpp"
+
+#include "model/ndn-l3-protocol.hpp"
+#include "apps/ndn-producer.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/forwarder.hpp"
+
+#include "ns3/log.h"
+#include "ns3/channel.h"
+#include "ns3/net-device.h"
+#include "ns3/node-list.h"
+#include "ns3/simulator.h"
+#include "ns3/simulator-singleton.h"
+#include "ns3/sfc-counter-store.h"
+
+#include <algorithm>
+#include <deque>
+#include <limits>
+
+NS_LOG_COMPONENT_DEFINE("ndn.SfcPathPlanner");
+
+namespace ns3 {
+namespace ndn {
+
+NS_OBJECT_ENSURE_REGISTERED(SfcPathPlanner);
+
+TypeId
+SfcPathPlanner::GetTypeId()
+{
+  static TypeId tid = TypeId("ns3::ndn::SfcPathPlanner")
+    .SetGroupName("Ndn")
+    .SetParent<Object>()
+    .AddConstructor<SfcPathPlanner>();
+  return tid;
+}
+
+SfcPathPlanner::SfcPathPlanner()
+  : m_isTopologyBuilt(false)
+  , m_loadVersion(0)
+  , m_loadGeneration(0)
+  , m_loadWeight(0)
+{
+}
+
+Ptr<SfcPathPlanner>
+SfcPathPlanner::Get()
+{
+  return SimulatorSingleton<SfcPathPlanner>::Get();
+}
+
+Ptr<Node>
+SfcPathPlanner::FindProducer(const Name& name)
+{
+  Ptr<Node> producerNode;
+  size_t prefixSize = 0;
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); ++node) {
+    for (uint32_t i = 0; i < (*node)->GetNApplications(); ++i) {
+      Ptr<Producer> producer = DynamicCast<Producer>((*node)->GetApplication(i));
+      if (producer == nullptr) {
+        continue;
+      }
+
+      NameValue prefix;
+      producer->GetAttribute("Prefix", prefix);
+      if (prefix.Get().isPrefixOf(name) &&
+          (producerNode == nullptr || prefix.Get().size() > prefixSize)) {
+        producerNode = *node;
+        prefixSize = prefix.Get().size();
+      }
+    }
+  }
+  return producerNode;
+}
+
+const SfcPathPlanner::Path&
+SfcPathPlanner::GetPath(Ptr<Node> consumer, Ptr<Node> producer, uint32_t chainType, double weight)
+{
+  UpdateLoad(weight);
+
+  LayeredGraph& graph = GetGraph(consumer, producer, chainType);
+  if (graph.loadVersion != m_loadVersion) {
+    Plan(graph);
+    graph.loadVersion = m_loadVersion;
+  }
+  return graph.path;
+}
+
+int
+SfcPathPlanner::GetHops(Ptr<Node> from, Ptr<Node> to)
+{
+  BuildTopology();
+
+  int hops = GetHopsFrom(GetAccessRouter(from->GetId()))[GetAccessRouter(to->GetId())];
+  NS_ASSERT_MSG(hops >= 0, "Node " << to->GetId() << " is unreachable from node " << from->GetId());
+  return hops;
+}
+
+void
+SfcPathPlanner::BuildTopology()
+{
+  if (m_isTopologyBuilt) {
+    return;
+  }
+  m_isTopologyBuilt = true;
+
+  Ptr<SfcCatalog> catalog = SfcCatalog::Get();
+  m_sites.resize(catalog->GetNFunctions());
+  m_neighbors.resize(NodeList::GetNNodes());
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); ++node) {
+    std::vector<uint32_t>& neighbors = m_neighbors[(*node)->GetId()];
+    for (uint32_t i = 0; i < (*node)->GetNDevices(); ++i) {
+      Ptr<Channel> channel = (*node)->GetDevice(i)->GetChannel();
+      if (channel == nullptr) {
+        continue;
+      }
+      for (uint32_t j = 0; j < channel->GetNDevices(); ++j) {
+        Ptr<Node> peer = channel->GetDevice(j)->GetNode();
+        if (peer != *node) {
+          neighbors.push_back(peer->GetId());
+        }
+      }
+    }
+
+    Ptr<L3Protocol> l3Protocol = (*node)->GetObject<L3Protocol>();
+    if (l3Protocol == nullptr) {
+      continue;
+    }
+    for (const nfd::fw::FunctionInstance& fi :
+         l3Protocol->getForwarder()->getFunctionInstanceRegistry()) {
+      int function = catalog->FindFunction(::ndn::FunctionChain::toString(fi.function));
+      if (function < 0 || fi.counterIndex == 0) {
+        continue;
+      }
+      m_sites[function].push_back(
+        {*node, fi.counterIndex, "/" + ::ndn::FunctionChain::toString(fi.instance)});
+    }
+  }
+
+  for (std::vector<Site>& sites : m_sites) {
+    std::sort(sites.begin(), sites.end(), [] (const Site& a, const Site& b) {
+        return a.counterIndex < b.counterIndex;
+      });
+  }
+}
+
+void
+SfcPathPlanner::UpdateLoad(double weight)
+{
+  Ptr<SfcCounterStore> counters = SfcCounterStore::Get();
+  if (m_loadVersion > 0 && counters->GetGeneration() == m_loadGeneration &&
+      weight == m_loadWeight) {
+    return;
+  }
+
+  m_load.resize(counters->GetInstanceCount());
+  for (uint32_t i = 0; i < m_load.size(); ++i) {
+    m_load[i] = counters->GetSnapshot(i + 1) * weight;
+  }
+  m_loadGeneration = counters->GetGeneration();
+  m_loadWeight = weight;
+  ++m_loadVersion;
+}
+
+SfcPathPlanner::LayeredGraph&
+SfcPathPlanner::GetGraph(Ptr<Node> consumer, Ptr<Node> producer, uint32_t chainType)
+{
+  GraphKey key(consumer->GetId(), producer->GetId(), chainType);
+  auto graph = m_graphs.find(key);
+  if (graph != m_graphs.end()) {
+    return graph->second;
+  }
+
+  BuildTopology();
+
+  LayeredGraph& newGraph = m_graphs[key];
+  newGraph.loadVersion = 0;
+
+  Ptr<SfcCatalog> catalog = SfcCatalog::Get();
+  const std::vector<uint32_t>& functions = catalog->GetChain(chainType).functions;
+  newGraph.layers.resize(functions.size());
+  newGraph.transitHops.resize(functions.size() - 1);
+  for (size_t k = 0; k < functions.size(); ++k) {
+    uint32_t function = functions[k];
+    if (function >= m_sites.size() || m_sites[function].empty()) {
+      NS_FATAL_ERROR("No instance of function " << catalog->GetFunction(function).name
+                     << " is installed");
+    }
+    for (const Site& site : m_sites[function]) {
+      newGraph.layers[k].push_back(&site);
+    }
+  }
+
+  for (const Site* site : newGraph.layers.front()) {
+    newGraph.entryHops.push_back(GetHops(consumer, site->node));
+  }
+  for (size_t k = 0; k + 1 < newGraph.layers.size(); ++k) {
+    for (const Site* from : newGraph.layers[k]) {
+      for (const Site* to : newGraph.layers[k + 1]) {
+        newGraph.transitHops[k].push_back(GetHops(from->node, to->node));
+      }
+    }
+  }
+  for (const Site* site : newGraph.layers.back()) {
+    newGraph.exitHops.push_back(GetHops(site->node, producer));
+  }
+
+  NS_LOG_DEBUG("Layered graph of chain type " << chainType << " from node " << consumer->GetId()
+               << " to node " << producer->GetId() << " is built");
+  return newGraph;
+}
+
+void
+SfcPathPlanner::Plan(LayeredGraph& graph) const
+{
+  // cost of the best partial path ending at each instance of a layer, and its previous instance
+  const size_t chainLength = graph.layers.size();
+  std::vector<std::vector<double>> cost(chainLength);
+  std::vector<std::vector<size_t>> previous(chainLength);
+
+  for (size_t i = 0; i < graph.layers[0].size(); ++i) {
+    cost[0].push_back(graph.entryHops[i] + GetLoad(*graph.layers[0][i]));
+  }
+
+  for (size_t k = 1; k < chainLength; ++k) {
+    size_t nFrom = graph.layers[k - 1].size();
+    size_t nTo = graph.layers[k].size();
+    cost[k].assign(nTo, std::numeric_limits<double>::infinity());
+    previous[k].assign(nTo, 0);
+    for (size_t j = 0; j < nTo; ++j) {
+      for (size_t i = 0; i < nFrom; ++i) {
+        double newCost = cost[k - 1][i] + graph.transitHops[k - 1][i * nTo + j];
+        if (newCost < cost[k][j]) {
+          cost[k][j] = newCost;
+          previous[k][j] = i;
+        }
+      }
+      cost[k][j] += GetLoad(*graph.layers[k][j]);
+    }
+  }
+
+  const size_t last = chainLength - 1;
+  std::vector<size_t> selected(chainLength, 0);
+  double bestCost = std::numeric_limits<double>::infinity();
+  for (size_t i = 0; i < graph.layers[last].size(); ++i) {
+    double newCost = cost[last][i] + graph.exitHops[i];
+    if (newCost < bestCost) {
+      bestCost = newCost;
+      selected[last] = i;
+    }
+  }
+  for (size_t k = last; k > 0; --k) {
+    selected[k - 1] = previous[k][selected[k]];
+  }
+
+  graph.path.functionName.clear();
+  graph.path.hops = graph.entryHops[selected[0]] + graph.exitHops[selected[last]];
+  for (size_t k = 0; k < chainLength; ++k) {
+    graph.path.functionName += graph.layers[k][selected[k]]->name;
+    if (k > 0) {
+      graph.path.hops +=
+        graph.transitHops[k - 1][selected[k - 1] * graph.layers[k].size() + selected[k]];
+    }
+  }
+}
+
+double
+SfcPathPlanner::GetLoad(const Site& site) const
+{
+  return site.counterIndex <= m_load.size() ? m_load[site.counterIndex - 1] : 0;
+}
+
+uint32_t
+SfcPathPlanner::GetAccessRouter(uint32_t nodeId) const
+{
+  const std::vector<uint32_t>& neighbors = m_neighbors[nodeId];
+  return neighbors.size() == 1 ? neighbors.front() : nodeId;
+}
+
+const std::vector<int>&
+SfcPathPlanner::GetHopsFrom(uint32_t router)
+{
+  auto hops = m_hopsFrom.find(router);
+  if (hops != m_hopsFrom.end()) {
+    return hops->second;
+  }
+
+  std::vector<int>& distances = m_hopsFrom[router];
+  distances.assign(m_neighbors.size(), -1);
+  distances[router] = 0;
+
+  std::deque<uint32_t> queue(1, router);
+  while (!queue.empty()) {
+    uint32_t node = queue.front();
+    queue.pop_front();
+    for (uint32_t neighbor : m_neighbors[node]) {
+      if (distances[neighbor] < 0) {
+        distances[neighbor] = distances[node] + 1;
+        queue.push_back(neighbor);
+      }
+    }
+  }
+  return distances;
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,161 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDNSIM_UTILS_NDN_SFC_PATH_PLANNER_HPP
+#define NDNSIM_UTILS_NDN_SFC_PATH_PLANNER_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ns3/object.h"
+#include "ns3/node.h"
+#include "ns3/ptr.h"
+
+#include <map>
+#include <tuple>
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-apps
+ * @brief Source routing of service function chains for the siraiwaNDN selection mode
+ *
+ * For every function of a chain, the planner picks the instance on the shortest path from the
+ * consumer through one instance of each function to the producer.  The length of an edge is the
+ * number of router hops between the access routers of its two nodes, plus, for an edge into an
+ * instance, the call count of the instance in the last completed window (see
+ * ns3::SfcCounterStore) multiplied by the weight.  A node attached by a single link is accessed
+ * through its neighbor; any other node is its own access router.
+ *
+ * The functions of a chain type are read from SfcCatalog.  The layered graph of a (consumer,
+ * producer, chain type) is built from the topology and the instances installed with
+ * FunctionHelper on its first query.  Only the load part of the edges
+ * changes afterwards: the best path is cached and planned again after the counter window rolls
+ * over or the weight changes.
+ */
+class SfcPathPlanner : public Object {
+public:
+  /**
+   * @brief Planned path of a chain
+   */
+  struct Path {
+    std::string functionName; ///< selected instances in chain order, e.g. "/F1a/F2b/F4c"
+    int hops;                 ///< router hops of the path, without the load of the instances
+  };
+
+  static TypeId
+  GetTypeId();
+
+  SfcPathPlanner();
+
+  /**
+   * @brief Get the planner of the running simulation, creating it if needed
+   *
+   * The planner is aggregated to the simulator implementation, so Simulator::Destroy discards
+   * it together with the topology it was built from.  It is looked up once per simulation and
+   * cached until then.
+   */
+  static Ptr<SfcPathPlanner>
+  Get();
+
+  /**
+   * @brief Find the node of the producer application serving Interests for @p name
+   * @return the node, or nullptr if no ndn::Producer prefix matches @p name
+   */
+  static Ptr<Node>
+  FindProducer(const Name& name);
+
+  /**
+   * @brief Get the best path of chain type @p chainType from @p consumer to @p producer
+   * @param weight weight of the instance call counts against the hop counts
+   * @return the path; the reference is valid until the next call
+   */
+  const Path&
+  GetPath(Ptr<Node> consumer, Ptr<Node> producer, uint32_t chainType, double weight);
+
+  /**
+   * @brief Get the number of router hops between the access routers of @p from and @p to
+   */
+  int
+  GetHops(Ptr<Node> from, Ptr<Node> to);
+
+private:
+  /**
+   * @brief A function instance and the node hosting it
+   */
+  struct Site {
+    Ptr<Node> node;
+    uint32_t counterIndex; ///< instance number in ns3::SfcCounterStore
+    std::string name;      ///< name component of the instance, with leading slash
+  };
+
+  /**
+   * @brief Layered graph consumer -> instances of each function -> producer
+   */
+  struct LayeredGraph {
+    std::vector<std::vector<const Site*>> layers;
+    std::vector<int> entryHops;                ///< consumer to layer 0
+    std::vector<std::vector<int>> transitHops; ///< layer k to k + 1, row-major
+    std::vector<int> exitHops;                 ///< last layer to producer
+    uint64_t loadVersion;                      ///< load the path is planned for
+    Path path;
+  };
+
+  typedef std::tuple<uint32_t, uint32_t, uint32_t> GraphKey;
+
+  void
+  BuildTopology();
+
+  void
+  UpdateLoad(double weight);
+
+  LayeredGraph&
+  GetGraph(Ptr<Node> consumer, Ptr<Node> producer, uint32_t chainType);
+
+  void
+  Plan(LayeredGraph& graph) const;
+
+  double
+  GetLoad(const Site& site) const;
+
+  uint32_t
+  GetAccessRouter(uint32_t nodeId) const;
+
+  const std::vector<int>&
+  GetHopsFrom(uint32_t router);
+
+private:
+  bool m_isTopologyBuilt;
+  std::vector<std::vector<uint32_t>> m_neighbors; ///< adjacency of nodes, by node id
+  std::map<uint32_t, std::vector<int>> m_hopsFrom; ///< BFS distances, by source router id
+  std::vector<std::vector<Site>> m_sites;          ///< instances, by catalog function index
+
+  std::map<GraphKey, LayeredGraph> m_graphs;
+
+  std::vector<double> m_load; ///< load part of edges into instances, by counter index - 1
+  uint64_t m_loadVersion;
+  uint64_t m_loadGeneration; ///< counter window the load was read from
+  double m_loadWeight;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDNSIM_UTILS_NDN_SFC_PATH_PLANNER_HPP
@@ -0,0 +1,199 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-sfc-data-tracer.hpp"
+#include "ns3/node.h"
+#include "ns3/callback.h"
+
+#include "model/ndn-l3-protocol.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/sfc-data-trace.hpp"
+#include "ns3/simulator.h"
+#include "ns3/node-list.h"
+#include "ns3/log.h"
+
+#include <cstring>
+#include <fstream>
+#include <list>
+#include <tuple>
+
+NS_LOG_COMPONENT_DEFINE("ndn.SfcDataTracer");
+
+namespace ns3 {
+namespace ndn {
+
+static const char MAGIC[] = "NDNSFCD1";
+static const size_t MAGIC_SIZE = sizeof(MAGIC) - 1;
+
+static std::list<std::tuple<shared_ptr<std::ostream>, std::list<Ptr<SfcDataTracer>>>>
+  g_tracers;
+
+static void
+encode(uint8_t* buffer, uint64_t value, size_t size)
+{
+  for (size_t i = 0; i < size; ++i) {
+    buffer[i] = static_cast<uint8_t>(value >> (8 * i));
+  }
+}
+
+static uint64_t
+decode(const uint8_t* buffer, size_t size)
+{
+  uint64_t value = 0;
+  for (size_t i = 0; i < size; ++i) {
+    value |= static_cast<uint64_t>(buffer[i]) << (8 * i);
+  }
+  return value;
+}
+
+/**
+ * @brief Open @p file for binary writing and write the magic
+ * @return the stream, or nullptr if the file cannot be opened
+ */
+static shared_ptr<std::ostream>
+openTraceFile(const std::string& file)
+{
+  shared_ptr<std::ofstream> os(new std::ofstream());
+  os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+  if (!os->is_open()) {
+    NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
+    return nullptr;
+  }
+
+  SfcDataTracer::WriteMagic(*os);
+  return os;
+}
+
+void
+SfcDataTracer::Destroy()
+{
+  g_tracers.clear();
+}
+
+void
+SfcDataTracer::InstallAll(const std::string& file)
+{
+  shared_ptr<std::ostream> outputStream = openTraceFile(file);
+  if (outputStream == nullptr) {
+    return;
+  }
+
+  std::list<Ptr<SfcDataTracer>> tracers;
+  for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
+    tracers.push_back(Install(*node, outputStream));
+  }
+  g_tracers.push_back(std::make_tuple(outputStream, tracers));
+}
+
+void
+SfcDataTracer::Install(const NodeContainer& nodes, const std::string& file)
+{
+  shared_ptr<std::ostream> outputStream = openTraceFile(file);
+  if (outputStream == nullptr) {
+    return;
+  }
+
+  std::list<Ptr<SfcDataTracer>> tracers;
+  for (NodeContainer::Iterator node = nodes.Begin(); node != nodes.End(); node++) {
+    tracers.push_back(Install(*node, outputStream));
+  }
+  g_tracers.push_back(std::make_tuple(outputStream, tracers));
+}
+
+void
+SfcDataTracer::Install(Ptr<Node> node, const std::string& file)
+{
+  shared_ptr<std::ostream> outputStream = openTraceFile(file);
+  if (outputStream == nullptr) {
+    return;
+  }
+
+  std::list<Ptr<SfcDataTracer>> tracers;
+  tracers.push_back(Install(node, outputStream));
+  g_tracers.push_back(std::make_tuple(outputStream, tracers));
+}
+
+Ptr<SfcDataTracer>
+SfcDataTracer::Install(Ptr<Node> node, shared_ptr<std::ostream> outputStream)
+{
+  NS_LOG_DEBUG("Node: " << node->GetId());
+
+  return Create<SfcDataTracer>(outputStream, node);
+}
+
+void
+SfcDataTracer::WriteMagic(std::ostream& os)
+{
+  os.write(MAGIC, MAGIC_SIZE);
+}
+
+std::vector<SfcDataTracer::Record>
+SfcDataTracer::Read(std::istream& is)
+{
+  std::vector<Record> records;
+
+  char magic[MAGIC_SIZE];
+  if (!is.read(magic, MAGIC_SIZE) || std::memcmp(magic, MAGIC, MAGIC_SIZE) != 0) {
+    return records;
+  }
+
+  uint8_t buffer[RECORD_SIZE];
+  while (is.read(reinterpret_cast<char*>(buffer), RECORD_SIZE)) {
+    Record record;
+    record.time = NanoSeconds(static_cast<int64_t>(decode(buffer, 8)));
+    record.nodeId = static_cast<uint32_t>(decode(buffer + 8, 4));
+    record.counterIndex = static_cast<uint32_t>(decode(buffer + 12, 4));
+    record.functionCount = static_cast<int32_t>(static_cast<uint32_t>(decode(buffer + 16, 4)));
+    record.hopCount = static_cast<int32_t>(static_cast<uint32_t>(decode(buffer + 20, 4)));
+    records.push_back(record);
+  }
+  return records;
+}
+
+SfcDataTracer::SfcDataTracer(shared_ptr<std::ostream> os, Ptr<Node> node)
+  : m_nodePtr(node)
+  , m_os(os)
+{
+  Connect();
+}
+
+void
+SfcDataTracer::Connect()
+{
+  Ptr<L3Protocol> l3Protocol = m_nodePtr->GetObject<L3Protocol>();
+  if (l3Protocol == nullptr) {
+    NS_LOG_DEBUG("Node " << m_nodePtr->GetId() << " has no NDN stack, not traced");
+    return;
+  }
+  l3Protocol->TraceConnectWithoutContext("SfcData", MakeCallback(&SfcDataTracer::SfcData, this));
+}
+
+void
+SfcDataTracer::SfcData(const Data& data, const nfd::fw::SfcDataTrace& trace)
+{
+  uint8_t buffer[RECORD_SIZE];
+  encode(buffer, static_cast<uint64_t>(Simulator::Now().GetNanoSeconds()), 8);
+  encode(buffer + 8, trace.nodeId, 4);
+  encode(buffer + 12, trace.counterIndex, 4);
+  encode(buffer + 16, static_cast<uint32_t>(trace.functionCount), 4);
+  encode(buffer + 20, static_cast<uint32_t>(trace.hopCount), 4);
+  m_os->write(reinterpret_cast<const char*>(buffer), RECORD_SIZE);
+}
+
+} // namespace ndn
+} // namespace ns3
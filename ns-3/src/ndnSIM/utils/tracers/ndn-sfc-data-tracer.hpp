@@ -0,0 +1,156 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDNSIM_UTILS_TRACERS_NDN_SFC_DATA_TRACER_HPP
+#define NDNSIM_UTILS_TRACERS_NDN_SFC_DATA_TRACER_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ns3/ptr.h"
+#include "ns3/simple-ref-count.h"
+#include <ns3/nstime.h>
+#include <ns3/node-container.h>
+
+#include <iosfwd>
+#include <vector>
+
+namespace nfd {
+namespace fw {
+struct SfcDataTrace;
+} // namespace fw
+} // namespace nfd
+
+namespace ns3 {
+
+class Node;
+
+namespace ndn {
+
+/**
+ * @ingroup ndn-tracers
+ * @brief Binary writer of the "SfcData" trace source of L3Protocol
+ *
+ * The trace file starts with the 8-byte magic "NDNSFCD1", followed by one fixed-size record
+ * per Data received by a traced node.  All fields are little-endian:
+ *
+ *     int64   simulation time, in nanoseconds
+ *     uint32  node ID
+ *     uint32  instance number of the hosted instance in SfcCatalog, 0 on a router
+ *     int32   function call count carried by the Data, -1 if absent
+ *     int32   hop count carried by the Data, -1 if absent
+ *
+ * Records are written through the stream buffer without flushing, so tracing costs a copy of
+ * 24 bytes per Data.  Read() decodes a trace file for post-processing.
+ */
+class SfcDataTracer : public SimpleRefCount<SfcDataTracer> {
+public:
+  /**
+   * @brief Size of one record, in bytes
+   */
+  static const size_t RECORD_SIZE = 24;
+
+  struct Record {
+    Time time;
+    uint32_t nodeId;
+    uint32_t counterIndex;
+    int32_t functionCount;
+    int32_t hopCount;
+  };
+
+  /**
+   * @brief Helper method to install tracers on all simulation nodes
+   *
+   * @param file File to which traces will be written
+   */
+  static void
+  InstallAll(const std::string& file);
+
+  /**
+   * @brief Helper method to install tracers on the selected simulation nodes
+   *
+   * @param nodes Nodes on which to install tracer
+   * @param file File to which traces will be written
+   */
+  static void
+  Install(const NodeContainer& nodes, const std::string& file);
+
+  /**
+   * @brief Helper method to install tracer on a specific simulation node
+   *
+   * @param node Node on which to install tracer
+   * @param file File to which traces will be written
+   */
+  static void
+  Install(Ptr<Node> node, const std::string& file);
+
+  /**
+   * @brief Helper method to install tracer on a specific simulation node
+   *
+   * @param node Node on which to install tracer
+   * @param outputStream Smart pointer to a stream; the caller writes the magic with WriteMagic
+   *
+   * @returns a tracer, which needs to be preserved for the lifetime of simulation
+   */
+  static Ptr<SfcDataTracer>
+  Install(Ptr<Node> node, shared_ptr<std::ostream> outputStream);
+
+  /**
+   * @brief Explicit request to remove all statically created tracers
+   *
+   * The trace files are closed, and their buffered records written.
+   */
+  static void
+  Destroy();
+
+  /**
+   * @brief Write the magic that starts a trace file to @p os
+   */
+  static void
+  WriteMagic(std::ostream& os);
+
+  /**
+   * @brief Read the records of the trace file in @p is
+   * @return the records, or an empty vector if @p is does not start with the magic
+   */
+  static std::vector<Record>
+  Read(std::istream& is);
+
+  /**
+   * @brief Trace constructor that attaches to the node using node pointer
+   * @param os    reference to the output stream
+   * @param node  pointer to the node
+   */
+  SfcDataTracer(shared_ptr<std::ostream> os, Ptr<Node> node);
+
+private:
+  void
+  Connect();
+
+  void
+  SfcData(const Data& data, const nfd::fw::SfcDataTrace& trace);
+
+private:
+  Ptr<Node> m_nodePtr;
+  shared_ptr<std::ostream> m_os;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDNSIM_UTILS_TRACERS_NDN_SFC_DATA_TRACER_HPP
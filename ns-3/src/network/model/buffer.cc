@@ -1123,9 +1123,30 @@ void
 Buffer::Iterator::Read (uint8_t *buffer, uint32_t size)
 {
   NS_LOG_FUNCTION (this << &buffer << size);
-  for (uint32_t i = 0; i < size; i++)
+  NS_ASSERT_MSG (m_current >= m_dataStart &&
+                 m_current + size <= m_dataEnd,
+                 GetReadErrorMessage ());
+  // copy the bytes before, inside and after the zero area in one go each
+  if (m_current < m_zeroStart && size > 0)
     {
-      buffer[i] = ReadU8 ();
+      uint32_t toRead = std::min (m_zeroStart - m_current, size);
+      memcpy (buffer, m_data + m_current, toRead);
+      buffer += toRead;
+      size -= toRead;
+      m_current += toRead;
+    }
+  if (m_current < m_zeroEnd && size > 0)
+    {
+      uint32_t toRead = std::min (m_zeroEnd - m_current, size);
+      memset (buffer, 0, toRead);
+      buffer += toRead;
+      size -= toRead;
+      m_current += toRead;
+    }
+  if (size > 0)
+    {
+      memcpy (buffer, m_data + m_current - (m_zeroEnd - m_zeroStart), size);
+      m_current += size;
     }
 }
 
@@ -1161,6 +1182,13 @@ Buffer::Iterator::GetSize (void) const
   return m_dataEnd - m_dataStart;
 }
 
+uint32_t
+Buffer::Iterator::GetRemainingSize (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_dataEnd - m_current;
+}
+
 
 std::string 
 Buffer::Iterator::GetReadErrorMessage (void) const
@@ -359,6 +359,30 @@ BufferTest::DoRun (void)
   val2 <<= 8;
   val2 |= i.ReadU8 ();
   NS_TEST_ASSERT_MSG_EQ (val1, val2, "Bad ReadNtohU16()");
+
+  // bulk read across the virtual zero area
+  buffer = Buffer (5);
+  buffer.AddAtStart (2);
+  i = buffer.Begin ();
+  i.WriteU8 (0x1);
+  i.WriteU8 (0x2);
+  buffer.AddAtEnd (2);
+  i = buffer.End ();
+  i.Prev (2);
+  i.WriteU8 (0x3);
+  i.WriteU8 (0x4);
+  uint8_t bytes[9];
+  i = buffer.Begin ();
+  i.Next (1);
+  NS_TEST_ASSERT_MSG_EQ (i.GetRemainingSize (), 8u, "Bad GetRemainingSize()");
+  i.Read (bytes, 8);
+  NS_TEST_ASSERT_MSG_EQ (i.IsEnd (), true, "Bulk read did not advance the iterator");
+  NS_TEST_ASSERT_MSG_EQ (i.GetRemainingSize (), 0u, "Bad GetRemainingSize()");
+  uint8_t expected[] = { 0x2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3, 0x4 };
+  for (uint32_t j = 0; j < 8; j++)
+    {
+      NS_TEST_ASSERT_MSG_EQ ((uint16_t)bytes[j], (uint16_t)expected[j], "Bad bulk read");
+    }
 }
 //-----------------------------------------------------------------------------
 class BufferTestSuite : public TestSuite
@@ -0,0 +1,363 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// Benchmark of the SFC forwarding path of a single forwarder.
+//
+// A standalone nfd::Forwarder gets one face toward every function instance of
+// the SFC catalog and a FIB entry for every instance.  Interests carrying a
+// function chain arrive on a consumer face and go through the Interest
+// pipelines up to the function instance selection; the matching Data then
+// arrives on the face the Interest was forwarded on and goes through the Data
+// pipelines back to the consumer face.  Interests and Data are encoded before
+// the clock starts, as if they had been received from a link.
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <vector>
+
+#include "ns3/core-module.h"
+#include "ns3/ndnSIM-module.h"
+#include "ns3/ndnSIM/NFD/daemon/fw/forwarder.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/sfc-selection-policy.hpp"
+#include "ns3/ndnSIM/NFD/daemon/face/null-face.hpp"
+
+#define LOG(x)   std::cout << x << std::endl
+
+// Heap allocations made by the whole program
+static uint64_t g_nAllocations = 0;
+
+void *
+operator new (std::size_t size)
+{
+  ++g_nAllocations;
+  void *p = std::malloc (size == 0 ? 1 : size);
+  if (p == 0)
+    {
+      throw std::bad_alloc ();
+    }
+  return p;
+}
+
+void *
+operator new[] (std::size_t size)
+{
+  return operator new (size);
+}
+
+void
+operator delete (void *p) noexcept
+{
+  std::free (p);
+}
+
+void
+operator delete[] (void *p) noexcept
+{
+  std::free (p);
+}
+
+void
+operator delete (void *p, std::size_t) noexcept
+{
+  std::free (p);
+}
+
+void
+operator delete[] (void *p, std::size_t) noexcept
+{
+  std::free (p);
+}
+
+
+namespace ns3 {
+
+class Bench
+{
+public:
+  Bench (const std::string &policy, uint32_t window, uint32_t payloadSize, uint32_t csLimit,
+         bool isPitArenaEnabled);
+
+  void RunWindow (void);
+  void Report (uint32_t nPackets);
+  void Drain (void);
+
+private:
+  std::string MakeChain (uint32_t seq) const;
+  std::shared_ptr<nfd::Face> FindOutFace (const ndn::Interest &interest);
+
+  std::string m_policy;
+  uint32_t m_window;
+  uint32_t m_payloadSize;
+  uint32_t m_seq;
+
+  nfd::Forwarder m_forwarder;
+  std::shared_ptr<nfd::Face> m_consumerFace;
+  std::vector<std::shared_ptr<nfd::Face> > m_instanceFaces;
+
+  double m_interestTime;     // seconds spent in the Interest pipelines
+  double m_dataTime;         // seconds spent in the Data pipelines
+  uint64_t m_interestAllocs; // allocations made by the Interest pipelines
+  uint64_t m_dataAllocs;     // allocations made by the Data pipelines
+  uint32_t m_nForwarded;     // Interests forwarded toward an instance
+  size_t m_peakPit;
+  size_t m_peakNameTree;
+};
+
+Bench::Bench (const std::string &policy, uint32_t window, uint32_t payloadSize, uint32_t csLimit,
+              bool isPitArenaEnabled)
+  : m_policy (policy),
+    m_window (window),
+    m_payloadSize (payloadSize),
+    m_seq (0),
+    m_interestTime (0),
+    m_dataTime (0),
+    m_interestAllocs (0),
+    m_dataAllocs (0),
+    m_nForwarded (0),
+    m_peakPit (0),
+    m_peakNameTree (0)
+{
+  std::unique_ptr<nfd::fw::SfcSelectionPolicy> selectionPolicy =
+    nfd::fw::SfcSelectionPolicy::create (policy, m_forwarder);
+  if (selectionPolicy == nullptr)
+    {
+      NS_FATAL_ERROR ("Unknown SFC selection policy " << policy);
+    }
+  m_forwarder.setSfcSelectionPolicy (std::move (selectionPolicy));
+  m_forwarder.getCs ().setLimit (csLimit);
+  m_forwarder.getPit ().setArenaEnabled (isPitArenaEnabled);
+
+  m_consumerFace = nfd::face::makeNullFace (nfd::FaceUri ("null://consumer"));
+  m_forwarder.getFaceTable ().add (m_consumerFace);
+
+  Ptr<ndn::SfcCatalog> catalog = ndn::SfcCatalog::Get ();
+  for (uint32_t f = 0; f < catalog->GetNFunctions (); ++f)
+    {
+      for (const std::string &instance : catalog->GetFunction (f).instances)
+        {
+          std::shared_ptr<nfd::Face> face =
+            nfd::face::makeNullFace (nfd::FaceUri ("null://" + instance));
+          m_forwarder.getFaceTable ().add (face);
+          m_forwarder.getFib ().insert (ndn::Name ("/" + instance)).first->addNextHop (*face, 0);
+          m_instanceFaces.push_back (face);
+        }
+    }
+}
+
+std::string
+Bench::MakeChain (uint32_t seq) const
+{
+  // the chain types and instances rotate with the sequence number, so every
+  // run of the benchmark forwards the same packets
+  Ptr<ndn::SfcCatalog> catalog = ndn::SfcCatalog::Get ();
+  const ndn::SfcCatalog::Chain &chain =
+    catalog->GetChain (seq % catalog->GetNChainTypes () + 1);
+
+  std::ostringstream os;
+  for (size_t k = 0; k < chain.functions.size (); ++k)
+    {
+      const ndn::SfcCatalog::Function &function = catalog->GetFunction (chain.functions[k]);
+      const std::string &instance = function.instances[(seq + k) % function.instances.size ()];
+      if (m_policy == "fib-control")
+        {
+          // instances are selected by the forwarder
+          os << "/" << function.name << (k == 0 ? "+" : "");
+        }
+      else if (m_policy == "duration" && k > 0)
+        {
+          // the consumer selects the first instance only
+          os << "/" << function.name;
+        }
+      else
+        {
+          os << "/" << instance;
+        }
+    }
+  return os.str ();
+}
+
+std::shared_ptr<nfd::Face>
+Bench::FindOutFace (const ndn::Interest &interest)
+{
+  std::shared_ptr<nfd::pit::Entry> pitEntry = m_forwarder.getPit ().find (interest);
+  if (pitEntry == nullptr || pitEntry->getOutRecords ().empty ())
+    {
+      return nullptr;
+    }
+  return pitEntry->getOutRecords ().front ().getFace ().shared_from_this ();
+}
+
+void
+Bench::RunWindow (void)
+{
+  std::vector<std::shared_ptr<ndn::Interest> > interests;
+  for (uint32_t i = 0; i < m_window; ++i, ++m_seq)
+    {
+      std::shared_ptr<ndn::Interest> interest =
+        std::make_shared<ndn::Interest> (ndn::Name ("/prefix").appendSequenceNumber (m_seq));
+      interest->setInterestLifetime (::ndn::time::seconds (2));
+      interest->setFunction (ndn::Name (MakeChain (m_seq)));
+      m_forwarder.getSfcSelectionPolicy ().beforeExpressInterest (*interest);
+      interest->wireEncode ();
+      interests.push_back (interest);
+    }
+
+  uint64_t allocs = g_nAllocations;
+  auto start = std::chrono::steady_clock::now ();
+  for (const std::shared_ptr<ndn::Interest> &interest : interests)
+    {
+      m_forwarder.startProcessInterest (*m_consumerFace, *interest);
+    }
+  m_interestTime += std::chrono::duration<double> (std::chrono::steady_clock::now () - start)
+    .count ();
+  m_interestAllocs += g_nAllocations - allocs;
+
+  m_peakPit = std::max (m_peakPit, m_forwarder.getPit ().size ());
+  m_peakNameTree = std::max (m_peakNameTree, m_forwarder.getNameTree ().size ());
+
+  // answer every forwarded Interest on the face it was forwarded on
+  std::vector<std::pair<std::shared_ptr<nfd::Face>, std::shared_ptr<ndn::Data> > > replies;
+  for (const std::shared_ptr<ndn::Interest> &interest : interests)
+    {
+      std::shared_ptr<nfd::Face> face = FindOutFace (*interest);
+      if (face == nullptr)
+        {
+          continue;
+        }
+
+      std::shared_ptr<ndn::Data> data = std::make_shared<ndn::Data> (interest->getName ());
+      data->setContent (std::vector<uint8_t> (m_payloadSize, 0).data (), m_payloadSize);
+      ndn::Signature signature;
+      ndn::SignatureInfo signatureInfo (static_cast< ::ndn::tlv::SignatureTypeValue> (255));
+      signature.setInfo (signatureInfo);
+      signature.setValue (::ndn::makeNonNegativeIntegerBlock (::ndn::tlv::SignatureValue, 0));
+      data->setSignature (signature);
+      data->wireEncode ();
+      replies.push_back (std::make_pair (face, data));
+    }
+  m_nForwarded += replies.size ();
+
+  allocs = g_nAllocations;
+  start = std::chrono::steady_clock::now ();
+  for (const auto &reply : replies)
+    {
+      m_forwarder.startProcessData (*reply.first, *reply.second);
+    }
+  m_dataTime += std::chrono::duration<double> (std::chrono::steady_clock::now () - start)
+    .count ();
+  m_dataAllocs += g_nAllocations - allocs;
+}
+
+void
+Bench::Report (uint32_t nPackets)
+{
+  LOG ("policy:                  " << m_policy);
+  LOG ("packets:                 " << nPackets << " (" << m_nForwarded << " forwarded)");
+  LOG ("Interest ns/packet:      " << m_interestTime * 1e9 / nPackets);
+  LOG ("Interest allocs/packet:  " << static_cast<double> (m_interestAllocs) / nPackets);
+  if (m_nForwarded > 0)
+    {
+      LOG ("Data ns/packet:          " << m_dataTime * 1e9 / m_nForwarded);
+      LOG ("Data allocs/packet:      " << static_cast<double> (m_dataAllocs) / m_nForwarded);
+    }
+  LOG ("peak PIT entries:        " << m_peakPit);
+  LOG ("peak name tree entries:  " << m_peakNameTree);
+  LOG ("PIT entries:             " << m_forwarder.getPit ().size ());
+  LOG ("name tree entries:       " << m_forwarder.getNameTree ().size ());
+  LOG ("CS entries:              " << m_forwarder.getCs ().size ());
+  if (m_forwarder.getPit ().getArena () != nullptr)
+    {
+      LOG ("PIT arena slabs:         " << m_forwarder.getPit ().getArena ()->getNSlabs ());
+    }
+}
+
+void
+Bench::Drain (void)
+{
+  // satisfied PIT entries linger until their straggler timer expires
+  Simulator::Run ();
+  LOG ("PIT entries after drain:       " << m_forwarder.getPit ().size ());
+  LOG ("name tree entries after drain: " << m_forwarder.getNameTree ().size ());
+}
+
+int
+main (int argc, char *argv[])
+{
+  std::string policy = "siraiwa-ndn";
+  std::string catalogFile = "";
+  uint32_t packets = 100000;
+  uint32_t window  =   1000;
+  uint32_t payload =   1024;
+  uint32_t csLimit =    100;
+  bool pitArena = false;
+
+  CommandLine cmd;
+  cmd.Usage ("Benchmark the SFC forwarding path of a single forwarder.\n"
+             "\n"
+             "Interests with the function chains of the SFC catalog are\n"
+             "forwarded toward the function instances, then satisfied by\n"
+             "Data, --window Interests at a time.");
+  cmd.AddValue ("policy",  "SFC selection policy (default siraiwa-ndn)",    policy);
+  cmd.AddValue ("catalog", "SFC catalog file (default: built-in catalog)",  catalogFile);
+  cmd.AddValue ("packets", "number of Interests (default 1E5)",             packets);
+  cmd.AddValue ("window",  "Interests pending at a time (default 1000)",    window);
+  cmd.AddValue ("payload", "Data payload size in bytes (default 1024)",     payload);
+  cmd.AddValue ("cs",      "content store capacity in packets (default 100)", csLimit);
+  cmd.AddValue ("pitArena", "allocate PIT entries from an arena (default false)", pitArena);
+  cmd.Parse (argc, argv);
+
+  if (packets == 0)
+    {
+      NS_FATAL_ERROR ("--packets must be positive");
+    }
+  window = std::max<uint32_t> (1, std::min (window, packets));
+  packets -= packets % window;
+
+  // the first window warms up the allocator and the interned function names
+  for (bool isPrime : {true, false})
+    {
+      if (catalogFile != "")
+        {
+          ndn::SfcCatalog::LoadFile (catalogFile);
+        }
+
+      Bench *bench = new Bench (policy, window, payload, csLimit, pitArena);
+      for (uint32_t i = 0; i < (isPrime ? 1 : packets / window); ++i)
+        {
+          bench->RunWindow ();
+        }
+      if (!isPrime)
+        {
+          bench->Report (packets);
+          bench->Drain ();
+        }
+      delete bench;
+      Simulator::Destroy ();
+    }
+  return 0;
+}
+
+} // namespace ns3
+
+int
+main (int argc, char *argv[])
+{
+  return ns3::main (argc, argv);
+}